@@ -45,7 +45,8 @@
  * Demo flags.
  * ========================================================================== */
 // Source parameters.
-DEFINE_string(source, "../data/parking.avi", "Video source URI, webcam camera or video file.");
+DEFINE_string(source, "../data/parking.avi", "Video source URI, webcam camera, video file or replay:///file[?speed=max].");
+DEFINE_string(record_file, "", "Record the source frames in this file, for replays.");
 DEFINE_int32(source_width, 1280, "Source width. Only for camera.");
 DEFINE_int32(source_height, 720, "Source height. Only for camera.");
 DEFINE_int32(source_fps, 60, "Source fps. Only for camera.");
@@ -61,6 +62,14 @@ DEFINE_int32(net_width, 400, "Network input width.");
 DEFINE_bool(display_scale, true, "Scale display?");
 DEFINE_bool(display_fullscreen, true, "Fullscreen display?");
 
+// Tracing parameters.
+DEFINE_string(trace_file, "", "Save the pipeline trace (Chrome JSON) in this file.");
+// Metrics parameters.
+DEFINE_string(metrics_file, "", "Periodic dump of the metrics (Prometheus text format).");
+DEFINE_int32(metrics_period_ms, 1000, "Period of the metrics file dump, in ms.");
+DEFINE_string(metrics_socket, "", "Unix socket serving the metrics (Prometheus text format).");
+DEFINE_bool(print_performances, false, "Print performances on stdout at every frame.");
+
 
 // DEFINE_bool(image_save, false, "Save the result in some new image.");
 // DEFINE_double(threshold, 0.5, "Detection threshold.");
@@ -94,7 +103,7 @@ static std::unique_ptr<ovxio::FrameSource> create_frame_source(const ovxio::Cont
     // Get default frame source.
     ovxio::FrameSource::Parameters sourceParams;
     std::unique_ptr<ovxio::FrameSource> source(
-        ovxio::createDefaultFrameSource(context, FLAGS_source));
+        tfrt::create_frame_source(context, FLAGS_source, FLAGS_record_file));
     CHECK(source) << DEMONET << "ERROR: can't open source: " << FLAGS_source;
     // Set the parameters for camera source.
     if(source->getSourceType() == ovxio::FrameSource::CAMERA_SOURCE) {
@@ -259,10 +268,16 @@ int main(int argc, char* argv[])
         nvx::VideoStabilizer::VideoStabilizerParams params;
         params.output_height = FLAGS_net_height;
         params.output_width = FLAGS_net_width;
-        params.crop_scale_y = float(params.output_height) / (FLAGS_source_height * (1. - params.crop_y));
-        params.crop_scale_x = float(params.output_width) / (FLAGS_source_width * (1. - params.crop_x));
-        // params.crop_scale_y = std::min(params.crop_scale_y, params.crop_scale_x);
-        // params.crop_scale_x = std::min(params.crop_scale_y, params.crop_scale_x);
+        // Cropped frame letterboxed in the network input: aspect preserved and
+        // centered, the crop translation shifted by the letterbox offsets.
+        const int crop_width = int(sourceParams.frameWidth * (1. - params.crop_x) + 0.5);
+        const int crop_height = int(sourceParams.frameHeight * (1. - params.crop_y) + 0.5);
+        const tfrt::letterbox lb = tfrt::make_letterbox(
+            crop_width, crop_height, params.output_width, params.output_height);
+        params.crop_scale_x = float(lb.width) / crop_width;
+        params.crop_scale_y = float(lb.height) / crop_height;
+        params.crop_x -= lb.offset_x / (params.crop_scale_x * sourceParams.frameWidth);
+        params.crop_y -= lb.offset_y / (params.crop_scale_y * sourceParams.frameHeight);
 
         /* ============================================================================
          * Stack of frames.
@@ -322,13 +337,35 @@ int main(int argc, char* argv[])
         nvx::Timer totalTimer;
         totalTimer.tic();
         double proc_ms = 0;
+        // Pipeline tracing, frame by frame.
+        int64_t frame_id = 0;
+        tfrt::trace::enable(FLAGS_trace_file.length());
+        // Pipeline metrics: references cached, relaxed atomics in the loop.
+        auto& metrics = tfrt::metrics::registry::global();
+        auto& frames_fetched = metrics.counter("tfrt_demo_frames_fetched_total", "Frames fetched.");
+        auto& frames_dropped = metrics.counter("tfrt_demo_frames_dropped_total", "Frames fetch timeouts.");
+        auto& process_latency = metrics.histogram("tfrt_demo_stabilizer_seconds", "Stabilizer processing latency.");
+        auto& fetch_latency = metrics.histogram("tfrt_demo_fetch_seconds", "Frame fetch latency.");
+        auto& frame_latency = metrics.histogram("tfrt_demo_frame_seconds", "Complete frame latency.");
+        tfrt::metrics::register_cuda_memory(metrics);
+        tfrt::memory_tracker::global().register_metrics(metrics);
+        tfrt::memory_tracker::global().dump_at_exit();
+        tfrt::metrics::exporter metrics_exporter{metrics};
+        metrics_exporter.start(FLAGS_metrics_file, FLAGS_metrics_period_ms, FLAGS_metrics_socket);
 
         while (!eventData.shouldStop) {
+            tfrt::trace::frame(frame_id++);
+            TFRT_TRACE_SCOPE("frame", "demo");
+            tfrt::metrics::timer frame_timer{frame_latency};
             if (!eventData.pause) {
                 // Stabilize inputs.
                 nvx::Timer procTimer;
                 procTimer.tic();
-                stabilizer->process(frame);
+                {
+                    TFRT_TRACE_SCOPE("stabilizer::process", "demo");
+                    tfrt::metrics::timer process_timer{process_latency};
+                    stabilizer->process(frame);
+                }
                 proc_ms = procTimer.toc();
                 // Delay frame stack and get result.
                 NVXIO_SAFE_CALL( vxAgeDelay(orig_frame_delay) );
@@ -338,13 +375,20 @@ int main(int argc, char* argv[])
                 display_buffer_img = get_display_render_image(context, stab_frame);
 
                 // Print performance results
-                stabilizer->print_performances();
+                if (FLAGS_print_performances) {
+                    stabilizer->print_performances();
+                }
                 // Read next frame. SLOW???
-                frameStatus = source->fetch(frame, 1);
-                double fetch_ms = totalTimer.toc();
-                std::cout << "Frame fetch time : " << fetch_ms << " ms" << std::endl;
+                {
+                    TFRT_TRACE_SCOPE("FrameSource::fetch", "demo");
+                    tfrt::metrics::timer fetch_timer{fetch_latency};
+                    frameStatus = source->fetch(frame, 1);
+                }
+                if (FLAGS_print_performances) {
+                    std::cout << "Frame fetch time : " << totalTimer.toc() << " ms" << std::endl;
+                }
                 if (frameStatus == ovxio::FrameSource::TIMEOUT) {
-                    std::cout << "Frame timeout..." << std::endl;
+                    frames_dropped.inc();
                     continue;
                 }
                 else if (frameStatus == ovxio::FrameSource::CLOSED) {
@@ -353,13 +397,19 @@ int main(int argc, char* argv[])
                         break;
                     }
                 }
+                if (frameStatus == ovxio::FrameSource::OK) {
+                    frames_fetched.inc();
+                }
             }
             // Push buffer images to renderers.
+            TFRT_TRACE_SCOPE("render", "demo");
             input_renderer->putImage(input_buffer_img);
             display_renderer->putImage(display_buffer_img);
 
             double total_ms = totalTimer.toc();
-            std::cout << "Display Time : " << total_ms << " ms" << std::endl << std::endl;
+            if (FLAGS_print_performances) {
+                std::cout << "Display Time : " << total_ms << " ms" << std::endl << std::endl;
+            }
 
             syncTimer->synchronize();
             total_ms = totalTimer.toc();
@@ -372,6 +422,9 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (FLAGS_trace_file.length()) {
+            tfrt::trace::save_chrome_json(FLAGS_trace_file);
+        }
         // Release all objects
         // renderer->close();
         // vxReleaseImage(&demoImg);
@@ -15,8 +15,6 @@
 
 #include "vstab_nodes.hpp"
 
-#include <Eigen/SVD>
-
 static const char KERNEL_HOMOGRAPHY_FILTER_NAME[VX_MAX_KERNEL_NAME] = "example.nvx.homography_filter";
 
 // Kernel implementation
@@ -62,84 +60,16 @@ static vx_status VX_CALLBACK homographyFilter_kernel(vx_node, const vx_reference
         status |= vxUnmapArrayRange(mask, map_id);
     }
 
-    int inlierThresh = std::max(15, static_cast<int>(0.1 * nPoints));
-    Matrix3x3f_rm eye3x3 = Matrix3x3f_rm::Identity();
-
-    if (nInliers < inlierThresh)
-    {
-        status |= vxCopyMatrix(homography, eye3x3.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
-        return status;
-    }
-
     vx_float32 data[9];
     status |= vxCopyMatrix(homography, data, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
 
     Matrix3x3f_rm M = Matrix3x3f_rm::Map(data, 3, 3);
     M.transposeInPlace();
 
-    // restrictions on the lenghts of the diagonals of the warped image
-    Matrix3x4f_rm vertices = Matrix3x4f_rm::Zero();
-
-    for(int i=0; i<4; ++i)
-        vertices(2, i) = 1.0f;
-
-    vertices(0, 1) = static_cast<float>(width);
-    vertices(0, 2) = static_cast<float>(width);
-    vertices(1, 2) = static_cast<float>(height);
-    vertices(1, 3) = static_cast<float>(height);
-
-    Matrix3x4f_rm dstVertices = M * vertices;
-    for(int i=0; i<4; ++i)
-    {
-        dstVertices(0,i) /= dstVertices(2,i);
-        dstVertices(1,i) /= dstVertices(2,i);
-        dstVertices(2,i) = 1.0f;
-    }
-
-    float diagLenGold = std::sqrt(static_cast<float>(width*width + height*height));
-
-    float dx = dstVertices(0,0) - dstVertices(0,2);
-    float dy = dstVertices(1,0) - dstVertices(1,2);
-    float lenDiag1 = sqrt(dx*dx + dy*dy);
-
-    dx = dstVertices(0,1) - dstVertices(0,3);
-    dy = dstVertices(1,1) - dstVertices(1,3);
-    float lenDiag2 = sqrt(dx*dx + dy*dy);
-
-    float averDiagLen = (lenDiag1 + lenDiag2) / 2;
-    float diagRatio1 = std::min(diagLenGold, averDiagLen) / std::max(diagLenGold, averDiagLen);
-    if (diagRatio1 < 0.5f)
+    if (!isHomographyValid(M, width, height, nPoints, nInliers))
     {
+        Matrix3x3f_rm eye3x3 = Matrix3x3f_rm::Identity();
         status |= vxCopyMatrix(homography, eye3x3.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
-        return status;
-    }
-
-    float maxDiag = std::max(lenDiag1, lenDiag2);
-    if (maxDiag > 0.0f)
-    {
-        float diagRatio2 = std::min(lenDiag1, lenDiag2) / maxDiag;
-        if (diagRatio2 < 0.25f)
-        {
-            status |= vxCopyMatrix(homography, eye3x3.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
-            return status;
-        }
-    }
-    else
-    {
-        status |= vxCopyMatrix(homography, eye3x3.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
-        return status;
-    }
-
-    // restriction on min eigen value
-    typedef Eigen::JacobiSVD<Matrix3x3f_rm> JacobiSVD;
-
-    JacobiSVD svd(M);
-    JacobiSVD::SingularValuesType singValues = svd.singularValues();
-
-    if (singValues(2) < 1e-4f)
-    {
-        status |= vxCopyMatrix(homography, eye3x3.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
-        return status;
     }
 
     return status;
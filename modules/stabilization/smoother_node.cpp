@@ -23,45 +23,11 @@ static const char KERNEL_MATRIX_SMOOTHER_NAME[VX_MAX_KERNEL_NAME] = "example.nvx
 // Define user kernel
 //
 
-static Matrix3x3f_rm getTransformation(const std::vector<Matrix3x3f_rm>& mats, vx_int32 from, vx_int32 to)
-{
-    Matrix3x3f_rm M = Matrix3x3f_rm::Identity();
-
-    if (to > from)
-    {
-        for (vx_int32 i = from; i < to; ++i)
-            M = M * mats[i];
-    }
-    else if (to < from)
-    {
-        for (vx_int32 i = to; i < from; ++i)
-            M = M * mats[i];
-
-        M = Matrix3x3f_rm(M.inverse());
-    }
-
-    return M;
-}
-
 static void getCompensatingTransformation(const std::vector<vx_matrix>& transforms, vx_int32 idx,
                                           vx_int32 smoothingWindow, vx_matrix transform)
 {
     vx_int32 num = static_cast<vx_int32>(transforms.size());
 
-    std::vector<vx_float32> gaussWeights(num);
-    vx_float32 sigma = smoothingWindow * 0.7f;
-    for(vx_int32 i = -smoothingWindow; i < num-smoothingWindow; ++i)
-    {
-        gaussWeights[i+smoothingWindow] = exp( - i * i / (2.f * sigma * sigma) );
-    }
-
-    vx_float32 sum = 0.0f;
-    for (vx_int32 i = 0; i < num; ++i)
-        sum += gaussWeights[i];
-
-    for (vx_int32 i = 0; i < num; ++i)
-        gaussWeights[i] /= sum;
-
     std::vector<Matrix3x3f_rm> mats;
     mats.reserve(num);
 
@@ -72,10 +38,7 @@ static void getCompensatingTransformation(const std::vector<vx_matrix>& transfor
         mats.push_back( Matrix3x3f_rm::Map(data, 3, 3) );
     }
 
-    Matrix3x3f_rm avg = Matrix3x3f_rm::Zero();
-    for (vx_int32 i = idx-smoothingWindow; i <= idx+smoothingWindow; ++i)
-        avg += gaussWeights[i - idx + smoothingWindow] * getTransformation(mats, idx, i);
-
+    Matrix3x3f_rm avg = getCompensatingTransformation(mats, idx, smoothingWindow);
     vxCopyMatrix(transform, avg.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
 }
 
@@ -0,0 +1,147 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef NVX_VSTAB_MATH_HPP
+#define NVX_VSTAB_MATH_HPP
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <Eigen/Dense>
+#include <Eigen/SVD>
+
+// Host math of the stabilization nodes: no OpenVX dependency, to be
+// benchmarked and tested on its own.
+
+// row-major storage order
+typedef Eigen::Matrix<float, 3, 3, Eigen::RowMajor> Matrix3x3f_rm;
+typedef Eigen::Matrix<float, 3, 4, Eigen::RowMajor> Matrix3x4f_rm;
+
+// Composed transformation between two frames of the smoothing window.
+inline Matrix3x3f_rm getTransformation(const std::vector<Matrix3x3f_rm>& mats, int from, int to)
+{
+    Matrix3x3f_rm M = Matrix3x3f_rm::Identity();
+
+    if (to > from)
+    {
+        for (int i = from; i < to; ++i)
+            M = M * mats[i];
+    }
+    else if (to < from)
+    {
+        for (int i = to; i < from; ++i)
+            M = M * mats[i];
+
+        M = Matrix3x3f_rm(M.inverse());
+    }
+
+    return M;
+}
+
+// Gaussian weighted average of the transformations around frame idx.
+inline Matrix3x3f_rm getCompensatingTransformation(const std::vector<Matrix3x3f_rm>& mats,
+                                                   int idx, int smoothingWindow)
+{
+    int num = static_cast<int>(mats.size());
+
+    std::vector<float> gaussWeights(num);
+    float sigma = smoothingWindow * 0.7f;
+    for(int i = -smoothingWindow; i < num-smoothingWindow; ++i)
+    {
+        gaussWeights[i+smoothingWindow] = exp( - i * i / (2.f * sigma * sigma) );
+    }
+
+    float sum = 0.0f;
+    for (int i = 0; i < num; ++i)
+        sum += gaussWeights[i];
+
+    for (int i = 0; i < num; ++i)
+        gaussWeights[i] /= sum;
+
+    Matrix3x3f_rm avg = Matrix3x3f_rm::Zero();
+    for (int i = idx-smoothingWindow; i <= idx+smoothingWindow; ++i)
+        avg += gaussWeights[i - idx + smoothingWindow] * getTransformation(mats, idx, i);
+
+    return avg;
+}
+
+// Validation of an estimated homography M (row-major, column vectors):
+// enough inliers, warped image diagonals not too distorted and min singular
+// value large enough. Invalid homographies are replaced by identity.
+inline bool isHomographyValid(const Matrix3x3f_rm& M, unsigned int width, unsigned int height,
+                              size_t nPoints, int nInliers)
+{
+    int inlierThresh = std::max(15, static_cast<int>(0.1 * nPoints));
+    if (nInliers < inlierThresh)
+        return false;
+
+    // restrictions on the lenghts of the diagonals of the warped image
+    Matrix3x4f_rm vertices = Matrix3x4f_rm::Zero();
+
+    for(int i=0; i<4; ++i)
+        vertices(2, i) = 1.0f;
+
+    vertices(0, 1) = static_cast<float>(width);
+    vertices(0, 2) = static_cast<float>(width);
+    vertices(1, 2) = static_cast<float>(height);
+    vertices(1, 3) = static_cast<float>(height);
+
+    Matrix3x4f_rm dstVertices = M * vertices;
+    for(int i=0; i<4; ++i)
+    {
+        dstVertices(0,i) /= dstVertices(2,i);
+        dstVertices(1,i) /= dstVertices(2,i);
+        dstVertices(2,i) = 1.0f;
+    }
+
+    float diagLenGold = std::sqrt(static_cast<float>(width*width + height*height));
+
+    float dx = dstVertices(0,0) - dstVertices(0,2);
+    float dy = dstVertices(1,0) - dstVertices(1,2);
+    float lenDiag1 = sqrt(dx*dx + dy*dy);
+
+    dx = dstVertices(0,1) - dstVertices(0,3);
+    dy = dstVertices(1,1) - dstVertices(1,3);
+    float lenDiag2 = sqrt(dx*dx + dy*dy);
+
+    float averDiagLen = (lenDiag1 + lenDiag2) / 2;
+    float diagRatio1 = std::min(diagLenGold, averDiagLen) / std::max(diagLenGold, averDiagLen);
+    if (diagRatio1 < 0.5f)
+        return false;
+
+    float maxDiag = std::max(lenDiag1, lenDiag2);
+    if (maxDiag > 0.0f)
+    {
+        float diagRatio2 = std::min(lenDiag1, lenDiag2) / maxDiag;
+        if (diagRatio2 < 0.25f)
+            return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    // restriction on min eigen value
+    typedef Eigen::JacobiSVD<Matrix3x3f_rm> JacobiSVD;
+
+    JacobiSVD svd(M);
+    JacobiSVD::SingularValuesType singValues = svd.singularValues();
+
+    if (singValues(2) < 1e-4f)
+        return false;
+
+    return true;
+}
+
+#endif
@@ -21,9 +21,8 @@
 #include <algorithm>
 #include <Eigen/Dense>
 
-// row-major storage order
-typedef Eigen::Matrix<vx_float32, 3, 3, Eigen::RowMajor> Matrix3x3f_rm;
-typedef Eigen::Matrix<vx_float32, 3, 4, Eigen::RowMajor> Matrix3x4f_rm;
+// Matrix types and host math of the nodes.
+#include "vstab_math.hpp"
 
 // Register homographyFilter kernel in OpenVX context
 vx_status registerHomographyFilterKernel(vx_context context);
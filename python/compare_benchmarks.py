@@ -0,0 +1,316 @@
+# ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# ============================================================================
+"""Performance regression gate: compare benchmark runs against a baseline.
+
+Supported result files (JSON, format detected automatically):
+ - tfrt::profiler exports (tfrt_benchmark --profile_json): total, groups and
+    layers timings, named after the TF-RT scopes;
+ - tfrt_benchmark results (--results_json): end-to-end latencies and
+    throughput of every configuration;
+ - Google Benchmark outputs (cpu_benchmarks --benchmark_out=...), preferably
+    with --benchmark_repetitions.
+
+Every metric collects one sample per run (or per repetition). A metric
+regresses when its median changes by more than the threshold in the bad
+direction AND, with enough samples, a two-sided Mann-Whitney U test rejects
+equality (exact distribution for small samples).
+
+Minimum number of runs: with n runs per side, the smallest reachable p-value
+is 2 / C(2n, n) (complete separation), i.e. 0.1 for n=3, 0.029 for n=4 and
+0.0079 for n=5. At least 4 runs per side are needed for alpha=0.05, 5 for
+alpha=0.01. Below --min_samples, only the threshold is used. Regressions are ranked by relative change, and layers regressions
+are summed by scope prefix to locate the guilty blocks.
+
+Usage:
+    python compare_benchmarks.py \
+        --baseline baselines/inception2_*.json \
+        --candidate results/inception2_*.json \
+        --threshold 0.05 --alpha 0.05
+
+Exit code 1 if any regression is detected.
+"""
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import collections
+import itertools
+import json
+import math
+import sys
+
+
+# =========================================================================== #
+# Results files parsing.
+# =========================================================================== #
+# Metric: samples and direction (True if lower is better).
+Metric = collections.namedtuple('Metric', ['samples', 'lower_is_better', 'unit'])
+
+
+def add_sample(metrics, key, value, lower_is_better=True, unit='ms'):
+    """Add a sample to a metric, creating it if necessary."""
+    if key not in metrics:
+        metrics[key] = Metric([], lower_is_better, unit)
+    metrics[key].samples.append(float(value))
+
+
+def parse_profiler(data, metrics, stat):
+    """tfrt::profiler JSON: total, groups and layers statistics (ms)."""
+    add_sample(metrics, 'total', data['total'][stat])
+    for g in data.get('groups', []):
+        add_sample(metrics, 'group/' + g['name'], g[stat])
+    for l in data.get('layers', []):
+        add_sample(metrics, 'layer/' + l['name'], l[stat])
+
+
+def parse_tfrt_benchmark(data, metrics, stat):
+    """tfrt_benchmark JSON: latency and throughput per configuration."""
+    for r in data['results']:
+        key = 'e2e/%s/%s/b%d/%dx%d/s%d' % (
+            data.get('network', ''), r['mode'], r['batch_size'],
+            r['height'], r['width'], r['num_streams'])
+        add_sample(metrics, key + '/' + stat, r[stat])
+        add_sample(metrics, key + '/throughput', r['throughput'],
+                   lower_is_better=False, unit='img/s')
+
+
+def parse_google_benchmark(data, metrics):
+    """Google Benchmark JSON: one sample per repetition (aggregates skipped)."""
+    scales = {'ns': 1e-6, 'us': 1e-3, 'ms': 1.0, 's': 1e3}
+    for b in data['benchmarks']:
+        if b.get('run_type', 'iteration') != 'iteration':
+            continue
+        name = b.get('run_name', b['name'])
+        scale = scales[b.get('time_unit', 'ns')]
+        add_sample(metrics, 'cpu/' + name, b['real_time'] * scale)
+
+
+def load_results(filenames, stat):
+    """Load and merge metrics from result files (one run per file)."""
+    metrics = collections.OrderedDict()
+    for filename in filenames:
+        with open(filename) as f:
+            data = json.load(f)
+        if 'benchmarks' in data:
+            parse_google_benchmark(data, metrics)
+        elif 'results' in data:
+            parse_tfrt_benchmark(data, metrics, stat)
+        elif 'layers' in data and 'total' in data:
+            parse_profiler(data, metrics, stat)
+        else:
+            raise ValueError('Unknown benchmark results format: %s' % filename)
+    return metrics
+
+
+# =========================================================================== #
+# Statistics.
+# =========================================================================== #
+def median(values):
+    v = sorted(values)
+    n = len(v)
+    if n == 0:
+        return float('nan')
+    return v[n // 2] if n % 2 else 0.5 * (v[n // 2 - 1] + v[n // 2])
+
+
+def midranks(values):
+    """Ranks of values (1-based), averaged on ties."""
+    order = sorted(range(len(values)), key=lambda k: values[k])
+    ranks = [0.0] * len(values)
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[order[k]] = 0.5 * (i + j) + 1.0
+        i = j + 1
+    return ranks
+
+
+# Largest number of rank assignments enumerated by the exact test.
+EXACT_MAX_COMBINATIONS = 20000
+
+
+def num_combinations(n, k):
+    return math.factorial(n) // (math.factorial(k) * math.factorial(n - k))
+
+
+def min_pvalue(nx, ny):
+    """Smallest two-sided p-value reachable by the U test with nx and ny
+    samples (complete separation of the two sets): 2 / C(nx + ny, nx).
+    """
+    return min(1.0, 2.0 / num_combinations(nx + ny, nx))
+
+
+def min_runs(alpha):
+    """Minimum number of runs per side for a possible significance at alpha."""
+    n = 1
+    while min_pvalue(n, n) >= alpha:
+        n += 1
+    return n
+
+
+def mann_whitney_u(x, y):
+    """Two-sided Mann-Whitney U test. Returns (U statistic of x, p-value).
+    Small samples: exact distribution, enumerating all the assignments of the
+    (mid)ranks to x, i.e. exact with ties. Larger samples: normal approximation
+    with tie and continuity corrections.
+    """
+    nx, ny = len(x), len(y)
+    n = nx + ny
+    ranks = midranks(list(x) + list(y))
+    u = sum(ranks[:nx]) - nx * (nx + 1) / 2.0
+    mu = nx * ny / 2.0
+    if num_combinations(n, nx) <= EXACT_MAX_COMBINATIONS:
+        # Two-sided: assignments at least as far from the mean as observed.
+        dist = abs(u - mu) - 1e-9
+        count, total = 0, 0
+        for idxes in itertools.combinations(range(n), nx):
+            ui = sum(ranks[k] for k in idxes) - nx * (nx + 1) / 2.0
+            count += abs(ui - mu) >= dist
+            total += 1
+        return u, min(count / float(total), 1.0)
+    # Normal approximation.
+    ties = 0.0
+    for r in set(ranks):
+        t = ranks.count(r)
+        ties += t ** 3 - t
+    sigma2 = nx * ny / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if sigma2 <= 0.0:
+        return u, 1.0
+    z = (abs(u - mu) - 0.5) / math.sqrt(sigma2)
+    p = math.erfc(max(z, 0.0) / math.sqrt(2.0))
+    return u, min(p, 1.0)
+
+
+Comparison = collections.namedtuple('Comparison', [
+    'key', 'unit', 'base', 'cand', 'change', 'pvalue', 'status'])
+
+
+def compare(baseline, candidate, threshold, alpha, min_samples, min_delta):
+    """Compare all metrics present in both baseline and candidate.
+    Change is the relative slowdown (positive = worse, whatever the direction).
+    """
+    comparisons = []
+    for key, b in baseline.items():
+        if key not in candidate:
+            continue
+        c = candidate[key]
+        mb, mc = median(b.samples), median(c.samples)
+        if mb == 0.0:
+            continue
+        change = (mc - mb) / abs(mb)
+        if not b.lower_is_better:
+            change = -change
+        pvalue = None
+        if len(b.samples) >= min_samples and len(c.samples) >= min_samples:
+            _, pvalue = mann_whitney_u(b.samples, c.samples)
+        significant = pvalue is None or pvalue < alpha
+        if abs(mc - mb) < min_delta and b.unit == 'ms':
+            status = 'same'
+        elif change > threshold and significant:
+            status = 'REGRESSION'
+        elif change < -threshold and significant:
+            status = 'improvement'
+        else:
+            status = 'same'
+        comparisons.append(Comparison(key, b.unit, mb, mc, change, pvalue, status))
+    return comparisons
+
+
+def scope_summary(comparisons, depth):
+    """Sum layers medians by scope prefix (TF-RT scope naming)."""
+    scopes = collections.OrderedDict()
+    for c in comparisons:
+        if not c.key.startswith('layer/'):
+            continue
+        name = c.key[len('layer/'):]
+        scope = '/'.join(name.split('/')[:depth])
+        base, cand = scopes.get(scope, (0.0, 0.0))
+        scopes[scope] = (base + c.base, cand + c.cand)
+    summary = [(s, b, c, (c - b) / b if b > 0 else 0.0) for s, (b, c) in scopes.items()]
+    return sorted(summary, key=lambda x: -x[3])
+
+
+# =========================================================================== #
+# Report.
+# =========================================================================== #
+def print_report(comparisons, top, depth):
+    regressions = sorted([c for c in comparisons if c.status == 'REGRESSION'],
+                         key=lambda c: -c.change)
+    improvements = [c for c in comparisons if c.status == 'improvement']
+    print('Compared metrics: %d | regressions: %d | improvements: %d' % (
+        len(comparisons), len(regressions), len(improvements)))
+
+    def print_rows(rows):
+        print('%-80s %12s %12s %9s %9s' % ('metric', 'baseline', 'candidate', 'change', 'p-value'))
+        for c in rows:
+            pvalue = '%.4f' % c.pvalue if c.pvalue is not None else 'n/a'
+            print('%-80.80s %12.4f %12.4f %+8.1f%% %9s' % (
+                c.key, c.base, c.cand, 100.0 * c.change, pvalue))
+
+    if regressions:
+        print('\nWorst regressions:')
+        print_rows(regressions[:top])
+    if improvements:
+        print('\nImprovements:')
+        print_rows(sorted(improvements, key=lambda c: c.change)[:top])
+    summary = scope_summary(comparisons, depth)
+    if summary:
+        print('\nLayers by scope (depth %d, sum of medians in ms):' % depth)
+        for s, b, c, change in summary[:top]:
+            print('%-80.80s %12.4f %12.4f %+8.1f%%' % (s, b, c, 100.0 * change))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--baseline', nargs='+', required=True,
+                        help='Baseline result files (one run per file).')
+    parser.add_argument('--candidate', nargs='+', required=True,
+                        help='Candidate result files (one run per file).')
+    parser.add_argument('--stat', default='p50',
+                        help='Statistic of TF-RT results: mean, p50, p95, p99, max.')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='Relative change of the median considered as a regression.')
+    parser.add_argument('--alpha', type=float, default=0.05,
+                        help='Significance level of the Mann-Whitney U test.')
+    parser.add_argument('--min_samples', type=int, default=4,
+                        help='Minimum samples per side for the test (threshold only otherwise). '
+                             'Raised if too low to ever reach alpha.')
+    parser.add_argument('--min_delta', type=float, default=0.005,
+                        help='Minimum absolute change (ms) of a timing, to ignore tiny layers.')
+    parser.add_argument('--scope_depth', type=int, default=2,
+                        help='Scope depth used for summing layers.')
+    parser.add_argument('--top', type=int, default=20, help='Number of rows printed.')
+    args = parser.parse_args()
+
+    min_samples = max(args.min_samples, min_runs(args.alpha))
+    if min_samples != args.min_samples:
+        print('Warning: --min_samples raised to %d: U test can not reach alpha=%g with %d runs.' % (
+            min_samples, args.alpha, args.min_samples))
+    baseline = load_results(args.baseline, args.stat)
+    candidate = load_results(args.candidate, args.stat)
+    comparisons = compare(baseline, candidate, args.threshold, args.alpha,
+                          min_samples, args.min_delta)
+    regressions = print_report(comparisons, args.top, args.scope_depth)
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,39 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: network.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rnetwork.proto\x12\x07tfrt_pb\"$\n\x06\x64imsHW\x12\x0c\n\x01h\x18\x01 \x01(\x05:\x01\x30\x12\x0c\n\x01w\x18\x02 \x01(\x05:\x01\x30\"3\n\x07\x64imsCHW\x12\x0c\n\x01\x63\x18\x01 \x01(\x05:\x01\x30\x12\x0c\n\x01h\x18\x02 \x01(\x05:\x01\x30\x12\x0c\n\x01w\x18\x03 \x01(\x05:\x01\x30\"q\n\x05input\x12\x13\n\x04name\x18\x01 \x01(\t:\x05input\x12\x0e\n\x01h\x18\x02 \x01(\x05:\x03\x32\x32\x34\x12\x0e\n\x01w\x18\x03 \x01(\x05:\x03\x32\x32\x34\x12\x0c\n\x01\x63\x18\x04 \x01(\x05:\x01\x33\x12%\n\tscalemode\x18\x05 \x01(\x0e\x32\x12.tfrt_pb.ScaleMode\"`\n\x06output\x12\x14\n\x04name\x18\x01 \x01(\t:\x06output\x12\x16\n\x06suffix\x18\x05 \x01(\t:\x06output\x12\x0c\n\x01h\x18\x02 \x01(\x05:\x01\x31\x12\x0c\n\x01w\x18\x03 \x01(\x05:\x01\x31\x12\x0c\n\x01\x63\x18\x04 \x01(\x05:\x01\x31\"f\n\x06tensor\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04\x64\x61ta\x18\x02 \x01(\x0c\x12#\n\x08\x64\x61tatype\x18\x03 \x01(\x0e\x32\x11.tfrt_pb.DataType\x12\r\n\x05shape\x18\x04 \x03(\x05\x12\x0c\n\x04size\x18\x05 \x01(\x05\"\x9f\x01\n\x07network\x12\x0c\n\x04name\x18\x01 \x01(\t\x12 \n\x07weights\x18\x02 \x03(\x0b\x32\x0f.tfrt_pb.tensor\x12#\n\x08\x64\x61tatype\x18\x03 \x01(\x0e\x32\x11.tfrt_pb.DataType\x12\x1d\n\x05input\x18\x04 \x01(\x0b\x32\x0e.tfrt_pb.input\x12 \n\x07outputs\x18\x05 \x03(\x0b\x32\x0f.tfrt_pb.output*)\n\x08\x44\x61taType\x12\t\n\x05\x46LOAT\x10\x00\x12\x08\n\x04HALF\x10\x01\x12\x08\n\x04INT8\x10\x02*6\n\tScaleMode\x12\x0b\n\x07UNIFORM\x10\x00\x12\x0b\n\x07\x43HANNEL\x10\x01\x12\x0f\n\x0b\x45LEMENTWISE\x10\x02')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'network_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _DATATYPE._serialized_start=596
+  _DATATYPE._serialized_end=637
+  _SCALEMODE._serialized_start=639
+  _SCALEMODE._serialized_end=693
+  _DIMSHW._serialized_start=26
+  _DIMSHW._serialized_end=62
+  _DIMSCHW._serialized_start=64
+  _DIMSCHW._serialized_end=115
+  _INPUT._serialized_start=117
+  _INPUT._serialized_end=230
+  _OUTPUT._serialized_start=232
+  _OUTPUT._serialized_end=328
+  _TENSOR._serialized_start=330
+  _TENSOR._serialized_end=432
+  _NETWORK._serialized_start=435
+  _NETWORK._serialized_end=594
+# @@protoc_insertion_point(module_scope)
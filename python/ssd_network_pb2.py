@@ -0,0 +1,34 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: ssd_network.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+import network_pb2 as network__pb2
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11ssd_network.proto\x12\x07tfrt_pb\x1a\rnetwork.proto\"E\n\x0b\x62ox_scaling\x12\x0c\n\x01y\x18\x01 \x01(\x02:\x01\x31\x12\x0c\n\x01x\x18\x02 \x01(\x02:\x01\x31\x12\x0c\n\x01h\x18\x03 \x01(\x02:\x01\x31\x12\x0c\n\x01w\x18\x04 \x01(\x02:\x01\x31\"/\n\x0cssd_anchor2d\x12\x0f\n\x04size\x18\x01 \x01(\x02:\x01\x30\x12\x0e\n\x06scales\x18\x02 \x03(\x02\"\xb9\x02\n\x0bssd_feature\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08\x66ullname\x18\x02 \x01(\t\x12\x1f\n\x05shape\x18\x03 \x01(\x0b\x32\x10.tfrt_pb.dimsCHW\x12(\n\tanchors2d\x18\x04 \x03(\x0b\x32\x15.tfrt_pb.ssd_anchor2d\x12+\n\rprior_scaling\x18\x05 \x01(\x0b\x32\x14.tfrt_pb.box_scaling\x12\x32\n\x07outputs\x18\x06 \x01(\x0b\x32!.tfrt_pb.ssd_feature.outputs_name\x1a^\n\x0coutputs_name\x12\x15\n\rpredictions2d\x18\x01 \x01(\t\x12\x0f\n\x07\x62oxes2d\x18\x02 \x01(\t\x12\x15\n\rpredictions3d\x18\x03 \x01(\t\x12\x0f\n\x07\x62oxes3d\x18\x04 \x01(\t\"\xaa\x01\n\x0bssd_network\x12!\n\x07network\x18\x01 \x01(\x0b\x32\x10.tfrt_pb.network\x12&\n\x08\x66\x65\x61tures\x18\x02 \x03(\x0b\x32\x14.tfrt_pb.ssd_feature\x12\x19\n\x0enum_classes_2d\x18\x03 \x01(\x05:\x01\x30\x12\x19\n\x0enum_classes_3d\x18\x04 \x01(\x05:\x01\x30\x12\x1a\n\x0fnum_classes_seg\x18\x05 \x01(\x05:\x01\x30')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ssd_network_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _BOX_SCALING._serialized_start=45
+  _BOX_SCALING._serialized_end=114
+  _SSD_ANCHOR2D._serialized_start=116
+  _SSD_ANCHOR2D._serialized_end=163
+  _SSD_FEATURE._serialized_start=166
+  _SSD_FEATURE._serialized_end=479
+  _SSD_FEATURE_OUTPUTS_NAME._serialized_start=385
+  _SSD_FEATURE_OUTPUTS_NAME._serialized_end=479
+  _SSD_NETWORK._serialized_start=482
+  _SSD_NETWORK._serialized_end=652
+# @@protoc_insertion_point(module_scope)
@@ -15,7 +15,13 @@
 #ifndef TFRT_BOXES2D_OPS_H
 #define TFRT_BOXES2D_OPS_H
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 #include "boxes2d.h"
+#include "../misc/overlay.h"
+#include "../misc/resampling.h"
 
 namespace tfrt
 {
@@ -32,6 +38,235 @@ inline void rescale(boxes2d& boxes, float ry, float rx)
     boxes.col(3) *= rx;
 }
 
+/** Affine transform of 2D boxes: y' = y * ry + ty, x' = x * rx + tx.
+ */
+template <typename Derived>
+inline void transform(Eigen::ArrayBase<Derived>& boxes, float ry, float rx, float ty, float tx)
+{
+    boxes.col(0) = boxes.col(0) * ry + ty;
+    boxes.col(1) = boxes.col(1) * rx + tx;
+    boxes.col(2) = boxes.col(2) * ry + ty;
+    boxes.col(3) = boxes.col(3) * rx + tx;
+}
+/** Clip 2D boxes coordinates to [vmin, vmax].
+ */
+template <typename Derived>
+inline void clip(Eigen::ArrayBase<Derived>& boxes, float vmin=0.0f, float vmax=1.0f)
+{
+    boxes = boxes.max(vmin).min(vmax);
+}
+
+/** Areas of 2D boxes. Negative sizes are clipped to zero.
+ */
+inline vec_float areas(const boxes2d& boxes)
+{
+    return (boxes.col(2) - boxes.col(0)).max(0.0f) * (boxes.col(3) - boxes.col(1)).max(0.0f);
+}
+
+/** Intersection over union matrix between two collections of 2D boxes,
+ * written in a pre-sized output (e.g. the top left corner of a larger
+ * buffer): no memory allocation. The computation is vectorized over the first
+ * collection, one column at a time.
+ */
+template <typename Derived1, typename Derived2>
+inline void iou_matrix(const Eigen::ArrayBase<Derived1>& boxes1,
+    const Eigen::ArrayBase<Derived2>& boxes2, Eigen::Ref<Eigen::ArrayXXf> iou)
+{
+    const long n2 = boxes2.rows();
+    eigen_assert(iou.rows() == boxes1.rows() && iou.cols() == n2);
+    for(long j = 0 ; j < n2 ; ++j) {
+        const float ymin = boxes2(j, 0);
+        const float xmin = boxes2(j, 1);
+        const float ymax = boxes2(j, 2);
+        const float xmax = boxes2(j, 3);
+        const float area2 = std::max(ymax - ymin, 0.0f) * std::max(xmax - xmin, 0.0f);
+        // Intersection with all boxes of the first collection.
+        auto areas1 = (boxes1.col(2) - boxes1.col(0)).max(0.0f) *
+                      (boxes1.col(3) - boxes1.col(1)).max(0.0f);
+        auto inter = (boxes1.col(2).min(ymax) - boxes1.col(0).max(ymin)).max(0.0f) *
+                     (boxes1.col(3).min(xmax) - boxes1.col(1).max(xmin)).max(0.0f);
+        auto uni = (areas1 + area2 - inter).max(1e-12f);
+        iou.col(j) = inter / uni;
+    }
+}
+/** Intersection over union matrix between two collections of 2D boxes.
+ * Output matrix of size (#boxes1, #boxes2), only resized if necessary (i.e.
+ * can be re-used between calls).
+ */
+template <typename Derived1, typename Derived2>
+inline void iou_matrix(const Eigen::ArrayBase<Derived1>& boxes1,
+    const Eigen::ArrayBase<Derived2>& boxes2, Eigen::ArrayXXf& iou)
+{
+    if(iou.rows() != boxes1.rows() || iou.cols() != boxes2.rows()) {
+        iou.resize(boxes1.rows(), boxes2.rows());
+    }
+    iou_matrix(boxes1, boxes2, Eigen::Ref<Eigen::ArrayXXf>(iou));
+}
+
+/** Mean IoU between two sets of detections (e.g. the same network at two
+ * precisions). Greedy matching of boxes with the same class, by decreasing
+ * score of the reference detections. Unmatched boxes count as zero IoU, i.e.
+ * the sum of matched IoUs is averaged over max(#ref, #other). Only the leading
+ * non-null detections are used (see size_notnull). Two empty sets are
+ * identical (IoU = 1).
+ */
+inline float matched_iou(const bboxes2d& ref, const bboxes2d& other, Eigen::ArrayXXf& iou)
+{
+    const long n1 = ref.size_notnull();
+    const long n2 = other.size_notnull();
+    if(n1 == 0 && n2 == 0) {
+        return 1.0f;
+    }
+    if(n1 == 0 || n2 == 0) {
+        return 0.0f;
+    }
+    iou_matrix(ref.boxes.topRows(n1), other.boxes.topRows(n2), iou);
+    std::vector<long> order(n1);
+    for(long i = 0 ; i < n1 ; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [&ref](long a, long b) { return ref.scores[a] > ref.scores[b]; });
+    std::vector<bool> matched(n2, false);
+    double sum_iou = 0.0;
+    for(long i : order) {
+        long best = -1;
+        float best_iou = 0.0f;
+        for(long j = 0 ; j < n2 ; ++j) {
+            if(!matched[j] && other.classes[j] == ref.classes[i] && iou(i, j) > best_iou) {
+                best = j;
+                best_iou = iou(i, j);
+            }
+        }
+        if(best >= 0) {
+            matched[best] = true;
+            sum_iou += best_iou;
+        }
+    }
+    return float(sum_iou / std::max(n1, n2));
+}
+
+/** Greedy non-maximum suppression of the leading non-null boxes, supposed to be
+ * sorted by decreasing score: a box is suppressed if its IoU with a kept box of
+ * the same class is above the threshold. Kept boxes are compacted in front, in
+ * the same order, and the suppressed ones are zeroed. Return the number of kept
+ * boxes. The IoU matrix is only resized if necessary.
+ */
+inline long nms(bboxes2d& bboxes, float threshold, Eigen::ArrayXXf& iou)
+{
+    const long n = bboxes.size_notnull();
+    if(n == 0) {
+        return 0;
+    }
+    iou_matrix(bboxes.boxes.topRows(n), bboxes.boxes.topRows(n), iou);
+    std::vector<long> kept;
+    kept.reserve(n);
+    for(long i = 0 ; i < n ; ++i) {
+        bool suppressed = false;
+        for(long k : kept) {
+            if(bboxes.classes[k] == bboxes.classes[i] && iou(k, i) > threshold) {
+                suppressed = true;
+                break;
+            }
+        }
+        if(!suppressed) {
+            kept.push_back(i);
+        }
+    }
+    // Compaction: kept indexes are increasing, i.e. safe in-place.
+    const long nkept = kept.size();
+    for(long k = 0 ; k < nkept ; ++k) {
+        bboxes.classes[k] = bboxes.classes[kept[k]];
+        bboxes.scores[k] = bboxes.scores[kept[k]];
+        bboxes.boxes.row(k) = bboxes.boxes.row(kept[k]);
+    }
+    bboxes.classes.segment(nkept, n - nkept).setZero();
+    bboxes.scores.segment(nkept, n - nkept).setZero();
+    bboxes.boxes.middleRows(nkept, n - nkept).setZero();
+    return nkept;
+}
+inline long nms(bboxes2d& bboxes, float threshold)
+{
+    Eigen::ArrayXXf iou;
+    return nms(bboxes, threshold, iou);
+}
+
+/** Integer pixel ROIs (x, y, width, height) of the leading non-null boxes, in
+ * normalized coordinates, for an image of size (width, height). Boxes are
+ * enlarged by a relative margin on each side (context for second-stage
+ * classifiers), then clipped to the image, at least 1 pixel. At most max_rois.
+ * Return the number of ROIs.
+ */
+inline long pixel_rois(const bboxes2d& bboxes, int width, int height, float margin,
+    long max_rois, std::vector<int32_t>& rois)
+{
+    const long n = std::min(long(bboxes.size_notnull()), max_rois);
+    rois.resize(n * 4);
+    for(long i = 0 ; i < n ; ++i) {
+        const float dy = (bboxes.boxes(i, 2) - bboxes.boxes(i, 0)) * margin;
+        const float dx = (bboxes.boxes(i, 3) - bboxes.boxes(i, 1)) * margin;
+        const int y0 = std::min(std::max(int(std::floor((bboxes.boxes(i, 0) - dy) * height)), 0), height - 1);
+        const int x0 = std::min(std::max(int(std::floor((bboxes.boxes(i, 1) - dx) * width)), 0), width - 1);
+        const int y1 = std::min(std::max(int(std::ceil((bboxes.boxes(i, 2) + dy) * height)), y0 + 1), height);
+        const int x1 = std::min(std::max(int(std::ceil((bboxes.boxes(i, 3) + dx) * width)), x0 + 1), width);
+        rois[4*i] = x0;
+        rois[4*i+1] = y0;
+        rois[4*i+2] = x1 - x0;
+        rois[4*i+3] = y1 - y0;
+    }
+    return n;
+}
+
+/** Map boxes predicted on a letterboxed network input back to the source
+ * image: normalized coordinates relative to the (outwidth, outheight) input
+ * become normalized coordinates relative to the source image, clipped to it
+ * (boxes partially on the padding). Only the leading non-null boxes are
+ * transformed. Pixel coordinates can then be obtained with rescale.
+ */
+inline void unletterbox(bboxes2d& bboxes, const tfrt::letterbox& lb, int outwidth, int outheight)
+{
+    const long n = bboxes.size_notnull();
+    if(n == 0 || lb.width <= 0 || lb.height <= 0) {
+        return;
+    }
+    auto boxes = bboxes.boxes.topRows(n);
+    transform(boxes,
+        float(outheight) / lb.height, float(outwidth) / lb.width,
+        -float(lb.offset_y) / lb.height, -float(lb.offset_x) / lb.width);
+    clip(boxes, 0.0f, 1.0f);
+}
+
+/** Overlay spans of the leading non-null boxes (normalized coordinates) on an
+ * image of size (width, height): outline of the box, with a thickness in
+ * pixels, and a label tag on top of it (inside if the box touches the top of
+ * the image), whose length is proportional to the score. Colours are looked
+ * up by class; tags are opaque. The spans are reset and built.
+ */
+inline void overlay(const bboxes2d& bboxes, int width, int height, const tfrt::overlay_lut& lut,
+    int thickness, tfrt::overlay_spans& spans)
+{
+    spans.reset(width, height);
+    const long n = bboxes.size_notnull();
+    const int tag_height = 3 * std::max(thickness, 1);
+    for(long i = 0 ; i < n ; ++i) {
+        tfrt::overlay_color c = lut.colors[bboxes.classes[i] & 0xff];
+        const int y0 = int(std::floor(bboxes.boxes(i, 0) * height));
+        const int x0 = int(std::floor(bboxes.boxes(i, 1) * width));
+        const int y1 = int(std::ceil(bboxes.boxes(i, 2) * height));
+        const int x1 = int(std::ceil(bboxes.boxes(i, 3) * width));
+        if(x1 <= x0 || y1 <= y0) {
+            continue;
+        }
+        spans.add_outline(x0, y0, x1, y1, thickness, c);
+        // Label tag.
+        const float score = std::min(std::max(bboxes.scores[i], 0.0f), 1.0f);
+        const int tx1 = x0 + std::max(int(score * (x1 - x0)), 1);
+        const int ty0 = y0 >= tag_height ? y0 - tag_height : y0;
+        c.a = 255;
+        spans.add_rect(x0, ty0, tx1, ty0 + tag_height, c);
+    }
+    spans.build();
+}
 
 }
 }
@@ -0,0 +1,110 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <glog/logging.h>
+
+#include "ssd.h"
+#include "operations.h"
+
+namespace tfrt
+{
+namespace boxes2d
+{
+
+void ssd_select_raw(const float* predictions2d, const float* raw_boxes2d,
+    size_t num_anchors, size_t num_classes, size_t height, size_t width,
+    float threshold, size_t max_detections, size_t& idx, bboxes2d& bboxes)
+{
+    const size_t hw = height * width;
+    float y, x, h, w;
+    // Loop on height, width and anchors dimensions.
+    for(size_t i = 0 ; i < height ; ++i) {
+        for(size_t j = 0 ; j < width ; ++j) {
+            for(size_t k = 0 ; k < num_anchors ; ++k) {
+                // Check index did not reach bounds...
+                if(idx >= max_detections-1) {
+                    return;
+                }
+                // Initialize with no-object class, then loop over classes.
+                const float* pred = predictions2d + k * num_classes * hw + i * width + j;
+                size_t max_idx = 0;
+                float max_pred = pred[0];
+                for(size_t l = 1 ; l < num_classes ; ++l) {
+                    if(pred[l * hw] > max_pred) {
+                        max_idx = l;
+                        max_pred = pred[l * hw];
+                    }
+                }
+                // Assign bounding box.
+                if(max_idx > 0 && max_pred > threshold) {
+                    const float* raw = raw_boxes2d + k * 4 * hw + i * width + j;
+                    bboxes.classes(idx) = max_idx;
+                    bboxes.scores(idx) = max_pred;
+                    // Recall: raw output in y, x, h, w format.
+                    y = raw[0];
+                    x = raw[hw];
+                    h = raw[2 * hw];
+                    w = raw[3 * hw];
+                    // Convert to ymin, xmin, ymax, xmax.
+                    bboxes.boxes(idx, 0) = y - h / 2.;
+                    bboxes.boxes(idx, 1) = x - w / 2.;
+                    bboxes.boxes(idx, 2) = y + h / 2.;
+                    bboxes.boxes(idx, 3) = x + w / 2.;
+                    idx++;
+                }
+            }
+        }
+    }
+}
+
+bboxes2d ssd_select_tiles(const std::vector<ssd_raw_outputs>& features,
+    const tfrt::tile_grid& grid, float threshold, size_t max_detections,
+    float nms_threshold)
+{
+    // One block of max_detections rows per tile: no tile can starve the others.
+    const size_t num_tiles = grid.size();
+    bboxes2d tiles{max_detections * num_tiles};
+    size_t num_raw = 0;
+    for(size_t t = 0 ; t < num_tiles ; ++t) {
+        const size_t first = t * max_detections;
+        size_t idx = first;
+        for(auto&& f : features) {
+            const size_t hw = f.height * f.width;
+            ssd_select_raw(
+                f.predictions2d + t * f.num_anchors * f.num_classes * hw,
+                f.raw_boxes2d + t * f.num_anchors * 4 * hw,
+                f.num_anchors, f.num_classes, f.height, f.width,
+                threshold, first + max_detections, idx, tiles);
+        }
+        // Tile to frame normalized coordinates.
+        const int32_t* roi = grid.rois.data() + 4 * t;
+        auto boxes = tiles.boxes.middleRows(first, idx - first);
+        transform(boxes, float(roi[3]) / grid.height, float(roi[2]) / grid.width,
+            float(roi[1]) / grid.height, float(roi[0]) / grid.width);
+        num_raw += idx - first;
+    }
+    // Merge the detections of overlapping tiles, and keep the best ones.
+    tiles.sort_by_score(true);
+    const long num_kept = nms(tiles, nms_threshold);
+    bboxes2d bboxes{max_detections};
+    const long n = std::min(long(max_detections), long(tiles.size()));
+    bboxes.classes.head(n) = tiles.classes.head(n);
+    bboxes.scores.head(n) = tiles.scores.head(n);
+    bboxes.boxes.topRows(n) = tiles.boxes.topRows(n);
+    DLOG(INFO) << "Tiled 2D detections: " << num_raw << " raw boxes, " << num_kept << " after NMS.";
+    return bboxes;
+}
+
+}
+}
@@ -0,0 +1,67 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_BOXES2D_SSD_H
+#define TFRT_BOXES2D_SSD_H
+
+#include <cstddef>
+#include <vector>
+#include "boxes2d.h"
+#include "../misc/tiling.h"
+
+namespace tfrt
+{
+namespace boxes2d
+{
+/* ============================================================================
+ * SSD raw outputs.
+ * ========================================================================== */
+/** Select raw 2D boxes from the SSD outputs of a feature layer (one batch
+ * element): argmax over classes for every anchor, kept if not the background
+ * class and above the threshold. Boxes are converted from the raw
+ * (y, x, h, w) format to (ymin, xmin, ymax, xmax).
+ *
+ * Inputs in AHW layout: predictions2d [A, C, H, W], raw_boxes2d [A, 4, H, W].
+ * Boxes are filled from index 'idx', updated, and stop at max_detections-1.
+ */
+void ssd_select_raw(const float* predictions2d, const float* raw_boxes2d,
+    size_t num_anchors, size_t num_classes, size_t height, size_t width,
+    float threshold, size_t max_detections, size_t& idx, bboxes2d& bboxes);
+
+/** SSD raw outputs of a feature layer, for a batch (NACHW layout):
+ * predictions2d [N, A, C, H, W], raw_boxes2d [N, A, 4, H, W].
+ */
+struct ssd_raw_outputs
+{
+    const float*  predictions2d;
+    const float*  raw_boxes2d;
+    size_t  num_anchors;
+    size_t  num_classes;
+    size_t  height;
+    size_t  width;
+};
+/** Tiled detection (see tfrt::tile_grid): the batch elements are the tiles of
+ * the grid. Every tile has its own budget of max_detections raw boxes (over all
+ * feature layers), mapped from tile to frame normalized coordinates with the
+ * tile ROI. All the boxes are then sorted by decreasing score, merged by
+ * per-class NMS, and truncated to max_detections.
+ */
+bboxes2d ssd_select_tiles(const std::vector<ssd_raw_outputs>& features,
+    const tfrt::tile_grid& grid, float threshold, size_t max_detections,
+    float nms_threshold);
+
+}
+}
+
+#endif
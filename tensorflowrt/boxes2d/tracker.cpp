@@ -0,0 +1,251 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <glog/logging.h>
+
+#include "tracker.h"
+
+namespace tfrt
+{
+namespace boxes2d
+{
+
+/* ============================================================================
+ * Tracked 2D bounding boxes.
+ * ========================================================================== */
+tracked_bboxes2d::tracked_bboxes2d(size_t size) :
+    bboxes2d(size), ids{vec_int::Zero(size)}, ages{vec_int::Zero(size)}
+{}
+
+/* ============================================================================
+ * Multi-object 2D tracker.
+ * ========================================================================== */
+tracker::tracker(const parameters& params) :
+    m_params{params}, m_next_id{1}, m_has_time{false}, m_time{},
+    m_pos{boxes2d::Zero(params.max_tracks, 4)},
+    m_vel{boxes2d::Zero(params.max_tracks, 4)},
+    m_p00{boxes2d::Zero(params.max_tracks, 4)},
+    m_p01{boxes2d::Zero(params.max_tracks, 4)},
+    m_p11{boxes2d::Zero(params.max_tracks, 4)},
+    m_alive{vec_int::Zero(params.max_tracks)},
+    m_ids{vec_int::Zero(params.max_tracks)},
+    m_classes{vec_int::Zero(params.max_tracks)},
+    m_scores{vec_float::Zero(params.max_tracks)},
+    m_hits{vec_int::Zero(params.max_tracks)},
+    m_ages{vec_int::Zero(params.max_tracks)},
+    m_missed{vec_int::Zero(params.max_tracks)},
+    m_num_alive{0},
+    m_alive_boxes{boxes2d::Zero(params.max_tracks, 4)},
+    m_iou{Eigen::ArrayXXf::Zero(params.max_tracks, params.max_detections)},
+    m_tracks{params.max_tracks}
+{
+    CHECK(params.max_tracks) << "Tracker pool can not be empty.";
+    // Reserve everything once and for all.
+    m_free.reserve(params.max_tracks);
+    m_alive_idxes.reserve(params.max_tracks);
+    m_track_matched.reserve(params.max_tracks);
+    m_det_matched.reserve(params.max_detections);
+    m_pairs.reserve(params.max_tracks * params.max_detections);
+    this->reset();
+}
+
+void tracker::reset()
+{
+    m_alive.setZero();
+    m_num_alive = 0;
+    m_has_time = false;
+    // All slots are free. Popped from the back => lowest index first.
+    m_free.clear();
+    for(int i = int(m_params.max_tracks) - 1 ; i >= 0 ; --i) {
+        m_free.push_back(i);
+    }
+    m_tracks.scores.setZero();
+}
+
+const tracked_bboxes2d& tracker::update(const bboxes2d& detections)
+{
+    // Time difference with previous frame.
+    float dt = 1.0f;
+    const bool has_time = (detections.time != std::chrono::time_point<bboxes2d::clock>{});
+    if(has_time && m_has_time) {
+        dt = std::chrono::duration<float>(detections.time - m_time).count();
+        dt = std::max(dt, 0.0f);
+    }
+    m_has_time = has_time;
+    m_time = detections.time;
+
+    // Predict + associate + correct.
+    this->predict(dt);
+    const size_t num_detections = std::min(detections.size_notnull(), m_params.max_detections);
+    this->associate(detections, num_detections);
+    for(size_t i = 0 ; i < m_alive_idxes.size() ; ++i) {
+        const int tidx = m_alive_idxes[i];
+        const int didx = m_track_matched[i];
+        if(didx >= 0) {
+            this->correct(tidx, detections, didx);
+        }
+        else {
+            m_missed[tidx]++;
+            m_ages[tidx]++;
+            m_hits[tidx] = 0;
+            // Delete lost tracks.
+            if(m_missed[tidx] > m_params.max_missed) {
+                m_alive[tidx] = 0;
+                m_free.push_back(tidx);
+                m_num_alive--;
+            }
+        }
+    }
+    // New tracks from unmatched detections.
+    for(size_t j = 0 ; j < num_detections ; ++j) {
+        if(m_det_matched[j] < 0 && detections.scores[j] > m_params.score_threshold) {
+            if(!this->create(detections, j)) {
+                DLOG(WARNING) << "Tracker pool full: dropping new detection.";
+                break;
+            }
+        }
+    }
+    this->fill_tracks();
+    m_tracks.time = detections.time;
+    return m_tracks;
+}
+
+void tracker::predict(float dt)
+{
+    // Vectorized over the full pool: dead tracks are just ignored afterwards.
+    const float q = m_params.process_noise;
+    const float dt2 = dt * dt;
+    m_pos += m_vel * dt;
+    m_p00 += m_p01 * (2.0f * dt) + m_p11 * dt2 + q * dt2 * dt2 * 0.25f;
+    m_p01 += m_p11 * dt + q * dt2 * dt * 0.5f;
+    m_p11 += q * dt2;
+}
+
+void tracker::associate(const bboxes2d& detections, size_t num_detections)
+{
+    // Collect alive tracks and their predicted boxes.
+    m_alive_idxes.clear();
+    for(size_t i = 0 ; i < m_params.max_tracks ; ++i) {
+        if(m_alive[i]) {
+            m_alive_boxes.row(m_alive_idxes.size()) = m_pos.row(i);
+            m_alive_idxes.push_back(i);
+        }
+    }
+    const size_t num_tracks = m_alive_idxes.size();
+    m_track_matched.assign(num_tracks, -1);
+    m_det_matched.assign(num_detections, -1);
+    if(num_tracks == 0 || num_detections == 0) {
+        return;
+    }
+    // IoU matrix between tracks and detections.
+    iou_matrix(m_alive_boxes.topRows(num_tracks), detections.boxes.topRows(num_detections),
+               m_iou.topLeftCorner(num_tracks, num_detections));
+    // Candidate pairs above threshold.
+    m_pairs.clear();
+    for(size_t j = 0 ; j < num_detections ; ++j) {
+        if(detections.scores[j] <= m_params.score_threshold) {
+            continue;
+        }
+        for(size_t i = 0 ; i < num_tracks ; ++i) {
+            const float iou = m_iou(i, j);
+            if(iou >= m_params.iou_threshold) {
+                if(m_params.match_classes &&
+                    m_classes[m_alive_idxes[i]] != detections.classes[j]) {
+                    continue;
+                }
+                m_pairs.push_back(std::make_pair(iou, std::make_pair(int(i), int(j))));
+            }
+        }
+    }
+    // Greedy assignment by decreasing IoU.
+    std::sort(m_pairs.begin(), m_pairs.end(),
+        [](const std::pair<float, std::pair<int, int> >& p1,
+           const std::pair<float, std::pair<int, int> >& p2) {  return p1.first > p2.first;  });
+    for(auto&& p : m_pairs) {
+        const int i = p.second.first;
+        const int j = p.second.second;
+        if(m_track_matched[i] < 0 && m_det_matched[j] < 0) {
+            m_track_matched[i] = j;
+            m_det_matched[j] = i;
+        }
+    }
+}
+
+void tracker::correct(size_t tidx, const bboxes2d& detections, size_t didx)
+{
+    const float r = m_params.measurement_noise;
+    for(int k = 0 ; k < 4 ; ++k) {
+        const float p00 = m_p00(tidx, k);
+        const float p01 = m_p01(tidx, k);
+        const float s = p00 + r;
+        const float k0 = p00 / s;
+        const float k1 = p01 / s;
+        const float y = detections.boxes(didx, k) - m_pos(tidx, k);
+        m_pos(tidx, k) += k0 * y;
+        m_vel(tidx, k) += k1 * y;
+        m_p00(tidx, k) = (1.0f - k0) * p00;
+        m_p01(tidx, k) = (1.0f - k0) * p01;
+        m_p11(tidx, k) -= k1 * p01;
+    }
+    m_scores[tidx] = detections.scores[didx];
+    m_hits[tidx]++;
+    m_ages[tidx]++;
+    m_missed[tidx] = 0;
+}
+
+bool tracker::create(const bboxes2d& detections, size_t didx)
+{
+    if(m_free.empty()) {
+        return false;
+    }
+    const int tidx = m_free.back();
+    m_free.pop_back();
+    // Initial state: detection position, null velocity.
+    m_pos.row(tidx) = detections.boxes.row(didx);
+    m_vel.row(tidx).setZero();
+    m_p00.row(tidx).setConstant(m_params.measurement_noise);
+    m_p01.row(tidx).setZero();
+    m_p11.row(tidx).setConstant(m_params.velocity_variance);
+    // Track properties.
+    m_alive[tidx] = 1;
+    m_ids[tidx] = m_next_id++;
+    m_classes[tidx] = detections.classes[didx];
+    m_scores[tidx] = detections.scores[didx];
+    m_hits[tidx] = 1;
+    m_ages[tidx] = 1;
+    m_missed[tidx] = 0;
+    m_num_alive++;
+    return true;
+}
+
+void tracker::fill_tracks()
+{
+    // Confirmed tracks, updated this frame. Null scores at the end.
+    size_t idx = 0;
+    for(size_t i = 0 ; i < m_params.max_tracks ; ++i) {
+        if(m_alive[i] && m_missed[i] == 0 && m_hits[i] >= m_params.min_hits) {
+            m_tracks.classes[idx] = m_classes[i];
+            m_tracks.scores[idx] = m_scores[i];
+            m_tracks.boxes.row(idx) = m_pos.row(i);
+            m_tracks.ids[idx] = m_ids[i];
+            m_tracks.ages[idx] = m_ages[i];
+            idx++;
+        }
+    }
+    m_tracks.scores.tail(m_params.max_tracks - idx).setZero();
+}
+
+}
+}
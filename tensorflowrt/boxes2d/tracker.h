@@ -0,0 +1,173 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_BOXES2D_TRACKER_H
+#define TFRT_BOXES2D_TRACKER_H
+
+#include <vector>
+#include <utility>
+
+#include "boxes2d.h"
+
+namespace tfrt
+{
+namespace boxes2d
+{
+
+/* ============================================================================
+ * Tracked 2D bounding boxes.
+ * ========================================================================== */
+/** 2D bounding boxes with track information. Same convention as raw
+ * detections: collection of fixed size, with valid boxes first and
+ * null-score boxes at the end.
+ */
+struct tracked_bboxes2d : public bboxes2d
+{
+    /** Vector of track ids. Unique and stable in time. */
+    vec_int  ids;
+    /** Vector of track ages, in number of frames since creation (missed ones included). */
+    vec_int  ages;
+
+public:
+    /** Create a collection of certain size. Initialize all to members zeros. */
+    tracked_bboxes2d(size_t size=0);
+};
+
+/* ============================================================================
+ * Multi-object 2D tracker.
+ * ========================================================================== */
+/** Multi-object tracker on 2D bounding boxes. Greedy IoU association between
+ * predicted tracks and detections, plus a constant-velocity Kalman filter on
+ * every box coordinate (ymin, xmin, ymax, xmax).
+ *
+ * Coordinates being independent, every coordinate has its own 2x2 covariance,
+ * hence the whole filter is stored as a structure of arrays (one row per track)
+ * and predicted in a vectorized way. Tracks and association buffers are
+ * allocated once at construction, for max_tracks x max_detections: no memory
+ * allocation in the update loop.
+ */
+class tracker
+{
+public:
+    /** Tracker parameters. */
+    struct parameters
+    {
+        /** Maximum number of tracks (size of the pool). */
+        size_t  max_tracks;
+        /** Maximum number of detections per frame (extra ones are ignored). */
+        size_t  max_detections;
+        /** Minimum IoU for associating a track with a detection. */
+        float  iou_threshold;
+        /** Minimum detection score for being considered. */
+        float  score_threshold;
+        /** Only associate tracks and detections of the same class? */
+        bool  match_classes;
+        /** Number of consecutive hits before reporting a track. */
+        int  min_hits;
+        /** Number of missed frames before deleting a track. */
+        int  max_missed;
+        /** Process noise (acceleration variance) and measurement noise. */
+        float  process_noise;
+        float  measurement_noise;
+        /** Initial velocity variance of new tracks. */
+        float  velocity_variance;
+
+        parameters() :
+            max_tracks{512}, max_detections{512}, iou_threshold{0.3f}, score_threshold{0.0f},
+            match_classes{true}, min_hits{2}, max_missed{5},
+            process_noise{1e-2f}, measurement_noise{1e-4f}, velocity_variance{1e-2f} {}
+    };
+
+public:
+    /** Create a tracker, pre-allocating the pool of tracks. */
+    tracker(const parameters& params=parameters());
+
+    /** Update tracks with a new collection of detections. Time difference
+     * between frames is computed from the bboxes2d time point (in seconds),
+     * or set to 1 if no time is available.
+     * Return the collection of confirmed tracks for this frame.
+     */
+    const tracked_bboxes2d& update(const bboxes2d& detections);
+    /** Reset the tracker: all tracks deleted. Track ids are not reset. */
+    void reset();
+
+public:
+    /** Number of alive tracks (confirmed or not). */
+    size_t size() const {
+        return m_num_alive;
+    }
+    /** Tracker parameters. */
+    const parameters& params() const {
+        return m_params;
+    }
+    /** Last tracks output. */
+    const tracked_bboxes2d& tracks() const {
+        return m_tracks;
+    }
+
+protected:
+    /** Kalman prediction on all tracks. */
+    void predict(float dt);
+    /** Greedy association of alive tracks with detections. */
+    void associate(const bboxes2d& detections, size_t num_detections);
+    /** Kalman correction of a track with a detection. */
+    void correct(size_t tidx, const bboxes2d& detections, size_t didx);
+    /** Create a new track from a detection. Return false if pool is full. */
+    bool create(const bboxes2d& detections, size_t didx);
+    /** Fill the output collection. */
+    void fill_tracks();
+
+protected:
+    // Parameters.
+    parameters  m_params;
+    // Next track id and last time point.
+    int  m_next_id;
+    bool  m_has_time;
+    std::chrono::time_point<bboxes2d::clock>  m_time;
+
+    // Pool of tracks: state (position + velocity) and covariance.
+    boxes2d  m_pos;
+    boxes2d  m_vel;
+    boxes2d  m_p00;
+    boxes2d  m_p01;
+    boxes2d  m_p11;
+    // Pool of tracks: properties.
+    vec_int  m_alive;
+    vec_int  m_ids;
+    vec_int  m_classes;
+    vec_float  m_scores;
+    vec_int  m_hits;
+    vec_int  m_ages;
+    vec_int  m_missed;
+    // Free slots in the pool.
+    std::vector<int>  m_free;
+    size_t  m_num_alive;
+
+    // Association buffers: alive indexes, IoU matrix, candidate pairs.
+    // Sized max_tracks x max_detections, only their top left corner is used.
+    std::vector<int>  m_alive_idxes;
+    boxes2d  m_alive_boxes;
+    Eigen::ArrayXXf  m_iou;
+    std::vector<std::pair<float, std::pair<int, int> > >  m_pairs;
+    std::vector<int>  m_track_matched;
+    std::vector<int>  m_det_matched;
+
+    // Output tracks.
+    tracked_bboxes2d  m_tracks;
+};
+
+}
+}
+
+#endif
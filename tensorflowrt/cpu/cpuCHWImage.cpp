@@ -0,0 +1,353 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "cpuSIMD.h"
+#include "cpuCHWImage.h"
+
+namespace
+{
+/** Nearest neighbour source indexes, same single precision formula as CUDA. */
+void nearest_indexes(uint32_t insize, uint32_t outsize, std::vector<int>& indexes)
+{
+    indexes.resize(outsize);
+    for(uint32_t i = 0 ; i < outsize ; ++i) {
+        int count;
+        tfrt::resampling::taps(tfrt::resize_mode::nearest, insize, outsize, i, indexes[i], count);
+    }
+}
+/** Store 4 lanes in a fp32 / fp16 CHW plane. */
+inline void store_lanes(float* p, tfrt::simd::f32x4 v) {
+    tfrt::simd::store(p, v);
+}
+inline void store_lanes(uint16_t* p, tfrt::simd::f32x4 v) {
+    tfrt::simd::store_half(p, v);
+}
+
+template <typename T>
+void rgba_to_chw_normalize(const uint8_t* input, T* output,
+    uint32_t instride_x, uint32_t instride_y, uint32_t outwidth, uint32_t outheight,
+    const std::vector<int>& xoffsets, const std::vector<int>& yindexes,
+    const float* scale, const float* shift, size_t n, size_t pitch)
+{
+    using namespace tfrt::simd;
+    const int width = outwidth;
+    const int height = outheight;
+    const int width_simd = width - width % kFloatLanes;
+
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < height ; ++y) {
+        const uint8_t* row = input + size_t(yindexes[y]) * instride_y;
+        for(int c = 0 ; c < 3 ; ++c) {
+            const uint8_t* rowc = row + c;
+            T* out = output + n * c + size_t(y) * pitch;
+            const f32x4 vscale = set1(scale[c]);
+            const f32x4 vshift = set1(shift[c]);
+            // Gather 4 pixels, then normalize and store the lanes.
+            int x = 0;
+            for( ; x < width_simd ; x += kFloatLanes) {
+                const f32x4 v = set(rowc[xoffsets[x]], rowc[xoffsets[x+1]],
+                    rowc[xoffsets[x+2]], rowc[xoffsets[x+3]]);
+                store_lanes(out + x, madd(v, vscale, vshift));
+            }
+            // Remaining pixels: same SIMD arithmetic (no FMA contraction).
+            if(x < width) {
+                float v[kFloatLanes] = {0.0f, 0.0f, 0.0f, 0.0f};
+                for(int i = x ; i < width ; ++i) {
+                    v[i - x] = rowc[xoffsets[i]];
+                }
+                T tail[kFloatLanes];
+                store_lanes(tail, madd(load(v), vscale, vshift));
+                std::copy(tail, tail + (width - x), out + x);
+            }
+        }
+    }
+}
+
+/** Taps of a separable filter along one axis, flattened. */
+struct resize_taps
+{
+    std::vector<int>  first;
+    std::vector<int>  count;
+    std::vector<int>  offset;
+    std::vector<int16_t>  weights;
+    int  max_count;
+};
+void compute_taps(tfrt::resize_mode mode, int insize, int outsize, resize_taps& taps)
+{
+    taps.first.resize(outsize);
+    taps.count.resize(outsize);
+    taps.offset.resize(outsize);
+    taps.weights.clear();
+    taps.max_count = 1;
+    for(int x = 0 ; x < outsize ; ++x) {
+        tfrt::resampling::taps(mode, insize, outsize, x, taps.first[x], taps.count[x]);
+        taps.offset[x] = taps.weights.size();
+        for(int k = 0 ; k < taps.count[x] ; ++k) {
+            taps.weights.push_back(tfrt::resampling::weight(
+                mode, insize, outsize, x, taps.first[x] + k));
+        }
+        taps.max_count = std::max(taps.max_count, taps.count[x]);
+    }
+}
+/** Horizontal pass of a source row: 3 planes of int16 (max 255 * kOne). */
+void horizontal_pass(const uint8_t* row, int instride_x, const resize_taps& xtaps,
+    int16_t* hrow, int stride)
+{
+    const int width = xtaps.first.size();
+    for(int x = 0 ; x < width ; ++x) {
+        const uint8_t* px = row + xtaps.first[x] * instride_x;
+        const int16_t* w = xtaps.weights.data() + xtaps.offset[x];
+        int s0 = 0, s1 = 0, s2 = 0;
+        for(int k = 0 ; k < xtaps.count[x] ; ++k) {
+            s0 += px[0] * w[k];
+            s1 += px[1] * w[k];
+            s2 += px[2] * w[k];
+            px += instride_x;
+        }
+        hrow[x] = s0;
+        hrow[stride + x] = s1;
+        hrow[2*stride + x] = s2;
+    }
+}
+
+template <typename T>
+void rgba_to_chw_filter(const uint8_t* input, T* output,
+    uint32_t instride_x, uint32_t instride_y, uint32_t outwidth, uint32_t outheight,
+    const resize_taps& xtaps, const resize_taps& ytaps,
+    const float* scale, const float* shift, size_t n, size_t pitch)
+{
+    using namespace tfrt::simd;
+    const int width = outwidth;
+    const int height = outheight;
+    // Horizontal rows padded to full SIMD vectors.
+    const int stride = (width + kFloatLanes - 1) / kFloatLanes * kFloatLanes;
+    const int num_slots = ytaps.max_count;
+
+    #pragma omp parallel
+    {
+        // Thread cache of horizontal rows: source row r in slot r % num_slots,
+        // re-used by consecutive output rows.
+        std::vector<int16_t> hbuffer(size_t(num_slots) * 3 * stride, 0);
+        std::vector<int> slot_rows(num_slots, -1);
+        std::vector<const int16_t*> rows(num_slots), crows(num_slots);
+
+        #pragma omp for schedule(static)
+        for(int y = 0 ; y < height ; ++y) {
+            const int first = ytaps.first[y];
+            const int count = ytaps.count[y];
+            const int16_t* wy = ytaps.weights.data() + ytaps.offset[y];
+            for(int k = 0 ; k < count ; ++k) {
+                const int r = first + k;
+                int16_t* hrow = hbuffer.data() + size_t(r % num_slots) * 3 * stride;
+                if(slot_rows[r % num_slots] != r) {
+                    horizontal_pass(input + size_t(r) * instride_y, instride_x, xtaps, hrow, stride);
+                    slot_rows[r % num_slots] = r;
+                }
+                rows[k] = hrow;
+            }
+            const f32x4 vnorm = set1(tfrt::resampling::inv_norm());
+            for(int c = 0 ; c < 3 ; ++c) {
+                for(int k = 0 ; k < count ; ++k) {
+                    crows[k] = rows[k] + c * stride;
+                }
+                T* out = output + n * c + size_t(y) * pitch;
+                const f32x4 vscale = set1(scale[c]);
+                const f32x4 vshift = set1(shift[c]);
+                for(int x = 0 ; x < width ; x += kFloatLanes) {
+                    // Exact int32 vertical sum, then same float ops as CUDA.
+                    const f32x4 v = mul(weighted_sum_i16(crows.data(), wy, count, x), vnorm);
+                    if(x + kFloatLanes <= width) {
+                        store_lanes(out + x, madd(v, vscale, vshift));
+                    }
+                    else {
+                        T tail[kFloatLanes];
+                        store_lanes(tail, madd(v, vscale, vshift));
+                        std::copy(tail, tail + (width - x), out + x);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** Resize + normalization of the input in a (width, height) window of CHW
+ * planes of n elements, rows of pitch elements.
+ */
+template <typename T>
+void resize_normalize(const uint8_t* input, T* output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t width, uint32_t height, tfrt::resize_mode mode,
+    const float* scale, const float* shift, size_t n, size_t pitch)
+{
+    if(mode != tfrt::resize_mode::nearest) {
+        resize_taps xtaps, ytaps;
+        compute_taps(mode, inwidth, width, xtaps);
+        compute_taps(mode, inheight, height, ytaps);
+        rgba_to_chw_filter(input, output, instride_x, instride_y,
+            width, height, xtaps, ytaps, scale, shift, n, pitch);
+        return;
+    }
+    // Source offsets of every output column, in bytes.
+    std::vector<int> xoffsets, yindexes;
+    nearest_indexes(inwidth, width, xoffsets);
+    nearest_indexes(inheight, height, yindexes);
+    for(auto& x : xoffsets) {
+        x *= instride_x;
+    }
+    rgba_to_chw_normalize(input, output, instride_x, instride_y,
+        width, height, xoffsets, yindexes, scale, shift, n, pitch);
+}
+/** Fill the pixels of CHW planes outside a letterbox with the normalized pad
+ * value (same SIMD arithmetic as the resized pixels).
+ */
+template <typename T>
+void fill_letterbox_pad(T* output, uint32_t outwidth, uint32_t outheight,
+    const tfrt::letterbox& lb, float pad_value, const float* scale, const float* shift)
+{
+    using namespace tfrt::simd;
+    const size_t n = size_t(outwidth) * outheight;
+    for(int c = 0 ; c < 3 ; ++c) {
+        T pad[kFloatLanes];
+        store_lanes(pad, madd(set1(pad_value), set1(scale[c]), set1(shift[c])));
+        T* plane = output + n * c;
+        for(uint32_t y = 0 ; y < outheight ; ++y) {
+            T* row = plane + size_t(y) * outwidth;
+            if(int(y) < lb.offset_y || int(y) >= lb.offset_y + lb.height) {
+                std::fill(row, row + outwidth, pad[0]);
+            }
+            else {
+                std::fill(row, row + lb.offset_x, pad[0]);
+                std::fill(row + lb.offset_x + lb.width, row + outwidth, pad[0]);
+            }
+        }
+    }
+}
+}
+
+bool cpu_rgba_to_chw_normalize(const uint8_t* input, void* output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output)
+{
+    if( !input || !output ) {
+        return false;
+    }
+    if( inwidth == 0 || inheight == 0 || outwidth == 0 || outheight == 0 ) {
+        return false;
+    }
+    if( instride_x < 3 || instride_y < inwidth * instride_x ) {
+        return false;
+    }
+    if( mode != tfrt::resize_mode::nearest && mode != tfrt::resize_mode::bilinear &&
+        mode != tfrt::resize_mode::area ) {
+        return false;
+    }
+    float vscale[3] = {1.0f, 1.0f, 1.0f};
+    float vshift[3] = {0.0f, 0.0f, 0.0f};
+    for(int c = 0 ; c < 3 ; ++c) {
+        vscale[c] = scale ? scale[c] : 1.0f;
+        vshift[c] = shift ? shift[c] : 0.0f;
+    }
+    const size_t n = size_t(outwidth) * outheight;
+    if(half_output) {
+        resize_normalize(input, (uint16_t*)output, inwidth, inheight, instride_x, instride_y,
+            outwidth, outheight, mode, vscale, vshift, n, outwidth);
+    }
+    else {
+        resize_normalize(input, (float*)output, inwidth, inheight, instride_x, instride_y,
+            outwidth, outheight, mode, vscale, vshift, n, outwidth);
+    }
+    return true;
+}
+
+bool cpu_rgba_to_chw_letterbox(const uint8_t* input, void* output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, const tfrt::letterbox& lb, uint8_t pad_value,
+    tfrt::resize_mode mode, const float* scale, const float* shift, bool half_output)
+{
+    if( !input || !output ) {
+        return false;
+    }
+    if( inwidth == 0 || inheight == 0 || outwidth == 0 || outheight == 0 ) {
+        return false;
+    }
+    if( instride_x < 3 || instride_y < inwidth * instride_x ) {
+        return false;
+    }
+    if( lb.width <= 0 || lb.height <= 0 || lb.offset_x < 0 || lb.offset_y < 0 ||
+        lb.offset_x + lb.width > int(outwidth) || lb.offset_y + lb.height > int(outheight) ) {
+        return false;
+    }
+    if( mode != tfrt::resize_mode::nearest && mode != tfrt::resize_mode::bilinear &&
+        mode != tfrt::resize_mode::area ) {
+        return false;
+    }
+    float vscale[3] = {1.0f, 1.0f, 1.0f};
+    float vshift[3] = {0.0f, 0.0f, 0.0f};
+    for(int c = 0 ; c < 3 ; ++c) {
+        vscale[c] = scale ? scale[c] : 1.0f;
+        vshift[c] = shift ? shift[c] : 0.0f;
+    }
+    const size_t n = size_t(outwidth) * outheight;
+    const size_t offset = size_t(lb.offset_y) * outwidth + lb.offset_x;
+    if(half_output) {
+        fill_letterbox_pad((uint16_t*)output, outwidth, outheight, lb, pad_value, vscale, vshift);
+        resize_normalize(input, (uint16_t*)output + offset, inwidth, inheight,
+            instride_x, instride_y, lb.width, lb.height, mode, vscale, vshift, n, outwidth);
+    }
+    else {
+        fill_letterbox_pad((float*)output, outwidth, outheight, lb, pad_value, vscale, vshift);
+        resize_normalize(input, (float*)output + offset, inwidth, inheight,
+            instride_x, instride_y, lb.width, lb.height, mode, vscale, vshift, n, outwidth);
+    }
+    return true;
+}
+
+bool cpu_rgba_rois_to_chw_normalize(const uint8_t* input,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    const int32_t* rois, uint32_t num_rois, void* output,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output)
+{
+    if( !input || !output || (!rois && num_rois) ) {
+        return false;
+    }
+    if( inwidth == 0 || inheight == 0 || outwidth == 0 || outheight == 0 ) {
+        return false;
+    }
+    if( instride_x < 3 || instride_y < inwidth * instride_x ) {
+        return false;
+    }
+    const size_t slot_size = size_t(3) * outwidth * outheight * (half_output ? 2 : 4);
+    for(uint32_t i = 0 ; i < num_rois ; ++i) {
+        const int32_t* roi = rois + 4 * i;
+        uint8_t* slot = (uint8_t*)output + i * slot_size;
+        if( roi[0] < 0 || roi[1] < 0 || roi[2] <= 0 || roi[3] <= 0 ||
+            int64_t(roi[0]) + roi[2] > inwidth || int64_t(roi[1]) + roi[3] > inheight ) {
+            std::memset(slot, 0, slot_size);
+            continue;
+        }
+        // Crop = offset sub-image, same strides. Each ROI is parallelized over rows.
+        const uint8_t* crop = input + size_t(roi[1]) * instride_y + size_t(roi[0]) * instride_x;
+        if( !cpu_rgba_to_chw_normalize(crop, slot, roi[2], roi[3], instride_x, instride_y,
+                outwidth, outheight, mode, scale, shift, half_output) ) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,60 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_CHW_IMAGE_H
+#define TFRT_CPU_CHW_IMAGE_H
+
+#include <cstdint>
+#include "../misc/resampling.h"
+
+/** Fused preprocessing of a RGBX image (uint8, any strides in bytes), on host
+ * memory: resize to the output shape (nearest, bilinear or area averaging, see
+ * tfrt::resampling), conversion to CHW (RGB order) and per-channel
+ * normalization out = in * scale[c] + shift[c], in fp32 or fp16 (half_output,
+ * IEEE half stored as uint16_t). scale and shift are arrays of 3 values
+ * (nullptr: identity).
+ * Host version of cuda_rgba_to_chw_normalize, with bitwise identical outputs.
+ * Bilinear and area modes are separable fixed-point filters: horizontal pass
+ * per source row, vectorized vertical pass. Parallelized over rows. Return
+ * false on invalid inputs.
+ */
+bool cpu_rgba_to_chw_normalize(const uint8_t* input, void* output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output);
+
+/** Letterbox variant of cpu_rgba_to_chw_normalize: the source is resized to
+ * the inner rectangle lb of the output (see tfrt::make_letterbox, aspect
+ * preserving), pixels outside being set to the normalized pad_value.
+ * Host version of cuda_rgba_to_chw_letterbox, with bitwise identical outputs.
+ */
+bool cpu_rgba_to_chw_letterbox(const uint8_t* input, void* output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, const tfrt::letterbox& lb, uint8_t pad_value,
+    tfrt::resize_mode mode, const float* scale, const float* shift, bool half_output);
+
+/** Batched ROIs preprocessing: every ROI (x, y, width, height in pixels, array
+ * of num_rois x 4) of the RGBX image is cropped, resized and normalized as
+ * cpu_rgba_to_chw_normalize, into the consecutive CHW batch slots of output.
+ * ROIs outside the image give zero slots.
+ * Host version of cuda_rgba_rois_to_chw_normalize, with bitwise identical
+ * outputs. Return false on invalid inputs.
+ */
+bool cpu_rgba_rois_to_chw_normalize(const uint8_t* input,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    const int32_t* rois, uint32_t num_rois, void* output,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output);
+
+#endif
@@ -0,0 +1,247 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "cpuComponents.h"
+
+namespace
+{
+/** Minimum number of rows in a strip: border merging is not free. */
+const int kMinStripHeight = 16;
+
+/* ============================================================================
+ * Union-find on provisional labels. Invariant: parents[l] <= l, i.e. the root
+ * is the smallest label of the equivalence class.
+ * ========================================================================== */
+inline int32_t uf_find(int32_t* parents, int32_t l)
+{
+    // Path halving.
+    while(parents[l] < l) {
+        parents[l] = parents[parents[l]];
+        l = parents[l];
+    }
+    return l;
+}
+inline int32_t uf_union(int32_t* parents, int32_t l1, int32_t l2)
+{
+    const int32_t r1 = uf_find(parents, l1);
+    const int32_t r2 = uf_find(parents, l2);
+    if(r1 < r2) {
+        parents[r2] = r1;
+        return r1;
+    }
+    parents[r1] = r2;
+    return r2;
+}
+
+/** First pass on a strip [y0, y1): provisional labels starting at 'label0'.
+ * Runs of identical classes along rows share a label: a run is connected to
+ * the runs of the previous row of same class it overlaps (extended by one pixel
+ * on both sides for 8-connectivity). Return the next free label.
+ */
+int32_t label_strip(const uint8_t* classes, int32_t* labels, int32_t* parents,
+    int width, int y0, int y1, bool connectivity8, int32_t label0)
+{
+    const int ext = connectivity8 ? 1 : 0;
+    int32_t next = label0;
+    for(int y = y0 ; y < y1 ; ++y) {
+        const uint8_t* crow = classes + y * width;
+        const uint8_t* cup = crow - width;
+        int32_t* lrow = labels + y * width;
+        const int32_t* lup = lrow - width;
+        const bool has_up = (y > y0);
+        int x = 0;
+        while(x < width) {
+            const uint8_t c = crow[x];
+            const int x0 = x;
+            while(++x < width && crow[x] == c) {}
+            int32_t label = 0;
+            if(c != 0) {
+                // Connected runs in the previous row.
+                if(has_up) {
+                    const int xs = std::max(0, x0 - ext);
+                    const int xe = std::min(width, x + ext);
+                    for(int k = xs ; k < xe ; ++k) {
+                        if(cup[k] == c && lup[k] != label) {
+                            label = label ? uf_union(parents, label, lup[k]) : lup[k];
+                        }
+                    }
+                }
+                if(!label) {
+                    parents[next] = next;
+                    label = next++;
+                }
+            }
+            std::fill(lrow + x0, lrow + x, label);
+        }
+    }
+    return next;
+}
+
+/** Merge the first row of a strip with the last row of the previous one. */
+void merge_border(const uint8_t* classes, int32_t* labels, int32_t* parents,
+    int width, int y, bool connectivity8)
+{
+    const uint8_t* crow = classes + y * width;
+    const uint8_t* cup = crow - width;
+    const int32_t* lrow = labels + y * width;
+    const int32_t* lup = lrow - width;
+    for(int x = 0 ; x < width ; ++x) {
+        const uint8_t c = crow[x];
+        if(c == 0) {
+            continue;
+        }
+        if(cup[x] == c) {
+            uf_union(parents, lrow[x], lup[x]);
+        }
+        else if(connectivity8) {
+            if(x > 0 && cup[x-1] == c) {
+                uf_union(parents, lrow[x], lup[x-1]);
+            }
+            if(x < width - 1 && cup[x+1] == c) {
+                uf_union(parents, lrow[x], lup[x+1]);
+            }
+        }
+    }
+}
+}
+
+/* ============================================================================
+ * Connected components.
+ * ========================================================================== */
+void cpu_components::resize(size_t size)
+{
+    classes.resize(size);
+    areas.resize(size);
+    xmin.resize(size);
+    ymin.resize(size);
+    xmax.resize(size);
+    ymax.resize(size);
+    cx.resize(size);
+    cy.resize(size);
+    scores_sum.resize(size);
+}
+
+bool cpu_connected_components(
+    const uint8_t* classes, const float* scores, int32_t* labels, int32_t* parents,
+    uint32_t width, uint32_t height, bool connectivity8, uint32_t num_strips,
+    cpu_components& components)
+{
+    if( !classes || !labels || !parents ) {
+        return false;
+    }
+    if( width == 0 || height == 0 ) {
+        return false;
+    }
+    const int w = width;
+    const int h = height;
+    // Number of strips: one per thread by default.
+    int nstrips = num_strips;
+    if(nstrips == 0) {
+#ifdef _OPENMP
+        nstrips = omp_get_max_threads();
+#else
+        nstrips = 1;
+#endif
+    }
+    nstrips = std::max(1, std::min(nstrips, h / kMinStripHeight));
+    const int strip_height = (h + nstrips - 1) / nstrips;
+    nstrips = (h + strip_height - 1) / strip_height;
+
+    // Label 0: background.
+    parents[0] = 0;
+    // First pass: independent strips. Provisional labels of a strip start at
+    // its first pixel index (+1): no collision between strips.
+    std::vector<int32_t> strip_next(nstrips);
+    #pragma omp parallel for schedule(static, 1)
+    for(int s = 0 ; s < nstrips ; ++s) {
+        const int y0 = s * strip_height;
+        const int y1 = std::min(h, y0 + strip_height);
+        strip_next[s] = label_strip(classes, labels, parents, w, y0, y1,
+            connectivity8, y0 * w + 1);
+    }
+    // Merge strips borders.
+    for(int s = 1 ; s < nstrips ; ++s) {
+        merge_border(classes, labels, parents, w, s * strip_height, connectivity8);
+    }
+    // Flatten equivalences, by increasing provisional label: roots get the next
+    // final label, other labels the final label of their parent (already set).
+    int32_t num_components = 0;
+    for(int s = 0 ; s < nstrips ; ++s) {
+        const int32_t l0 = s * strip_height * w + 1;
+        for(int32_t l = l0 ; l < strip_next[s] ; ++l) {
+            const int32_t p = parents[l];
+            parents[l] = (p == l) ? ++num_components : parents[p];
+        }
+    }
+    // Second pass: final labels, in parallel.
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < h ; ++y) {
+        int32_t* lrow = labels + y * w;
+        for(int x = 0 ; x < w ; ++x) {
+            lrow[x] = parents[lrow[x]];
+        }
+    }
+    // Components statistics.
+    components.resize(num_components);
+    std::fill(components.areas.begin(), components.areas.end(), 0);
+    std::fill(components.xmin.begin(), components.xmin.end(), width);
+    std::fill(components.ymin.begin(), components.ymin.end(), height);
+    std::fill(components.xmax.begin(), components.xmax.end(), 0);
+    std::fill(components.ymax.begin(), components.ymax.end(), 0);
+    std::fill(components.cx.begin(), components.cx.end(), 0.0);
+    std::fill(components.cy.begin(), components.cy.end(), 0.0);
+    std::fill(components.scores_sum.begin(), components.scores_sum.end(), 0.0);
+    // Accumulated by runs of identical labels along rows.
+    for(int y = 0 ; y < h ; ++y) {
+        const int32_t* lrow = labels + y * w;
+        const uint8_t* crow = classes + y * w;
+        int x = 0;
+        while(x < w) {
+            const int32_t label = lrow[x];
+            const int x0 = x;
+            while(++x < w && lrow[x] == label) {}
+            if(label == 0) {
+                continue;
+            }
+            const int32_t l = label - 1;
+            const uint32_t len = x - x0;
+            components.classes[l] = crow[x0];
+            components.areas[l] += len;
+            components.xmin[l] = std::min(components.xmin[l], uint32_t(x0));
+            components.xmax[l] = std::max(components.xmax[l], uint32_t(x - 1));
+            components.ymin[l] = std::min(components.ymin[l], uint32_t(y));
+            components.ymax[l] = std::max(components.ymax[l], uint32_t(y));
+            components.cx[l] += 0.5 * double(len) * double(x0 + x - 1);
+            components.cy[l] += double(len) * y;
+            if(scores) {
+                const float* srow = scores + y * w;
+                float sum = 0.0f;
+                for(int k = x0 ; k < x ; ++k) {
+                    sum += srow[k];
+                }
+                components.scores_sum[l] += sum;
+            }
+        }
+    }
+    for(int32_t l = 0 ; l < num_components ; ++l) {
+        components.cx[l] /= components.areas[l];
+        components.cy[l] /= components.areas[l];
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_COMPONENTS_H
+#define TFRT_CPU_COMPONENTS_H
+
+#include <cstdint>
+#include <vector>
+
+/** Statistics of connected components, as a structure of arrays.
+ * Component with label l is stored at index l-1.
+ */
+struct cpu_components
+{
+    /** Class of the component. */
+    std::vector<uint8_t>  classes;
+    /** Number of pixels. */
+    std::vector<uint32_t>  areas;
+    /** Bounding box, in pixels (max coordinates included). */
+    std::vector<uint32_t>  xmin;
+    std::vector<uint32_t>  ymin;
+    std::vector<uint32_t>  xmax;
+    std::vector<uint32_t>  ymax;
+    /** Centroid, in pixels (pixel centers at integer coordinates). */
+    std::vector<double>  cx;
+    std::vector<double>  cy;
+    /** Sum of scores over the component (zero if no scores provided). */
+    std::vector<double>  scores_sum;
+
+public:
+    size_t size() const {
+        return areas.size();
+    }
+    /** Resize all arrays. Capacity is kept between frames. */
+    void resize(size_t size);
+};
+
+/** Two-pass union-find connected components labelling of a class map.
+ * Neighbouring pixels are connected if they share the same non-zero class
+ * (class 0 is the background). 8 or 4-connectivity.
+ *
+ * The image is split in horizontal strips, labelled in parallel (OpenMP), then
+ * merged along the strips borders. Output labels are consecutive, from 1 to the
+ * number of components, 0 for the background.
+ *  - classes: HW class map;
+ *  - scores: optional HW scores map, summed over components (can be null);
+ *  - labels: HW output labels;
+ *  - parents: workspace, size HW+1.
+ * Return false on invalid inputs.
+ */
+bool cpu_connected_components(
+    const uint8_t* classes, const float* scores, int32_t* labels, int32_t* parents,
+    uint32_t width, uint32_t height, bool connectivity8, uint32_t num_strips,
+    cpu_components& components);
+
+#endif
@@ -0,0 +1,287 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+
+#include <glog/logging.h>
+
+#include "../boxes2d/boxes2d.h"
+#include "cpuEval.h"
+
+namespace
+{
+const char kEvalMagic[8] = {'T', 'F', 'R', 'T', 'E', 'V', 'L', '1'};
+
+/** Index of the first maximum of an array. */
+inline uint32_t argmax(const float* v, uint32_t size)
+{
+    uint32_t idx = 0;
+    for(uint32_t i = 1 ; i < size ; ++i) {
+        if(v[i] > v[idx]) {
+            idx = i;
+        }
+    }
+    return idx;
+}
+/** Detections of a kBoxes tensor, at a batch index. */
+void fill_bboxes2d(const cpu_eval_tensor& t, uint32_t n, tfrt::boxes2d::bboxes2d& bboxes)
+{
+    const uint32_t num = t.shape[2] * t.shape[3];
+    const float* data = t.data.data() + size_t(n) * t.shape[1] * num;
+    bboxes = tfrt::boxes2d::bboxes2d(num);
+    for(uint32_t i = 0 ; i < num ; ++i) {
+        const float* row = data + i * 6;
+        bboxes.classes[i] = int(row[0]);
+        bboxes.scores[i] = row[1];
+        bboxes.boxes.row(i) << row[2], row[3], row[4], row[5];
+    }
+}
+template <typename T>
+bool read_pod(std::istream& in, T& v)
+{
+    return bool(in.read((char*)&v, sizeof(T)));
+}
+template <typename T>
+void write_pod(std::ostream& out, const T& v)
+{
+    out.write((const char*)&v, sizeof(T));
+}
+}
+
+/* ============================================================================
+ * Divergence metrics.
+ * ========================================================================== */
+bool cpu_abs_error(const float* a, const float* b, size_t size,
+    double* max_error, double* sum_error)
+{
+    if( !a || !b || !max_error || !sum_error ) {
+        return false;
+    }
+    double max_err = 0.0;
+    double sum_err = 0.0;
+    for(size_t i = 0 ; i < size ; ++i) {
+        const double err = std::fabs(double(a[i]) - double(b[i]));
+        max_err = std::max(max_err, err);
+        sum_err += err;
+    }
+    *max_error = max_err;
+    *sum_error = sum_err;
+    return true;
+}
+
+bool cpu_top1_agreement(const float* a, const float* b, uint32_t rows, uint32_t cols,
+    uint32_t* num_agree)
+{
+    if( !a || !b || !num_agree || cols == 0 ) {
+        return false;
+    }
+    uint32_t agree = 0;
+    for(uint32_t r = 0 ; r < rows ; ++r) {
+        const size_t offset = size_t(r) * cols;
+        agree += (argmax(a + offset, cols) == argmax(b + offset, cols));
+    }
+    *num_agree = agree;
+    return true;
+}
+
+bool cpu_seg_miou(const uint8_t* a, const uint8_t* b, size_t size, uint32_t num_classes,
+    double* miou)
+{
+    if( !a || !b || !miou || num_classes == 0 || num_classes > 256 ) {
+        return false;
+    }
+    // Per class: intersection and union = |A| + |B| - intersection.
+    std::vector<uint64_t> inter(num_classes, 0);
+    std::vector<uint64_t> count_a(num_classes, 0);
+    std::vector<uint64_t> count_b(num_classes, 0);
+    for(size_t i = 0 ; i < size ; ++i) {
+        if( a[i] >= num_classes || b[i] >= num_classes ) {
+            return false;
+        }
+        count_a[a[i]]++;
+        count_b[b[i]]++;
+        inter[a[i]] += (a[i] == b[i]);
+    }
+    double sum_iou = 0.0;
+    uint32_t num_present = 0;
+    for(uint32_t k = 0 ; k < num_classes ; ++k) {
+        const uint64_t uni = count_a[k] + count_b[k] - inter[k];
+        if(uni) {
+            sum_iou += double(inter[k]) / uni;
+            num_present++;
+        }
+    }
+    *miou = num_present ? sum_iou / num_present : 1.0;
+    return true;
+}
+
+/* ============================================================================
+ * Saved outputs and accumulated statistics.
+ * ========================================================================== */
+cpu_eval_tensor::cpu_eval_tensor(const std::string& _name, uint32_t _kind,
+        uint32_t n, uint32_t c, uint32_t h, uint32_t w, const float* _data) :
+    name{_name}, kind{_kind}, shape{n, c, h, w}, data{}
+{
+    if(_data) {
+        data.assign(_data, _data + this->size());
+    }
+    else {
+        data.resize(this->size(), 0.0f);
+    }
+}
+
+bool cpu_eval_compare(const std::vector<cpu_eval_tensor>& ref,
+    const std::vector<cpu_eval_tensor>& test, uint32_t num_classes,
+    std::vector<cpu_eval_stats>& stats)
+{
+    if(ref.size() != test.size()) {
+        LOG(ERROR) << "Different number of outputs: " << ref.size() << " vs " << test.size();
+        return false;
+    }
+    if(stats.empty()) {
+        stats.resize(ref.size());
+        for(size_t i = 0 ; i < ref.size() ; ++i) {
+            stats[i].name = ref[i].name;
+            stats[i].kind = ref[i].kind;
+        }
+    }
+    if(stats.size() != ref.size()) {
+        return false;
+    }
+    tfrt::boxes2d::bboxes2d bboxes_ref, bboxes_test;
+    Eigen::ArrayXXf iou;
+    std::vector<uint8_t> mask_ref, mask_test;
+    for(size_t i = 0 ; i < ref.size() ; ++i) {
+        const cpu_eval_tensor& r = ref[i];
+        const cpu_eval_tensor& t = test[i];
+        cpu_eval_stats& s = stats[i];
+        if(r.name != t.name || r.kind != t.kind || r.name != s.name) {
+            LOG(ERROR) << "Different outputs: '" << r.name << "' vs '" << t.name << "'.";
+            return false;
+        }
+        // Number of detections can differ between runs.
+        const bool same_shape = (r.kind == cpu_eval_tensor::kBoxes) ?
+            (r.shape[0] == t.shape[0] && r.shape[1] == t.shape[1]) :
+            std::equal(r.shape, r.shape + 4, t.shape);
+        if(!same_shape) {
+            LOG(ERROR) << "Different shapes of output '" << r.name << "'.";
+            return false;
+        }
+        s.num_images++;
+        if(r.kind == cpu_eval_tensor::kBoxes) {
+            double sum_iou = 0.0;
+            for(uint32_t n = 0 ; n < r.shape[0] ; ++n) {
+                fill_bboxes2d(r, n, bboxes_ref);
+                fill_bboxes2d(t, n, bboxes_test);
+                sum_iou += tfrt::boxes2d::matched_iou(bboxes_ref, bboxes_test, iou);
+            }
+            s.box_iou_sum += r.shape[0] ? sum_iou / r.shape[0] : 1.0;
+            continue;
+        }
+        double max_err, sum_err;
+        if(!cpu_abs_error(r.data.data(), t.data.data(), r.size(), &max_err, &sum_err)) {
+            return false;
+        }
+        s.num_elements += r.size();
+        s.max_abs_error = std::max(s.max_abs_error, max_err);
+        s.sum_abs_error += sum_err;
+        if(r.kind == cpu_eval_tensor::kScores) {
+            const uint32_t cols = r.shape[1] * r.shape[2] * r.shape[3];
+            uint32_t agree = 0;
+            if(!cpu_top1_agreement(r.data.data(), t.data.data(), r.shape[0], cols, &agree)) {
+                return false;
+            }
+            s.top1_total += r.shape[0];
+            s.top1_agree += agree;
+        }
+        else if(r.kind == cpu_eval_tensor::kMask) {
+            const size_t mask_size = size_t(r.shape[2]) * r.shape[3];
+            mask_ref.assign(r.data.begin(), r.data.end());
+            mask_test.assign(t.data.begin(), t.data.end());
+            for(size_t k = 0 ; k < r.size() ; k += mask_size) {
+                double miou;
+                if(!cpu_seg_miou(mask_ref.data() + k, mask_test.data() + k, mask_size,
+                        num_classes, &miou)) {
+                    return false;
+                }
+                s.miou_sum += miou;
+                s.num_masks++;
+            }
+        }
+    }
+    return true;
+}
+
+bool cpu_eval_save(const std::string& filename,
+    const std::vector<cpu_eval_tensor>& tensors, uint64_t latency_ns)
+{
+    std::ofstream out(filename, std::ios::binary);
+    if(!out) {
+        LOG(ERROR) << "Could not open evaluation file: " << filename;
+        return false;
+    }
+    out.write(kEvalMagic, sizeof(kEvalMagic));
+    write_pod(out, latency_ns);
+    write_pod(out, uint32_t(tensors.size()));
+    for(auto&& t : tensors) {
+        write_pod(out, uint32_t(t.name.size()));
+        out.write(t.name.data(), t.name.size());
+        write_pod(out, t.kind);
+        out.write((const char*)t.shape, sizeof(t.shape));
+        out.write((const char*)t.data.data(), t.data.size() * sizeof(float));
+    }
+    return bool(out);
+}
+bool cpu_eval_load(const std::string& filename,
+    std::vector<cpu_eval_tensor>& tensors, uint64_t* latency_ns)
+{
+    std::ifstream in(filename, std::ios::binary);
+    char magic[sizeof(kEvalMagic)];
+    uint32_t num_tensors = 0;
+    uint64_t latency = 0;
+    if(!in || !in.read(magic, sizeof(magic)) ||
+            std::memcmp(magic, kEvalMagic, sizeof(magic)) != 0 ||
+            !read_pod(in, latency) || !read_pod(in, num_tensors)) {
+        LOG(ERROR) << "Invalid evaluation file: " << filename;
+        return false;
+    }
+    tensors.resize(num_tensors);
+    for(auto&& t : tensors) {
+        uint32_t name_size = 0;
+        if(!read_pod(in, name_size) || name_size > 4096) {
+            LOG(ERROR) << "Invalid evaluation file: " << filename;
+            return false;
+        }
+        t.name.resize(name_size);
+        in.read(&t.name[0], name_size);
+        read_pod(in, t.kind);
+        in.read((char*)t.shape, sizeof(t.shape));
+        if(!in) {
+            LOG(ERROR) << "Invalid evaluation file: " << filename;
+            return false;
+        }
+        t.data.resize(t.size());
+        if(!in.read((char*)t.data.data(), t.data.size() * sizeof(float))) {
+            LOG(ERROR) << "Truncated evaluation file: " << filename;
+            return false;
+        }
+    }
+    if(latency_ns) {
+        *latency_ns = latency;
+    }
+    return true;
+}
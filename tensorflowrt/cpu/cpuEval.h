@@ -0,0 +1,133 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_EVAL_H
+#define TFRT_CPU_EVAL_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* ============================================================================
+ * Divergence metrics between two runs of a network.
+ * ========================================================================== */
+/** Max and sum of absolute errors between two float arrays. The sum is
+ * accumulated in double precision. Return false on invalid inputs.
+ */
+bool cpu_abs_error(const float* a, const float* b, size_t size,
+    double* max_error, double* sum_error);
+
+/** Top-1 agreement between two score matrices of shape (rows, cols): number
+ * of rows with the same argmax (first maximum in case of ties).
+ */
+bool cpu_top1_agreement(const float* a, const float* b, uint32_t rows, uint32_t cols,
+    uint32_t* num_agree);
+
+/** Mean IoU between two segmentation masks (class per pixel). IoU is averaged
+ * over the classes present in at least one of the masks. Two masks without
+ * any class (e.g. empty) are identical, miou = 1. Classes >= num_classes are
+ * invalid inputs.
+ */
+bool cpu_seg_miou(const uint8_t* a, const uint8_t* b, size_t size, uint32_t num_classes,
+    double* miou);
+
+/* ============================================================================
+ * Saved outputs and accumulated statistics.
+ * ========================================================================== */
+/** Output of a network on one image, saved for offline comparisons (e.g. on a
+ * GPU-less machine). The kind selects the metrics computed on top of the
+ * element-wise errors:
+ *  - kRaw: errors only;
+ *  - kScores: top-1 agreement over C, for every N;
+ *  - kBoxes: mean matched IoU of N detections, rows (class, score, ymin, xmin,
+ *    ymax, xmax), i.e. C=6, sorted by decreasing score;
+ *  - kMask: mIoU of the NHW class maps (C=1, classes stored as floats).
+ */
+struct cpu_eval_tensor
+{
+    enum kind_t : uint32_t {
+        kRaw = 0,
+        kScores = 1,
+        kBoxes = 2,
+        kMask = 3
+    };
+    std::string  name;
+    uint32_t  kind;
+    /** NCHW shape. */
+    uint32_t  shape[4];
+    std::vector<float>  data;
+
+public:
+    cpu_eval_tensor() : name{}, kind{kRaw}, shape{0, 0, 0, 0}, data{} {}
+    cpu_eval_tensor(const std::string& _name, uint32_t _kind,
+        uint32_t n, uint32_t c, uint32_t h, uint32_t w, const float* _data=nullptr);
+    size_t size() const {
+        return size_t(shape[0]) * shape[1] * shape[2] * shape[3];
+    }
+};
+/** Divergence statistics of an output, accumulated over images. */
+struct cpu_eval_stats
+{
+    std::string  name;
+    uint32_t  kind;
+    uint64_t  num_images;
+    /** Element-wise absolute errors. */
+    uint64_t  num_elements;
+    double  max_abs_error;
+    double  sum_abs_error;
+    /** kScores: top-1 agreement. */
+    uint64_t  top1_total;
+    uint64_t  top1_agree;
+    /** kBoxes: sum of the mean matched IoU of every image. */
+    double  box_iou_sum;
+    /** kMask: sum of the mIoU of every mask. */
+    uint64_t  num_masks;
+    double  miou_sum;
+
+public:
+    cpu_eval_stats() : name{}, kind{0}, num_images{0}, num_elements{0},
+        max_abs_error{0.0}, sum_abs_error{0.0}, top1_total{0}, top1_agree{0},
+        box_iou_sum{0.0}, num_masks{0}, miou_sum{0.0} {}
+    double mean_abs_error() const {
+        return num_elements ? sum_abs_error / num_elements : 0.0;
+    }
+    double top1_agreement() const {
+        return top1_total ? double(top1_agree) / top1_total : 1.0;
+    }
+    double mean_box_iou() const {
+        return num_images ? box_iou_sum / num_images : 1.0;
+    }
+    double mean_miou() const {
+        return num_masks ? miou_sum / num_masks : 1.0;
+    }
+};
+
+/** Compare the outputs of a test run against a reference run on one image,
+ * accumulating the statistics of every output (created at first call).
+ * Outputs must have the same names, kinds and shapes, except boxes for which
+ * the number of detections can differ. Masks use num_classes for mIoU.
+ */
+bool cpu_eval_compare(const std::vector<cpu_eval_tensor>& ref,
+    const std::vector<cpu_eval_tensor>& test, uint32_t num_classes,
+    std::vector<cpu_eval_stats>& stats);
+
+/** Save / load the outputs of a network on one image, with the latency of the
+ * run (ns). Binary file, native endianness.
+ */
+bool cpu_eval_save(const std::string& filename,
+    const std::vector<cpu_eval_tensor>& tensors, uint64_t latency_ns);
+bool cpu_eval_load(const std::string& filename,
+    std::vector<cpu_eval_tensor>& tensors, uint64_t* latency_ns);
+
+#endif
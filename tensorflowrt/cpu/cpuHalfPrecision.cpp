@@ -0,0 +1,68 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+
+#include "cpuSIMD.h"
+#include "cpuHalfPrecision.h"
+
+namespace
+{
+/** Chunk size (elements) of the parallel loops: large enough to amortize the
+ * threads scheduling on memory bound conversions.
+ */
+const long kChunkSize = 1 << 16;
+}
+
+bool cpu_float2half_array(const float* input, uint16_t* output, size_t size)
+{
+    if(!input || !output) {
+        return false;
+    }
+    const long nchunks = long((size + kChunkSize - 1) / kChunkSize);
+    #pragma omp parallel for schedule(static)
+    for(long c = 0 ; c < nchunks ; ++c) {
+        const size_t first = size_t(c) * kChunkSize;
+        const size_t last = std::min(first + kChunkSize, size);
+        size_t i = first;
+        for( ; i + tfrt::simd::kFloatLanes <= last ; i += tfrt::simd::kFloatLanes) {
+            tfrt::simd::store_half(output + i, tfrt::simd::load(input + i));
+        }
+        for( ; i < last ; ++i) {
+            output[i] = tfrt::simd::float_to_half(input[i]);
+        }
+    }
+    return true;
+}
+
+bool cpu_half2float_array(const uint16_t* input, float* output, size_t size)
+{
+    if(!input || !output) {
+        return false;
+    }
+    const long nchunks = long((size + kChunkSize - 1) / kChunkSize);
+    #pragma omp parallel for schedule(static)
+    for(long c = 0 ; c < nchunks ; ++c) {
+        const size_t first = size_t(c) * kChunkSize;
+        const size_t last = std::min(first + kChunkSize, size);
+        size_t i = first;
+        for( ; i + tfrt::simd::kFloatLanes <= last ; i += tfrt::simd::kFloatLanes) {
+            tfrt::simd::store(output + i, tfrt::simd::load_half(input + i));
+        }
+        for( ; i < last ; ++i) {
+            output[i] = tfrt::simd::half_to_float(input[i]);
+        }
+    }
+    return true;
+}
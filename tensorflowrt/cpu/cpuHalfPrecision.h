@@ -0,0 +1,35 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_HALFPRECISION_H
+#define TFRT_CPU_HALFPRECISION_H
+
+#include <cstddef>
+#include <cstdint>
+
+/* ============================================================================
+ * Host half precision conversion, mirroring cuda/cudaHalfPrecision.h.
+ * ========================================================================== */
+/** Convert an array of float into an array of IEEE half precision floats
+ * (round to nearest even, as __float2half_rn). Vectorized (F16C / NEON) and
+ * parallelized over chunks: used on mapped memory of fp16 network bindings.
+ * Note: use type uint16_t for half precision float storage.
+ */
+bool cpu_float2half_array(const float* input, uint16_t* output, size_t size);
+
+/** Convert an array of half precision floats into an array of float (exact).
+ */
+bool cpu_half2float_array(const uint16_t* input, float* output, size_t size);
+
+#endif
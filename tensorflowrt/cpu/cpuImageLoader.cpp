@@ -0,0 +1,336 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <dirent.h>
+#include <csetjmp>
+#include <cstdio>
+#include <algorithm>
+
+#include <jpeglib.h>
+#include <png.h>
+
+#include <glog/logging.h>
+
+#include "cpuImageLoader.h"
+
+namespace
+{
+/** Closes a FILE at the end of a scope. */
+struct file_closer
+{
+    FILE*  f;
+    ~file_closer() {
+        if(f) {
+            fclose(f);
+        }
+    }
+};
+
+/* ============================================================================
+ * JPEG decoding.
+ * ========================================================================== */
+/** libjpeg error manager: longjmp back instead of exit(). */
+struct jpeg_error
+{
+    jpeg_error_mgr  mgr;
+    jmp_buf  jump;
+};
+void jpeg_error_exit(j_common_ptr cinfo)
+{
+    jpeg_error* err = (jpeg_error*)cinfo->err;
+    char msg[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, msg);
+    LOG(ERROR) << "JPEG decoding error: " << msg;
+    longjmp(err->jump, 1);
+}
+void jpeg_output_message(j_common_ptr)
+{
+    // Warnings silenced (e.g. corrupt extraneous bytes).
+}
+/** Decode directly in the RGBA rows (libjpeg-turbo extended colour spaces),
+ * or expand RGB rows in place otherwise (right to left).
+ */
+bool decode_jpeg(FILE* file, cpu_image& image)
+{
+    jpeg_decompress_struct cinfo;
+    jpeg_error err;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = jpeg_error_exit;
+    err.mgr.output_message = jpeg_output_message;
+    if(setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, file);
+    jpeg_read_header(&cinfo, TRUE);
+    if(cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK) {
+        LOG(ERROR) << "CMYK JPEG images are not supported.";
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+#ifdef JCS_EXTENSIONS
+    cinfo.out_color_space = JCS_EXT_RGBA;
+    const bool expand = false;
+#else
+    cinfo.out_color_space = JCS_RGB;
+    const bool expand = true;
+#endif
+    jpeg_start_decompress(&cinfo);
+    image.width = cinfo.output_width;
+    image.height = cinfo.output_height;
+    image.data.resize(image.pitch() * image.height);
+    while(cinfo.output_scanline < cinfo.output_height) {
+        uint8_t* row = image.data.data() + cinfo.output_scanline * image.pitch();
+        JSAMPROW rows[1] = {row};
+        jpeg_read_scanlines(&cinfo, rows, 1);
+        if(expand) {
+            for(long x = long(image.width) - 1 ; x >= 0 ; --x) {
+                row[4*x+3] = 255;
+                row[4*x+2] = row[3*x+2];
+                row[4*x+1] = row[3*x+1];
+                row[4*x] = row[3*x];
+            }
+        }
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return true;
+}
+
+/* ============================================================================
+ * PNG decoding.
+ * ========================================================================== */
+void png_error_exit(png_structp png, png_const_charp msg)
+{
+    LOG(ERROR) << "PNG decoding error: " << msg;
+    longjmp(png_jmpbuf(png), 1);
+}
+void png_warning_silent(png_structp, png_const_charp)
+{
+}
+/** Decode with libpng transformations to RGBA 8 bits, rows read directly in
+ * the image buffer.
+ */
+bool decode_png(FILE* file, cpu_image& image)
+{
+    png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr,
+        png_error_exit, png_warning_silent);
+    if(!png) {
+        return false;
+    }
+    png_infop info = png_create_info_struct(png);
+    if(!info) {
+        png_destroy_read_struct(&png, nullptr, nullptr);
+        return false;
+    }
+    // Rows pointers: outside the setjmp scope.
+    std::vector<png_bytep> rows;
+    if(setjmp(png_jmpbuf(png))) {
+        png_destroy_read_struct(&png, &info, nullptr);
+        return false;
+    }
+    png_init_io(png, file);
+    png_read_info(png, info);
+    const png_byte color_type = png_get_color_type(png, info);
+    const png_byte bit_depth = png_get_bit_depth(png, info);
+    if(bit_depth == 16) {
+        png_set_strip_16(png);
+    }
+    if(color_type == PNG_COLOR_TYPE_PALETTE) {
+        png_set_palette_to_rgb(png);
+    }
+    if(color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8) {
+        png_set_expand_gray_1_2_4_to_8(png);
+    }
+    if(png_get_valid(png, info, PNG_INFO_tRNS)) {
+        png_set_tRNS_to_alpha(png);
+    }
+    if(color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA) {
+        png_set_gray_to_rgb(png);
+    }
+    if(!(color_type & PNG_COLOR_MASK_ALPHA) && !png_get_valid(png, info, PNG_INFO_tRNS)) {
+        png_set_filler(png, 0xff, PNG_FILLER_AFTER);
+    }
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+    image.width = png_get_image_width(png, info);
+    image.height = png_get_image_height(png, info);
+    if(png_get_rowbytes(png, info) != image.pitch()) {
+        LOG(ERROR) << "Unexpected PNG row size after conversion to RGBA.";
+        png_destroy_read_struct(&png, &info, nullptr);
+        return false;
+    }
+    image.data.resize(image.pitch() * image.height);
+    rows.resize(image.height);
+    for(uint32_t y = 0 ; y < image.height ; ++y) {
+        rows[y] = image.data.data() + y * image.pitch();
+    }
+    png_read_image(png, rows.data());
+    png_read_end(png, nullptr);
+    png_destroy_read_struct(&png, &info, nullptr);
+    return true;
+}
+}
+
+/* ============================================================================
+ * Image decoding.
+ * ========================================================================== */
+bool cpu_decode_image(const std::string& filename, cpu_image& image)
+{
+    image.filename = filename;
+    image.width = 0;
+    image.height = 0;
+    file_closer file{fopen(filename.c_str(), "rb")};
+    if(!file.f) {
+        LOG(ERROR) << "Could not open image file: " << filename;
+        return false;
+    }
+    // Format from the signature.
+    uint8_t sig[8] = {0};
+    const size_t nsig = fread(sig, 1, sizeof(sig), file.f);
+    rewind(file.f);
+    bool r = false;
+    if(nsig >= 3 && sig[0] == 0xff && sig[1] == 0xd8 && sig[2] == 0xff) {
+        r = decode_jpeg(file.f, image);
+    }
+    else if(nsig == 8 && png_sig_cmp(sig, 0, 8) == 0) {
+        r = decode_png(file.f, image);
+    }
+    else {
+        LOG(WARNING) << "Unsupported image format (JPEG / PNG only): " << filename;
+    }
+    if(!r) {
+        image.width = 0;
+        image.height = 0;
+    }
+    return r;
+}
+
+bool cpu_list_images(const std::string& dirname, std::vector<std::string>& filenames)
+{
+    filenames.clear();
+    DIR* dir = opendir(dirname.c_str());
+    if(!dir) {
+        LOG(ERROR) << "Could not open images directory: " << dirname;
+        return false;
+    }
+    const std::vector<std::string> extensions = {".jpg", ".jpeg", ".png"};
+    while(struct dirent* entry = readdir(dir)) {
+        std::string lname = entry->d_name;
+        std::transform(lname.begin(), lname.end(), lname.begin(), ::tolower);
+        for(auto&& ext : extensions) {
+            if(lname.size() > ext.size() &&
+                    lname.compare(lname.size() - ext.size(), ext.size(), ext) == 0) {
+                filenames.push_back(dirname + "/" + entry->d_name);
+                break;
+            }
+        }
+    }
+    closedir(dir);
+    std::sort(filenames.begin(), filenames.end());
+    return true;
+}
+
+bool cpu_image_to_rgba_float(const cpu_image& image, float* output)
+{
+    if(!output || !image.valid()) {
+        return false;
+    }
+    const size_t size = image.pitch() * image.height;
+    const uint8_t* input = image.data.data();
+    #pragma omp parallel for if(size > (1 << 16))
+    for(long i = 0 ; i < long(size) ; ++i) {
+        output[i] = float(input[i]);
+    }
+    return true;
+}
+
+/* ============================================================================
+ * Prefetching images loader.
+ * ========================================================================== */
+cpu_image_loader::cpu_image_loader(const std::vector<std::string>& filenames,
+    uint32_t num_threads, uint32_t prefetch) :
+        m_filenames{filenames}, m_slots{}, m_next_decode{0}, m_next_output{0},
+        m_stop{false}
+{
+    if(num_threads == 0) {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    num_threads = std::min(num_threads, uint32_t(std::max(m_filenames.size(), size_t(1))));
+    if(prefetch == 0) {
+        prefetch = 2 * num_threads;
+    }
+    // At least one slot per thread, otherwise idle threads.
+    m_slots.resize(std::max(prefetch, num_threads));
+    for(auto&& s : m_slots) {
+        s.index = 0;
+        s.ready = false;
+    }
+    for(uint32_t i = 0 ; i < num_threads ; ++i) {
+        m_threads.emplace_back(&cpu_image_loader::run, this);
+    }
+}
+cpu_image_loader::~cpu_image_loader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_consumed.notify_all();
+    for(auto&& t : m_threads) {
+        t.join();
+    }
+}
+
+bool cpu_image_loader::next(cpu_image& image)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if(m_next_output >= m_filenames.size()) {
+        return false;
+    }
+    slot& s = m_slots[m_next_output % m_slots.size()];
+    m_decoded.wait(lock, [this, &s] { return s.ready && s.index == m_next_output; });
+    std::swap(image, s.image);
+    s.ready = false;
+    m_next_output++;
+    lock.unlock();
+    m_consumed.notify_all();
+    return true;
+}
+
+void cpu_image_loader::run()
+{
+    const size_t num_slots = m_slots.size();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(true) {
+        // Next file, if its slot has been consumed.
+        m_consumed.wait(lock, [this, num_slots] {
+            return m_stop || m_next_decode >= m_filenames.size() ||
+                m_next_decode < m_next_output + num_slots;
+        });
+        if(m_stop || m_next_decode >= m_filenames.size()) {
+            return;
+        }
+        const size_t idx = m_next_decode++;
+        slot& s = m_slots[idx % num_slots];
+        lock.unlock();
+        // Decoding without lock: the slot is owned by this thread until ready.
+        cpu_decode_image(m_filenames[idx], s.image);
+        lock.lock();
+        s.index = idx;
+        s.ready = true;
+        m_decoded.notify_all();
+    }
+}
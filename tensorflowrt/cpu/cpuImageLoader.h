@@ -0,0 +1,130 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_IMAGE_LOADER_H
+#define TFRT_CPU_IMAGE_LOADER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* ============================================================================
+ * Image decoding (JPEG / PNG, system libjpeg(-turbo) and libpng).
+ * ========================================================================== */
+/** Decoded image: RGBA uint8 pixels (alpha 255 if none), rows of width * 4
+ * bytes. The buffer capacity is kept between decodings, i.e. an image re-used
+ * for images of the same size or smaller does not allocate.
+ */
+struct cpu_image
+{
+    std::string  filename;
+    uint32_t  width;
+    uint32_t  height;
+    std::vector<uint8_t>  data;
+
+public:
+    cpu_image() : filename{}, width{0}, height{0}, data{} {}
+    size_t pitch() const {
+        return size_t(width) * 4;
+    }
+    /** Successfully decoded? */
+    bool valid() const {
+        return width > 0 && height > 0;
+    }
+};
+
+/** Decode a JPEG or PNG file (format from the file signature) directly into a
+ * RGBA uint8 image, re-using its buffer. Grayscale, palette and 16 bits
+ * inputs are converted to RGBA (CMYK JPEGs are not supported). Return false if
+ * the file can not be read or is not a valid JPEG / PNG image (empty image).
+ */
+bool cpu_decode_image(const std::string& filename, cpu_image& image);
+
+/** Sorted full paths of the JPEG / PNG images of a directory (extension
+ * .jpg, .jpeg or .png, any case). Return false if the directory can not be
+ * opened.
+ */
+bool cpu_list_images(const std::string& dirname, std::vector<std::string>& filenames);
+
+/** RGBA uint8 to RGBA float (float4 layout), e.g. for the jetson-inference
+ * style float4 network inputs. Output of width * height * 4 floats.
+ */
+bool cpu_image_to_rgba_float(const cpu_image& image, float* output);
+
+/* ============================================================================
+ * Prefetching images loader.
+ * ========================================================================== */
+/** Decodes a list of image files with a pool of threads, ahead of the
+ * consumer: up to `prefetch` images are decoded in advance, in a ring of
+ * pre-allocated images. Images are returned in the order of the list.
+ * next() swaps the buffers of the caller image and of the decoded one: the
+ * previous buffer of the caller goes back to the ring, so that a steady state
+ * loop does not allocate memory.
+ */
+class cpu_image_loader
+{
+public:
+    /** Start decoding. num_threads = 0: hardware concurrency; prefetch = 0:
+     * twice the number of threads.
+     */
+    cpu_image_loader(const std::vector<std::string>& filenames,
+        uint32_t num_threads=0, uint32_t prefetch=0);
+    ~cpu_image_loader();
+
+    /** Next image in the list, blocking until decoded. Decoding errors give
+     * an invalid image (see cpu_image::valid), with its filename. Return
+     * false at the end of the list.
+     */
+    bool next(cpu_image& image);
+    /** Number of images in the list. */
+    size_t size() const {
+        return m_filenames.size();
+    }
+    /** Number of decoding threads. */
+    size_t num_threads() const {
+        return m_threads.size();
+    }
+
+private:
+    void run();
+
+private:
+    cpu_image_loader(const cpu_image_loader&) = delete;
+    cpu_image_loader& operator=(const cpu_image_loader&) = delete;
+
+private:
+    /** Ring slot: image of index i in slot i % #slots. */
+    struct slot
+    {
+        cpu_image  image;
+        size_t  index;
+        bool  ready;
+    };
+    std::vector<std::string>  m_filenames;
+    std::vector<slot>  m_slots;
+    // Next file to decode, next image returned.
+    size_t  m_next_decode;
+    size_t  m_next_output;
+    bool  m_stop;
+    std::mutex  m_mutex;
+    std::condition_variable  m_decoded;
+    std::condition_variable  m_consumed;
+    std::vector<std::thread>  m_threads;
+};
+
+#endif
@@ -0,0 +1,219 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <vector>
+
+#include "cpuSIMD.h"
+#include "cpuOverlay.h"
+
+namespace
+{
+/* ============================================================================
+ * RGBX blending, 4 pixels at a time (see tfrt::overlay_blend).
+ * ========================================================================== */
+/** Packed colour and alpha of a pixel: X channel colour 0, alpha 0, i.e. the
+ * X channel is kept by the blending.
+ */
+inline uint32_t pack_color(tfrt::overlay_color c)
+{
+    return uint32_t(c.r) | (uint32_t(c.g) << 8) | (uint32_t(c.b) << 16);
+}
+inline uint32_t pack_alpha(tfrt::overlay_color c)
+{
+    return uint32_t(c.a) * 0x010101u;
+}
+
+#if defined(TFRT_SIMD_SSE2)
+/** Blending of 8 uint16 lanes. */
+inline __m128i blend_lanes(__m128i p, __m128i c, __m128i a)
+{
+    const __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+    __m128i v = _mm_add_epi16(_mm_mullo_epi16(p, ia), _mm_mullo_epi16(c, a));
+    v = _mm_add_epi16(v, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), 8);
+}
+/** Blending of 4 RGBX pixels, with per-pixel packed colours and alphas. */
+inline void blend_rgbx4(uint8_t* px, __m128i c, __m128i a)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i p = _mm_loadu_si128((const __m128i*)px);
+    const __m128i lo = blend_lanes(_mm_unpacklo_epi8(p, zero), _mm_unpacklo_epi8(c, zero),
+        _mm_unpacklo_epi8(a, zero));
+    const __m128i hi = blend_lanes(_mm_unpackhi_epi8(p, zero), _mm_unpackhi_epi8(c, zero),
+        _mm_unpackhi_epi8(a, zero));
+    _mm_storeu_si128((__m128i*)px, _mm_packus_epi16(lo, hi));
+}
+inline void blend_rgbx4(uint8_t* px, const uint32_t* colors, const uint32_t* alphas)
+{
+    blend_rgbx4(px, _mm_loadu_si128((const __m128i*)colors),
+        _mm_loadu_si128((const __m128i*)alphas));
+}
+inline void blend_rgbx_span(uint8_t* px, int n, uint32_t color, uint32_t alpha)
+{
+    const __m128i c = _mm_set1_epi32(int(color));
+    const __m128i a = _mm_set1_epi32(int(alpha));
+    for(int i = 0 ; i < n ; ++i) {
+        blend_rgbx4(px + 16*i, c, a);
+    }
+}
+
+#elif defined(TFRT_SIMD_NEON)
+/** Blending of 8 uint8 lanes, widened to uint16. */
+inline uint8x8_t blend_lanes(uint8x8_t p, uint8x8_t c, uint8x8_t a)
+{
+    uint16x8_t v = vmlal_u8(vmull_u8(p, vmvn_u8(a)), c, a);
+    v = vaddq_u16(v, vdupq_n_u16(128));
+    return vshrn_n_u16(vsraq_n_u16(v, v, 8), 8);
+}
+inline void blend_rgbx4(uint8_t* px, uint8x16_t c, uint8x16_t a)
+{
+    const uint8x16_t p = vld1q_u8(px);
+    vst1q_u8(px, vcombine_u8(
+        blend_lanes(vget_low_u8(p), vget_low_u8(c), vget_low_u8(a)),
+        blend_lanes(vget_high_u8(p), vget_high_u8(c), vget_high_u8(a))));
+}
+inline void blend_rgbx4(uint8_t* px, const uint32_t* colors, const uint32_t* alphas)
+{
+    blend_rgbx4(px, vreinterpretq_u8_u32(vld1q_u32(colors)),
+        vreinterpretq_u8_u32(vld1q_u32(alphas)));
+}
+inline void blend_rgbx_span(uint8_t* px, int n, uint32_t color, uint32_t alpha)
+{
+    const uint8x16_t c = vreinterpretq_u8_u32(vdupq_n_u32(color));
+    const uint8x16_t a = vreinterpretq_u8_u32(vdupq_n_u32(alpha));
+    for(int i = 0 ; i < n ; ++i) {
+        blend_rgbx4(px + 16*i, c, a);
+    }
+}
+
+#else
+inline void blend_rgbx4(uint8_t* px, const uint32_t* colors, const uint32_t* alphas)
+{
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int k = 0 ; k < 3 ; ++k) {
+            px[4*i+k] = tfrt::overlay_blend(px[4*i+k], uint8_t(colors[i] >> (8*k)), uint8_t(alphas[i]));
+        }
+    }
+}
+inline void blend_rgbx_span(uint8_t* px, int n, uint32_t color, uint32_t alpha)
+{
+    const uint32_t colors[4] = {color, color, color, color};
+    const uint32_t alphas[4] = {alpha, alpha, alpha, alpha};
+    for(int i = 0 ; i < n ; ++i) {
+        blend_rgbx4(px + 16*i, colors, alphas);
+    }
+}
+#endif
+
+/** Scalar blending of a RGB(X) pixel. */
+inline void blend_pixel(uint8_t* px, tfrt::overlay_color c)
+{
+    px[0] = tfrt::overlay_blend(px[0], c.r, c.a);
+    px[1] = tfrt::overlay_blend(px[1], c.g, c.a);
+    px[2] = tfrt::overlay_blend(px[2], c.b, c.a);
+}
+}
+
+/* ============================================================================
+ * Spans overlay.
+ * ========================================================================== */
+bool cpu_overlay_spans(uint8_t* img, uint32_t img_width, uint32_t img_height,
+    uint32_t img_stride_x, uint32_t img_stride_y, const tfrt::overlay_spans& spans)
+{
+    if(!img || img_width == 0 || img_height == 0 || img_stride_x < 3 || img_stride_y == 0) {
+        return false;
+    }
+    if(spans.width() != int(img_width) || spans.height() != int(img_height) ||
+        spans.offsets().size() != img_height + 1) {
+        return false;
+    }
+    const int32_t* offsets = spans.offsets().data();
+    const tfrt::overlay_span* pspans = spans.spans().data();
+    const bool rgbx = (img_stride_x == 4);
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < int(img_height) ; ++y) {
+        uint8_t* row = img + size_t(y) * img_stride_y;
+        for(int32_t s = offsets[y] ; s < offsets[y+1] ; ++s) {
+            const tfrt::overlay_span& span = pspans[s];
+            int x = span.x0;
+            if(rgbx) {
+                const int n = (span.x1 - x) / 4;
+                blend_rgbx_span(row + 4*x, n, pack_color(span.color), pack_alpha(span.color));
+                x += 4 * n;
+            }
+            for( ; x < span.x1 ; ++x) {
+                blend_pixel(row + x * img_stride_x, span.color);
+            }
+        }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * Segmentation overlay.
+ * ========================================================================== */
+bool cpu_seg_overlay(uint8_t* img, const uint8_t* mask,
+    uint32_t img_width, uint32_t img_height,
+    uint32_t img_stride_x, uint32_t img_stride_y,
+    uint32_t mask_width, uint32_t mask_height,
+    uint32_t mask_stride_x, uint32_t mask_stride_y, const tfrt::overlay_lut& lut)
+{
+    if(!img || !mask) {
+        return false;
+    }
+    if(img_width == 0 || img_height == 0 || img_stride_x < 3 || img_stride_y == 0) {
+        return false;
+    }
+    if(mask_width == 0 || mask_height == 0 || mask_stride_x == 0 || mask_stride_y == 0) {
+        return false;
+    }
+    // Mask sampling: same float scaling as the CUDA kernel.
+    const float scale_x = float(mask_width) / float(img_width);
+    const float scale_y = float(mask_height) / float(img_height);
+    std::vector<int32_t> mxs(img_width);
+    for(uint32_t x = 0 ; x < img_width ; ++x) {
+        const int mx = std::max(std::min(int(float(x) * scale_x), int(mask_width) - 1), 0);
+        mxs[x] = mx * mask_stride_x;
+    }
+    // Packed LUT.
+    uint32_t colors[256], alphas[256];
+    for(int i = 0 ; i < 256 ; ++i) {
+        colors[i] = pack_color(lut.colors[i]);
+        alphas[i] = pack_alpha(lut.colors[i]);
+    }
+    const bool rgbx = (img_stride_x == 4);
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < int(img_height) ; ++y) {
+        const int my = std::max(std::min(int(float(y) * scale_y), int(mask_height) - 1), 0);
+        const uint8_t* mrow = mask + size_t(my) * mask_stride_y;
+        uint8_t* row = img + size_t(y) * img_stride_y;
+        int x = 0;
+        if(rgbx) {
+            alignas(16) uint32_t pc[4], pa[4];
+            for( ; x + 4 <= int(img_width) ; x += 4) {
+                for(int i = 0 ; i < 4 ; ++i) {
+                    const uint8_t m = mrow[mxs[x+i]];
+                    pc[i] = colors[m];
+                    pa[i] = alphas[m];
+                }
+                blend_rgbx4(row + 4*x, pc, pa);
+            }
+        }
+        for( ; x < int(img_width) ; ++x) {
+            blend_pixel(row + x * img_stride_x, lut.colors[mrow[mxs[x]]]);
+        }
+    }
+    return true;
+}
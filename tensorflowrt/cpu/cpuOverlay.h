@@ -0,0 +1,45 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_OVERLAY_H
+#define TFRT_CPU_OVERLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include "../misc/overlay.h"
+
+/* ============================================================================
+ * Host overlay drawing, mirroring cuda/cudaOverlay.h.
+ * ========================================================================== */
+/** Blend overlay spans (see tfrt::overlay_spans) in place on an uint8 RGB(X)
+ * image, in drawing order. Only the pixels covered by spans are touched, and
+ * the X channel is kept. Integer blending (tfrt::overlay_blend), vectorized
+ * (SSE2 / NEON) on RGBX images and parallelized by rows. Bitwise identical to
+ * cuda_overlay_spans. Return false on invalid inputs.
+ */
+bool cpu_overlay_spans(uint8_t* img, uint32_t img_width, uint32_t img_height,
+    uint32_t img_stride_x, uint32_t img_stride_y, const tfrt::overlay_spans& spans);
+
+/** Overlay a segmentation mask on an uint8 RGB(X) image, in place: nearest
+ * neighbour upscaling of the mask (same sampling as cuda_seg_overlay) and
+ * blending with the LUT colour of every class. Vectorized on RGBX images and
+ * parallelized by rows. Bitwise identical to cuda_seg_overlay.
+ */
+bool cpu_seg_overlay(uint8_t* img, const uint8_t* mask,
+    uint32_t img_width, uint32_t img_height,
+    uint32_t img_stride_x, uint32_t img_stride_y,
+    uint32_t mask_width, uint32_t mask_height,
+    uint32_t mask_stride_x, uint32_t mask_stride_y, const tfrt::overlay_lut& lut);
+
+#endif
@@ -0,0 +1,313 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+/* Minimal 4-lanes float SIMD wrapper, used by the host (CPU) kernels.
+ * SSE2 on x86-64, NEON on Jetson (aarch64), plain scalar code otherwise.
+ */
+#ifndef TFRT_CPU_SIMD_H
+#define TFRT_CPU_SIMD_H
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+#define TFRT_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define TFRT_SIMD_NEON
+#endif
+
+namespace tfrt
+{
+namespace simd
+{
+/** Number of float lanes. */
+static const int kFloatLanes = 4;
+
+/** Float to IEEE half conversion, round to nearest even (as __float2half_rn).
+ * Overflows to infinity, NaNs stay NaNs.
+ */
+inline uint16_t float_to_half(float f)
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    const uint16_t sign = (x >> 16) & 0x8000;
+    x &= 0x7fffffff;
+    if(x >= 0x7f800000) {
+        return sign | 0x7c00 | (x > 0x7f800000 ? 0x200 : 0);
+    }
+    // >= 65520: rounded to infinity.
+    if(x >= 0x477ff000) {
+        return sign | 0x7c00;
+    }
+    // Subnormal half (< 2^-14).
+    if(x < 0x38800000) {
+        if(x <= 0x33000000) {
+            return sign;
+        }
+        const uint32_t shift = 126 - (x >> 23);
+        const uint32_t m = (x & 0x7fffff) | 0x800000;
+        uint32_t h = m >> shift;
+        const uint32_t rem = m & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        h += (rem > halfway || (rem == halfway && (h & 1)));
+        return sign | h;
+    }
+    // Normal: re-bias the exponent and round the mantissa (carry is fine).
+    uint32_t h = (x - 0x38000000) >> 13;
+    const uint32_t rem = x & 0x1fff;
+    h += (rem > 0x1000 || (rem == 0x1000 && (h & 1)));
+    return sign | h;
+}
+
+/** IEEE half to float conversion (exact), subnormals, infinities and NaNs included.
+ */
+inline float half_to_float(uint16_t h)
+{
+    const uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t e = (h >> 10) & 0x1f;
+    uint32_t m = h & 0x3ff;
+    uint32_t x;
+    if(e == 0x1f) {
+        x = sign | 0x7f800000 | (m << 13);
+    }
+    else if(e) {
+        x = sign | ((e + 112) << 23) | (m << 13);
+    }
+    else if(m) {
+        // Subnormal half: normalize the mantissa.
+        e = 113;
+        while(!(m & 0x400)) {
+            m <<= 1;
+            e--;
+        }
+        x = sign | (e << 23) | ((m & 0x3ff) << 13);
+    }
+    else {
+        x = sign;
+    }
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+#if defined(TFRT_SIMD_SSE2)
+/* ============================================================================
+ * SSE2 implementation.
+ * ========================================================================== */
+typedef __m128  f32x4;
+typedef __m128  m32x4;
+
+inline f32x4 load(const float* p) {  return _mm_loadu_ps(p);  }
+inline void store(float* p, f32x4 v) {  _mm_storeu_ps(p, v);  }
+inline f32x4 set1(float v) {  return _mm_set1_ps(v);  }
+inline f32x4 set(float v0, float v1, float v2, float v3) {  return _mm_setr_ps(v0, v1, v2, v3);  }
+/** Load 4 int16 values, converted to float. */
+inline f32x4 load_i16(const int16_t* p) {
+    const __m128i v = _mm_loadl_epi64((const __m128i*)p);
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+}
+
+inline f32x4 add(f32x4 a, f32x4 b) {  return _mm_add_ps(a, b);  }
+inline f32x4 sub(f32x4 a, f32x4 b) {  return _mm_sub_ps(a, b);  }
+inline f32x4 mul(f32x4 a, f32x4 b) {  return _mm_mul_ps(a, b);  }
+inline f32x4 div(f32x4 a, f32x4 b) {  return _mm_div_ps(a, b);  }
+inline f32x4 max(f32x4 a, f32x4 b) {  return _mm_max_ps(a, b);  }
+inline f32x4 min(f32x4 a, f32x4 b) {  return _mm_min_ps(a, b);  }
+/** a * b + c. Not fused: keep the same rounding as scalar code. */
+inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) {  return _mm_add_ps(_mm_mul_ps(a, b), c);  }
+
+/** Store 4 floats as half precision (round to nearest even). */
+#if defined(__F16C__)
+inline void store_half(uint16_t* p, f32x4 v) {
+    _mm_storel_epi64((__m128i*)p, _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+}
+/** Load 4 half precision values, converted to float. */
+inline f32x4 load_half(const uint16_t* p) {
+    return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)p));
+}
+#else
+inline void store_half(uint16_t* p, f32x4 v) {
+    float f[4];
+    _mm_storeu_ps(f, v);
+    for(int i = 0 ; i < 4 ; ++i) {  p[i] = float_to_half(f[i]);  }
+}
+inline f32x4 load_half(const uint16_t* p) {
+    return _mm_setr_ps(half_to_float(p[0]), half_to_float(p[1]),
+        half_to_float(p[2]), half_to_float(p[3]));
+}
+#endif
+
+inline m32x4 cmpgt(f32x4 a, f32x4 b) {  return _mm_cmpgt_ps(a, b);  }
+/** Lane-wise: mask ? a : b */
+inline f32x4 select(m32x4 mask, f32x4 a, f32x4 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/** Fixed-point weighted sum of int16 rows: sum_k rows[k][offset:offset+4] * weights[k],
+ * accumulated exactly in int32 and converted to float. Pairs of rows are
+ * interleaved and reduced with _mm_madd_epi16.
+ */
+inline f32x4 weighted_sum_i16(const int16_t* const* rows, const int16_t* weights,
+    int count, int offset)
+{
+    __m128i acc = _mm_setzero_si128();
+    int k = 0;
+    for( ; k + 1 < count ; k += 2) {
+        const __m128i a = _mm_loadl_epi64((const __m128i*)(rows[k] + offset));
+        const __m128i b = _mm_loadl_epi64((const __m128i*)(rows[k+1] + offset));
+        const __m128i w = _mm_set1_epi32(int(uint16_t(weights[k])) | (int(weights[k+1]) << 16));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+    }
+    if(k < count) {
+        const __m128i a = _mm_loadl_epi64((const __m128i*)(rows[k] + offset));
+        const __m128i w = _mm_set1_epi32(int(uint16_t(weights[k])));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(a, _mm_setzero_si128()), w));
+    }
+    return _mm_cvtepi32_ps(acc);
+}
+
+#elif defined(TFRT_SIMD_NEON)
+/* ============================================================================
+ * NEON implementation.
+ * ========================================================================== */
+typedef float32x4_t  f32x4;
+typedef uint32x4_t  m32x4;
+
+inline f32x4 load(const float* p) {  return vld1q_f32(p);  }
+inline void store(float* p, f32x4 v) {  vst1q_f32(p, v);  }
+inline f32x4 set1(float v) {  return vdupq_n_f32(v);  }
+inline f32x4 set(float v0, float v1, float v2, float v3) {
+    const float v[4] = {v0, v1, v2, v3};
+    return vld1q_f32(v);
+}
+inline f32x4 load_i16(const int16_t* p) {  return vcvtq_f32_s32(vmovl_s16(vld1_s16(p)));  }
+
+inline f32x4 add(f32x4 a, f32x4 b) {  return vaddq_f32(a, b);  }
+inline f32x4 sub(f32x4 a, f32x4 b) {  return vsubq_f32(a, b);  }
+inline f32x4 mul(f32x4 a, f32x4 b) {  return vmulq_f32(a, b);  }
+#if defined(__aarch64__)
+inline f32x4 div(f32x4 a, f32x4 b) {  return vdivq_f32(a, b);  }
+#else
+inline f32x4 div(f32x4 a, f32x4 b) {
+    float va[4], vb[4];
+    vst1q_f32(va, a);  vst1q_f32(vb, b);
+    for(int i = 0 ; i < 4 ; ++i) {  va[i] /= vb[i];  }
+    return vld1q_f32(va);
+}
+#endif
+inline f32x4 max(f32x4 a, f32x4 b) {  return vmaxq_f32(a, b);  }
+inline f32x4 min(f32x4 a, f32x4 b) {  return vminq_f32(a, b);  }
+inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) {  return vaddq_f32(vmulq_f32(a, b), c);  }
+
+#if defined(__aarch64__)
+inline void store_half(uint16_t* p, f32x4 v) {
+    vst1_u16(p, vreinterpret_u16_f16(vcvt_f16_f32(v)));
+}
+inline f32x4 load_half(const uint16_t* p) {
+    return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(p)));
+}
+#else
+inline void store_half(uint16_t* p, f32x4 v) {
+    float f[4];
+    vst1q_f32(f, v);
+    for(int i = 0 ; i < 4 ; ++i) {  p[i] = float_to_half(f[i]);  }
+}
+inline f32x4 load_half(const uint16_t* p) {
+    const float f[4] = {half_to_float(p[0]), half_to_float(p[1]),
+        half_to_float(p[2]), half_to_float(p[3])};
+    return vld1q_f32(f);
+}
+#endif
+
+inline m32x4 cmpgt(f32x4 a, f32x4 b) {  return vcgtq_f32(a, b);  }
+inline f32x4 select(m32x4 mask, f32x4 a, f32x4 b) {  return vbslq_f32(mask, a, b);  }
+
+inline f32x4 weighted_sum_i16(const int16_t* const* rows, const int16_t* weights,
+    int count, int offset)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+    for(int k = 0 ; k < count ; ++k) {
+        acc = vmlal_n_s16(acc, vld1_s16(rows[k] + offset), weights[k]);
+    }
+    return vcvtq_f32_s32(acc);
+}
+
+#else
+/* ============================================================================
+ * Scalar fallback.
+ * ========================================================================== */
+struct f32x4 {  float v[4];  };
+struct m32x4 {  bool v[4];  };
+
+inline f32x4 load(const float* p) {  return f32x4{{p[0], p[1], p[2], p[3]}};  }
+inline void store(float* p, f32x4 a) {  for(int i = 0 ; i < 4 ; ++i) {  p[i] = a.v[i];  }  }
+inline f32x4 set1(float v) {  return f32x4{{v, v, v, v}};  }
+inline f32x4 set(float v0, float v1, float v2, float v3) {  return f32x4{{v0, v1, v2, v3}};  }
+inline f32x4 load_i16(const int16_t* p) {
+    return f32x4{{float(p[0]), float(p[1]), float(p[2]), float(p[3])}};
+}
+
+#define TFRT_SIMD_SCALAR_OP(name, expr)                         \
+inline f32x4 name(f32x4 a, f32x4 b) {                           \
+    f32x4 r;                                                    \
+    for(int i = 0 ; i < 4 ; ++i) {  r.v[i] = (expr);  }         \
+    return r;                                                   \
+}
+TFRT_SIMD_SCALAR_OP(add, a.v[i] + b.v[i])
+TFRT_SIMD_SCALAR_OP(sub, a.v[i] - b.v[i])
+TFRT_SIMD_SCALAR_OP(mul, a.v[i] * b.v[i])
+TFRT_SIMD_SCALAR_OP(div, a.v[i] / b.v[i])
+TFRT_SIMD_SCALAR_OP(max, a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+TFRT_SIMD_SCALAR_OP(min, a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+#undef TFRT_SIMD_SCALAR_OP
+inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) {  return add(mul(a, b), c);  }
+inline void store_half(uint16_t* p, f32x4 a) {
+    for(int i = 0 ; i < 4 ; ++i) {  p[i] = float_to_half(a.v[i]);  }
+}
+inline f32x4 load_half(const uint16_t* p) {
+    return f32x4{{half_to_float(p[0]), half_to_float(p[1]), half_to_float(p[2]), half_to_float(p[3])}};
+}
+
+inline m32x4 cmpgt(f32x4 a, f32x4 b) {
+    m32x4 r;
+    for(int i = 0 ; i < 4 ; ++i) {  r.v[i] = a.v[i] > b.v[i];  }
+    return r;
+}
+inline f32x4 select(m32x4 mask, f32x4 a, f32x4 b) {
+    f32x4 r;
+    for(int i = 0 ; i < 4 ; ++i) {  r.v[i] = mask.v[i] ? a.v[i] : b.v[i];  }
+    return r;
+}
+inline f32x4 weighted_sum_i16(const int16_t* const* rows, const int16_t* weights,
+    int count, int offset)
+{
+    f32x4 r;
+    for(int i = 0 ; i < 4 ; ++i) {
+        int32_t acc = 0;
+        for(int k = 0 ; k < count ; ++k) {  acc += int32_t(rows[k][offset + i]) * weights[k];  }
+        r.v[i] = float(acc);
+    }
+    return r;
+}
+#endif
+
+}
+}
+
+#endif
@@ -0,0 +1,286 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cmath>
+
+#include "cpuSIMD.h"
+#include "cpuSegmentation.h"
+
+namespace
+{
+/** Width of the tiles processed at once: the running max and argmax of a tile
+ * stay in L1 while streaming the channels. Multiple of SIMD lanes.
+ */
+const int kTileWidth = 64;
+
+/** Argmax over channels of a row tile. Channels are streamed contiguously,
+ * keeping a running max / argmax per pixel (argmax stored as float lanes).
+ */
+inline void argmax_tile(const float* prob, int channel_stride, int num_classes,
+    int width, float* max_score, float* max_idx)
+{
+    using namespace tfrt::simd;
+    const int width_simd = width - width % kFloatLanes;
+    // Original semantics: start at zero, strict comparison.
+    for(int x = 0 ; x < width ; ++x) {
+        max_score[x] = 0.0f;
+        max_idx[x] = 0.0f;
+    }
+    for(int k = 0 ; k < num_classes ; ++k) {
+        const float* p = prob + k * channel_stride;
+        const f32x4 vk = set1(float(k));
+        int x = 0;
+        for( ; x < width_simd ; x += kFloatLanes) {
+            const f32x4 v = load(p + x);
+            const f32x4 vmax = load(max_score + x);
+            const m32x4 m = cmpgt(v, vmax);
+            store(max_score + x, select(m, v, vmax));
+            store(max_idx + x, select(m, vk, load(max_idx + x)));
+        }
+        for( ; x < width ; ++x) {
+            if(p[x] > max_score[x]) {
+                max_score[x] = p[x];
+                max_idx[x] = float(k);
+            }
+        }
+    }
+}
+
+/** Source indexes of a row tile [x0, x0+tw) after the transformation matrix
+ * (column major, double precision), -1 if outside the image. (x+0.5)*m are
+ * exact products in double, hence the steps x*m from the tile origin as well:
+ * same rounding as the CUDA kernels, and no dependency between pixels.
+ */
+inline void warp_tile(const double* m, int x0, int y, int tw, int width, int height,
+    int* src_idx)
+{
+    const double ax[3] = { (x0+0.5) * m[0], (x0+0.5) * m[1], (x0+0.5) * m[2] };
+    const double by[3] = { (y+0.5) * m[3], (y+0.5) * m[4], (y+0.5) * m[5] };
+    for(int x = 0 ; x < tw ; ++x) {
+        const float tx_f = (ax[0] + x * m[0]) + by[0] + m[6];
+        const float ty_f = (ax[1] + x * m[1]) + by[1] + m[7];
+        const float tz_f = (ax[2] + x * m[2]) + by[2] + m[8];
+        // Range check in float: no integer overflow far outside the image.
+        const float tx = std::floor(tx_f / tz_f);
+        const float ty = std::floor(ty_f / tz_f);
+        const bool inside = (tx >= 0.0f && tx < width && ty >= 0.0f && ty < height);
+        src_idx[x] = inside ? (int(ty) * width + int(tx)) : -1;
+    }
+}
+}
+
+bool cpu_seg_argmax(
+    const float* raw_prob, uint8_t* classes, float* scores,
+    uint32_t batch_size, uint32_t seg_width, uint32_t seg_height, uint32_t num_classes,
+    bool empty_class, float threshold)
+{
+    if( !raw_prob || !classes || !scores ) {
+        return false;
+    }
+    if( seg_width == 0 || seg_height == 0 || num_classes == 0 || num_classes > 256 ) {
+        return false;
+    }
+    const int width = seg_width;
+    const int height = seg_height;
+    const int channel_stride = width * height;
+    const int drift = !empty_class;
+    const int num_rows = batch_size * seg_height;
+
+    // Every (batch, row) pair is independent.
+    #pragma omp parallel for schedule(static)
+    for(int r = 0 ; r < num_rows ; ++r) {
+        const int n = r / height;
+        const int y = r % height;
+        const float* prob = raw_prob + long(n) * num_classes * channel_stride + y * width;
+        uint8_t* cls = classes + long(n) * channel_stride + y * width;
+        float* scr = scores + long(n) * channel_stride + y * width;
+
+        float max_idx[kTileWidth];
+        for(int x0 = 0 ; x0 < width ; x0 += kTileWidth) {
+            const int tw = (width - x0 < kTileWidth) ? (width - x0) : kTileWidth;
+            // Scores directly written in the output row.
+            argmax_tile(prob + x0, channel_stride, num_classes, tw, scr + x0, max_idx);
+            // Single write of the classes.
+            for(int x = 0 ; x < tw ; ++x) {
+                cls[x0 + x] = (scr[x0 + x] > threshold) ? uint8_t(int(max_idx[x]) + drift) : 0;
+            }
+        }
+    }
+    return true;
+}
+
+bool cpu_seg_post_process(
+    const float* raw_prob, uint8_t* classes, float* scores, const float* tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes,
+    bool empty_class, float threshold)
+{
+    if( !raw_prob || !classes || !scores || !tr_matrix ) {
+        return false;
+    }
+    if( seg_width == 0 || seg_height == 0 || num_classes == 0 || num_classes > 256 ) {
+        return false;
+    }
+    const int width = seg_width;
+    const int height = seg_height;
+    const int channel_stride = width * height;
+    const int drift = !empty_class;
+    // Column major matrix, as in the CUDA kernel.
+    const double m[9] = {
+        tr_matrix[0], tr_matrix[1], tr_matrix[2],
+        tr_matrix[3], tr_matrix[4], tr_matrix[5],
+        tr_matrix[6], tr_matrix[7], tr_matrix[8] };
+
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < height ; ++y) {
+        uint8_t* cls = classes + y * width;
+        float* scr = scores + y * width;
+        int src_idx[kTileWidth];
+        float max_score[kTileWidth];
+        int max_idx[kTileWidth];
+        float max_idx_f[kTileWidth];
+        for(int x0 = 0 ; x0 < width ; x0 += kTileWidth) {
+            const int tw = (width - x0 < kTileWidth) ? (width - x0) : kTileWidth;
+            warp_tile(m, x0, y, tw, width, height, src_idx);
+            // Tile mapped on a contiguous source row (identity, integer
+            // translations): SIMD argmax on the CHW rows, as cpu_seg_argmax.
+            bool contiguous = src_idx[0] >= 0;
+            for(int x = 1 ; x < tw && contiguous ; ++x) {
+                contiguous = (src_idx[x] == src_idx[0] + x);
+            }
+            if(contiguous) {
+                argmax_tile(raw_prob + src_idx[0], channel_stride, num_classes, tw,
+                    scr + x0, max_idx_f);
+                for(int x = 0 ; x < tw ; ++x) {
+                    cls[x0 + x] = (scr[x0 + x] > threshold) ? uint8_t(int(max_idx_f[x]) + drift) : 0;
+                }
+                continue;
+            }
+            // Gathered argmax, channels streamed in the outer loop.
+            for(int x = 0 ; x < tw ; ++x) {
+                max_score[x] = 0.0f;
+                max_idx[x] = 0;
+            }
+            for(int k = 0 ; k < int(num_classes) ; ++k) {
+                const float* p = raw_prob + k * channel_stride;
+                for(int x = 0 ; x < tw ; ++x) {
+                    const float v = (src_idx[x] >= 0) ? p[src_idx[x]] : 0.0f;
+                    const bool gt = v > max_score[x];
+                    max_score[x] = gt ? v : max_score[x];
+                    max_idx[x] = gt ? k : max_idx[x];
+                }
+            }
+            for(int x = 0 ; x < tw ; ++x) {
+                if(src_idx[x] < 0) {
+                    cls[x0 + x] = 0;
+                    scr[x0 + x] = 1.0f;
+                }
+                else {
+                    cls[x0 + x] = (max_score[x] > threshold) ? uint8_t(max_idx[x] + drift) : 0;
+                    scr[x0 + x] = max_score[x];
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool cpu_seg_fusion(
+    const float* raw_prob, const float* prev_prob, float* fused_prob, const float* tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes, float alpha)
+{
+    if( !prev_prob || !fused_prob || !tr_matrix ) {
+        return false;
+    }
+    if( prev_prob == fused_prob || raw_prob == fused_prob ) {
+        return false;
+    }
+    if( seg_width == 0 || seg_height == 0 || num_classes == 0 ) {
+        return false;
+    }
+    const int width = seg_width;
+    const int height = seg_height;
+    const int channel_stride = width * height;
+    const float beta = 1.0f - alpha;
+    const double m[9] = {
+        tr_matrix[0], tr_matrix[1], tr_matrix[2],
+        tr_matrix[3], tr_matrix[4], tr_matrix[5],
+        tr_matrix[6], tr_matrix[7], tr_matrix[8] };
+
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < height ; ++y) {
+        int src_idx[kTileWidth];
+        for(int x0 = 0 ; x0 < width ; x0 += kTileWidth) {
+            const int tw = (width - x0 < kTileWidth) ? (width - x0) : kTileWidth;
+            warp_tile(m, x0, y, tw, width, height, src_idx);
+            const int d_idx = y * width + x0;
+            for(int k = 0 ; k < int(num_classes) ; ++k) {
+                const float* prev = prev_prob + k * channel_stride;
+                float* fused = fused_prob + k * channel_stride + d_idx;
+                if(!raw_prob) {
+                    for(int x = 0 ; x < tw ; ++x) {
+                        fused[x] = (src_idx[x] >= 0) ? prev[src_idx[x]] : 0.0f;
+                    }
+                    continue;
+                }
+                const float* raw = raw_prob + k * channel_stride + d_idx;
+                for(int x = 0 ; x < tw ; ++x) {
+                    fused[x] = (src_idx[x] >= 0) ? alpha * raw[x] + beta * prev[src_idx[x]] : raw[x];
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool cpu_seg_stitch_tiles(
+    const float* tiles_prob, float* map_prob, const tfrt::tile_grid& grid,
+    uint32_t out_width, uint32_t out_height, uint32_t num_classes)
+{
+    if( !tiles_prob || !map_prob || grid.rois.empty() ) {
+        return false;
+    }
+    if( out_width == 0 || out_height == 0 || num_classes == 0 ) {
+        return false;
+    }
+    const int mwidth = grid.map_width;
+    const int mheight = grid.map_height;
+    const long channel_stride = long(out_width) * out_height;
+    const long tile_stride = channel_stride * num_classes;
+    const int num_rows = num_classes * mheight;
+
+    // Every (channel, row) pair is independent.
+    #pragma omp parallel for schedule(static)
+    for(int r = 0 ; r < num_rows ; ++r) {
+        const int c = r / mheight;
+        const int y = r % mheight;
+        float* out = map_prob + long(c) * mwidth * mheight + long(y) * mwidth;
+        for(int x = 0 ; x < mwidth ; ++x) {
+            out[x] = 0.0f;
+        }
+        for(int ky = grid.yoffsets[y] ; ky < grid.yoffsets[y+1] ; ++ky) {
+            const tfrt::tile_tap& ty = grid.ytaps[ky];
+            const float* rows = tiles_prob + long(ty.tile) * grid.tiles_x * tile_stride +
+                c * channel_stride + long(ty.index) * out_width;
+            for(int x = 0 ; x < mwidth ; ++x) {
+                float sum = 0.0f;
+                for(int kx = grid.xoffsets[x] ; kx < grid.xoffsets[x+1] ; ++kx) {
+                    const tfrt::tile_tap& tx = grid.xtaps[kx];
+                    sum += tx.weight * rows[tx.tile * tile_stride + tx.index];
+                }
+                out[x] += ty.weight * sum;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,63 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_SEGMENTATION_H
+#define TFRT_CPU_SEGMENTATION_H
+
+#include <cstdint>
+#include "../misc/tiling.h"
+
+/** Argmax of RAW segmentation probabilities over the channels, on host memory.
+ * Input is a NCHW tensor, outputs are NHW classes and scores. Same semantics
+ * as the original post-processing: strictly positive scores only, class index
+ * shifted by one if no empty class, and class 0 below the threshold.
+ * Parallelized over batch and rows. Return false on invalid inputs.
+ */
+bool cpu_seg_argmax(
+    const float* raw_prob, uint8_t* classes, float* scores,
+    uint32_t batch_size, uint32_t seg_width, uint32_t seg_height, uint32_t num_classes,
+    bool empty_class, float threshold);
+
+/** Post-processing of RAW segmentation probabilities: find classes and scores,
+ * applying first the 3x3 transformation matrix (stabilization). Host version of
+ * cuda_seg_post_process, with the same semantics: column-major matrix (OpenVX
+ * convention), pixels centers mapped, outside pixels set to class 0 and score 1.
+ * The homography is stepped incrementally along rows, in double precision as the
+ * CUDA kernel, so the outputs are bitwise identical. As in the kernel, ties keep
+ * the first maximum and NaN probabilities are ignored. Row tiles mapped on a
+ * contiguous source row (identity, integer translations) use the SIMD argmax of
+ * cpu_seg_argmax, other tiles a gathered scalar argmax.
+ */
+bool cpu_seg_post_process(
+    const float* raw_prob, uint8_t* classes, float* scores, const float* tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes,
+    bool empty_class, float threshold);
+
+/** Temporal fusion of segmentation probabilities. Host version of
+ * cuda_seg_fusion, with the same semantics. Parallelized over rows.
+ */
+bool cpu_seg_fusion(
+    const float* raw_prob, const float* prev_prob, float* fused_prob, const float* tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes, float alpha);
+
+/** Stitching of the segmentation probabilities of tiles (batch of grid.size()
+ * NCHW outputs, out_width x out_height, in the grid ROIs order) into a frame
+ * map of size grid.map_width x grid.map_height: overlaps are linearly blended
+ * with the grid taps. Parallelized over channels and rows.
+ */
+bool cpu_seg_stitch_tiles(
+    const float* tiles_prob, float* map_prob, const tfrt::tile_grid& grid,
+    uint32_t out_width, uint32_t out_height, uint32_t num_classes);
+
+#endif
@@ -0,0 +1,392 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <vector>
+
+#include "cpuSIMD.h"
+#include "cpuYUV.h"
+#include "../misc/resampling.h"
+#include "../misc/yuv.h"
+
+namespace
+{
+/* ============================================================================
+ * YUV => RGB fixed-point conversion (see tfrt::yuv), 8 pixels at a time.
+ * ========================================================================== */
+using namespace tfrt::yuv;
+
+/** Number of pixels converted per SIMD iteration. */
+const int kYuvLanes = 8;
+
+/** Rows of YUV samples (u, v centered), and RGB outputs in [0, 255]. */
+struct yuv_rows
+{
+    std::vector<int16_t>  y, u, v;
+    std::vector<int16_t>  r, g, b;
+    // Padded to full SIMD iterations.
+    yuv_rows(int width) {
+        const size_t n = (width + kYuvLanes - 1) / kYuvLanes * kYuvLanes;
+        y.resize(n, 0);  u.resize(n, 0);  v.resize(n, 0);
+        r.resize(n, 0);  g.resize(n, 0);  b.resize(n, 0);
+    }
+};
+
+#if defined(TFRT_SIMD_SSE2)
+/** 8 pixels conversion, outputs clamped to [0, 255] in int16 lanes. */
+inline void yuv_to_rgb8(const int16_t* py, const int16_t* pu, const int16_t* pv,
+    __m128i& r, __m128i& g, __m128i& b)
+{
+    const __m128i y = _mm_add_epi16(_mm_slli_epi16(_mm_loadu_si128((const __m128i*)py), kBits),
+        _mm_set1_epi16(1 << (kBits - 1)));
+    const __m128i u = _mm_loadu_si128((const __m128i*)pu);
+    const __m128i v = _mm_loadu_si128((const __m128i*)pv);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vmax = _mm_set1_epi16(255);
+    r = _mm_add_epi16(y, _mm_mullo_epi16(v, _mm_set1_epi16(kVR)));
+    g = _mm_sub_epi16(_mm_sub_epi16(y, _mm_mullo_epi16(u, _mm_set1_epi16(kUG))),
+        _mm_mullo_epi16(v, _mm_set1_epi16(kVG)));
+    b = _mm_add_epi16(y, _mm_mullo_epi16(u, _mm_set1_epi16(kUB)));
+    r = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(r, kBits), zero), vmax);
+    g = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(g, kBits), zero), vmax);
+    b = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(b, kBits), zero), vmax);
+}
+#elif defined(TFRT_SIMD_NEON)
+inline void yuv_to_rgb8(const int16_t* py, const int16_t* pu, const int16_t* pv,
+    int16x8_t& r, int16x8_t& g, int16x8_t& b)
+{
+    const int16x8_t y = vaddq_s16(vshlq_n_s16(vld1q_s16(py), kBits),
+        vdupq_n_s16(1 << (kBits - 1)));
+    const int16x8_t u = vld1q_s16(pu);
+    const int16x8_t v = vld1q_s16(pv);
+    const int16x8_t zero = vdupq_n_s16(0);
+    const int16x8_t vmax = vdupq_n_s16(255);
+    r = vmlaq_n_s16(y, v, kVR);
+    g = vmlsq_n_s16(vmlsq_n_s16(y, u, kUG), v, kVG);
+    b = vmlaq_n_s16(y, u, kUB);
+    r = vminq_s16(vmaxq_s16(vshrq_n_s16(r, kBits), zero), vmax);
+    g = vminq_s16(vmaxq_s16(vshrq_n_s16(g, kBits), zero), vmax);
+    b = vminq_s16(vmaxq_s16(vshrq_n_s16(b, kBits), zero), vmax);
+}
+#endif
+
+/** Convert a row into RGB planes (int16). */
+void convert_rgb(yuv_rows& rows, int width)
+{
+    int x = 0;
+#if defined(TFRT_SIMD_SSE2)
+    for( ; x + kYuvLanes <= width ; x += kYuvLanes) {
+        __m128i r, g, b;
+        yuv_to_rgb8(&rows.y[x], &rows.u[x], &rows.v[x], r, g, b);
+        _mm_storeu_si128((__m128i*)&rows.r[x], r);
+        _mm_storeu_si128((__m128i*)&rows.g[x], g);
+        _mm_storeu_si128((__m128i*)&rows.b[x], b);
+    }
+#elif defined(TFRT_SIMD_NEON)
+    for( ; x + kYuvLanes <= width ; x += kYuvLanes) {
+        int16x8_t r, g, b;
+        yuv_to_rgb8(&rows.y[x], &rows.u[x], &rows.v[x], r, g, b);
+        vst1q_s16(&rows.r[x], r);
+        vst1q_s16(&rows.g[x], g);
+        vst1q_s16(&rows.b[x], b);
+    }
+#endif
+    for( ; x < width ; ++x) {
+        int r, g, b;
+        to_rgb(rows.y[x], rows.u[x], rows.v[x], r, g, b);
+        rows.r[x] = r;
+        rows.g[x] = g;
+        rows.b[x] = b;
+    }
+}
+/** Convert a row into interleaved RGBA (uint8). */
+void convert_rgba(yuv_rows& rows, uint8_t* rgba, int width)
+{
+    int x = 0;
+#if defined(TFRT_SIMD_SSE2)
+    const __m128i alpha = _mm_set1_epi8(char(255));
+    for( ; x + kYuvLanes <= width ; x += kYuvLanes) {
+        __m128i r, g, b;
+        yuv_to_rgb8(&rows.y[x], &rows.u[x], &rows.v[x], r, g, b);
+        // 16-bit [r g] and [b a] pairs, then 32-bit RGBA pixels.
+        const __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+        const __m128i ba = _mm_or_si128(b, _mm_slli_epi16(alpha, 8));
+        _mm_storeu_si128((__m128i*)(rgba + 4*x), _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128((__m128i*)(rgba + 4*x + 16), _mm_unpackhi_epi16(rg, ba));
+    }
+#elif defined(TFRT_SIMD_NEON)
+    for( ; x + kYuvLanes <= width ; x += kYuvLanes) {
+        int16x8_t r, g, b;
+        yuv_to_rgb8(&rows.y[x], &rows.u[x], &rows.v[x], r, g, b);
+        uint8x8x4_t px;
+        px.val[0] = vmovn_u16(vreinterpretq_u16_s16(r));
+        px.val[1] = vmovn_u16(vreinterpretq_u16_s16(g));
+        px.val[2] = vmovn_u16(vreinterpretq_u16_s16(b));
+        px.val[3] = vdup_n_u8(255);
+        vst4_u8(rgba + 4*x, px);
+    }
+#endif
+    for( ; x < width ; ++x) {
+        int r, g, b;
+        to_rgb(rows.y[x], rows.u[x], rows.v[x], r, g, b);
+        rgba[4*x] = r;
+        rgba[4*x+1] = g;
+        rgba[4*x+2] = b;
+        rgba[4*x+3] = 255;
+    }
+}
+
+/* ============================================================================
+ * YUV layouts: unpacking of (resampled) rows.
+ * ========================================================================== */
+/** Unpack the source row sy, at the source columns xs (one per output pixel). */
+void unpack_row(const planes& src, int sy, const int* xs, int width, yuv_rows& rows)
+{
+    for(int x = 0 ; x < width ; ++x) {
+        int y, u, v;
+        fetch(src, xs[x], sy, y, u, v);
+        rows.y[x] = y;
+        rows.u[x] = u;
+        rows.v[x] = v;
+    }
+}
+
+/** Store 4 lanes in a fp32 / fp16 CHW plane. */
+inline void store_lanes(float* p, tfrt::simd::f32x4 v) {
+    tfrt::simd::store(p, v);
+}
+inline void store_lanes(uint16_t* p, tfrt::simd::f32x4 v) {
+    tfrt::simd::store_half(p, v);
+}
+template <typename T>
+void yuv_to_chw_normalize(const planes& src, T* output,
+    const std::vector<int>& xs, const std::vector<int>& ys,
+    const float* scale, const float* shift)
+{
+    using namespace tfrt::simd;
+    const int width = xs.size();
+    const int height = ys.size();
+    const size_t n = size_t(width) * height;
+
+    #pragma omp parallel
+    {
+        yuv_rows rows(width);
+        #pragma omp for schedule(static)
+        for(int y = 0 ; y < height ; ++y) {
+            unpack_row(src, ys[y], xs.data(), width, rows);
+            convert_rgb(rows, width);
+            const int16_t* planes[3] = {rows.r.data(), rows.g.data(), rows.b.data()};
+            for(int c = 0 ; c < 3 ; ++c) {
+                T* out = output + n * c + size_t(y) * width;
+                const f32x4 vscale = set1(scale[c]);
+                const f32x4 vshift = set1(shift[c]);
+                for(int x = 0 ; x < width ; x += kFloatLanes) {
+                    const f32x4 v = madd(load_i16(planes[c] + x), vscale, vshift);
+                    if(x + kFloatLanes <= width) {
+                        store_lanes(out + x, v);
+                    }
+                    else {
+                        T tail[kFloatLanes];
+                        store_lanes(tail, v);
+                        std::copy(tail, tail + (width - x), out + x);
+                    }
+                }
+            }
+        }
+    }
+}
+}
+
+/* ============================================================================
+ * YUV => RGBA.
+ * ========================================================================== */
+bool cpu_yuv_to_rgba(tfrt::yuv_format format, const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    planes src;
+    if( !output || output_pitch < width * 4 ||
+        !make_planes(format, input, input_pitch, width, height, src) ) {
+        return false;
+    }
+    std::vector<int> xs(width);
+    for(size_t x = 0 ; x < width ; ++x) {
+        xs[x] = x;
+    }
+    #pragma omp parallel
+    {
+        yuv_rows rows(width);
+        #pragma omp for schedule(static)
+        for(int y = 0 ; y < int(height) ; ++y) {
+            unpack_row(src, y, xs.data(), width, rows);
+            convert_rgba(rows, output + y * output_pitch, width);
+        }
+    }
+    return true;
+}
+bool cpu_yuyv_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return cpu_yuv_to_rgba(tfrt::yuv_format::yuyv, input, input_pitch,
+        output, output_pitch, width, height);
+}
+bool cpu_uyvy_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return cpu_yuv_to_rgba(tfrt::yuv_format::uyvy, input, input_pitch,
+        output, output_pitch, width, height);
+}
+bool cpu_nv12_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return cpu_yuv_to_rgba(tfrt::yuv_format::nv12, input, input_pitch,
+        output, output_pitch, width, height);
+}
+bool cpu_yv12_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return cpu_yuv_to_rgba(tfrt::yuv_format::yv12, input, input_pitch,
+        output, output_pitch, width, height);
+}
+bool cpu_i420_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return cpu_yuv_to_rgba(tfrt::yuv_format::i420, input, input_pitch,
+        output, output_pitch, width, height);
+}
+
+/* ============================================================================
+ * YUV 4:2:2 => grayscale.
+ * ========================================================================== */
+namespace
+{
+bool packed_to_gray(bool uyvy, const uint8_t* input, size_t input_pitch,
+    float* output, size_t output_pitch, size_t width, size_t height)
+{
+    if( !input || !output || width == 0 || height == 0 || width % 2 ||
+        input_pitch < width * 2 || output_pitch < width * sizeof(float) ) {
+        return false;
+    }
+    const int oy = uyvy ? 1 : 0;
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < int(height) ; ++y) {
+        const uint8_t* row = input + y * input_pitch + oy;
+        float* out = (float*)((uint8_t*)output + y * output_pitch);
+        for(size_t x = 0 ; x < width ; ++x) {
+            out[x] = row[2*x] / 255.0f;
+        }
+    }
+    return true;
+}
+}
+bool cpu_yuyv_to_gray(const uint8_t* input, size_t input_pitch,
+    float* output, size_t output_pitch, size_t width, size_t height)
+{
+    return packed_to_gray(false, input, input_pitch, output, output_pitch, width, height);
+}
+bool cpu_uyvy_to_gray(const uint8_t* input, size_t input_pitch,
+    float* output, size_t output_pitch, size_t width, size_t height)
+{
+    return packed_to_gray(true, input, input_pitch, output, output_pitch, width, height);
+}
+
+/* ============================================================================
+ * RGBA => YUV 4:2:0.
+ * ========================================================================== */
+namespace
+{
+inline uint8_t rgb_to_y(int r, int g, int b) {
+    return uint8_t((30 * r + 59 * g + 11 * b) / 100);
+}
+bool rgba_to_420(bool i420, const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    if( !input || !output || width == 0 || height == 0 ||
+        input_pitch < width * 4 || output_pitch < width ) {
+        return false;
+    }
+    // Same planes layout and chroma sampling (bottom-right pixel) as CUDA.
+    const size_t plane_size = height * output_pitch;
+    const size_t uv_pitch = output_pitch / 2;
+    uint8_t* y_plane = output;
+    uint8_t* u_plane = i420 ? output + plane_size : output + plane_size + plane_size / 4;
+    uint8_t* v_plane = i420 ? output + plane_size + plane_size / 4 : output + plane_size;
+    #pragma omp parallel for schedule(static)
+    for(int y = 0 ; y < int(height) - 1 ; y += 2) {
+        const uint8_t* row0 = input + y * input_pitch;
+        const uint8_t* row1 = row0 + input_pitch;
+        uint8_t* yrow0 = y_plane + y * output_pitch;
+        uint8_t* yrow1 = yrow0 + output_pitch;
+        for(size_t x = 0 ; x + 1 < width ; x += 2) {
+            const uint8_t* p00 = row0 + 4*x;
+            const uint8_t* p01 = p00 + 4;
+            const uint8_t* p10 = row1 + 4*x;
+            const uint8_t* p11 = p10 + 4;
+            yrow0[x] = rgb_to_y(p00[0], p00[1], p00[2]);
+            yrow0[x+1] = rgb_to_y(p01[0], p01[1], p01[2]);
+            yrow1[x] = rgb_to_y(p10[0], p10[1], p10[2]);
+            yrow1[x+1] = rgb_to_y(p11[0], p11[1], p11[2]);
+            const size_t uv_idx = (y / 2) * uv_pitch + x / 2;
+            u_plane[uv_idx] = uint8_t((-17 * p11[0] - 33 * p11[1] + 50 * p11[2] + 12800) / 100);
+            v_plane[uv_idx] = uint8_t((50 * p11[0] - 42 * p11[1] - 8 * p11[2] + 12800) / 100);
+        }
+    }
+    return true;
+}
+}
+bool cpu_rgba_to_i420(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return rgba_to_420(true, input, input_pitch, output, output_pitch, width, height);
+}
+bool cpu_rgba_to_yv12(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height)
+{
+    return rgba_to_420(false, input, input_pitch, output, output_pitch, width, height);
+}
+
+/* ============================================================================
+ * YUV => normalized CHW network input.
+ * ========================================================================== */
+bool cpu_yuv_to_chw_normalize(tfrt::yuv_format format, const uint8_t* input,
+    size_t input_pitch, uint32_t inwidth, uint32_t inheight, void* output,
+    uint32_t outwidth, uint32_t outheight, const float* scale, const float* shift,
+    bool half_output)
+{
+    planes src;
+    if( !output || outwidth == 0 || outheight == 0 ||
+        !make_planes(format, input, input_pitch, inwidth, inheight, src) ) {
+        return false;
+    }
+    float vscale[3], vshift[3];
+    for(int c = 0 ; c < 3 ; ++c) {
+        vscale[c] = scale ? scale[c] : 1.0f;
+        vshift[c] = shift ? shift[c] : 0.0f;
+    }
+    // Nearest neighbour sampling, as the RGBA preprocessing.
+    std::vector<int> xs(outwidth), ys(outheight);
+    int count;
+    for(uint32_t x = 0 ; x < outwidth ; ++x) {
+        tfrt::resampling::taps(tfrt::resize_mode::nearest, inwidth, outwidth, x, xs[x], count);
+    }
+    for(uint32_t y = 0 ; y < outheight ; ++y) {
+        tfrt::resampling::taps(tfrt::resize_mode::nearest, inheight, outheight, y, ys[y], count);
+    }
+    if(half_output) {
+        yuv_to_chw_normalize(src, (uint16_t*)output, xs, ys, vscale, vshift);
+    }
+    else {
+        yuv_to_chw_normalize(src, (float*)output, xs, ys, vscale, vshift);
+    }
+    return true;
+}
@@ -0,0 +1,73 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_CPU_YUV_H
+#define TFRT_CPU_YUV_H
+
+#include <cstddef>
+#include <cstdint>
+#include "../misc/yuv.h"
+
+/* ============================================================================
+ * Host colour conversion, mirroring cuda/cudaYUV.h.
+ * ========================================================================== */
+/** YUV to RGBA uint8 (alpha 255), fixed-point conversion of tfrt::yuv (BT.601
+ * full range, coefficients of the CUDA YUYV kernels). 4:2:0 chroma is
+ * interpolated vertically on odd rows, as cudaNV12ToRGBA. Width (and height for
+ * 4:2:0) must be even. Vectorized (SSE2 / NEON) and parallelized by row bands. Return false
+ * on invalid inputs.
+ */
+bool cpu_yuv_to_rgba(tfrt::yuv_format format, const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+
+bool cpu_yuyv_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+bool cpu_uyvy_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+bool cpu_nv12_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+bool cpu_yv12_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+bool cpu_i420_to_rgba(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+
+/** Packed 4:2:2 to float grayscale in [0, 1] (luma / 255), as cudaYUYVToGray.
+ * Output pitch in bytes.
+ */
+bool cpu_yuyv_to_gray(const uint8_t* input, size_t input_pitch,
+    float* output, size_t output_pitch, size_t width, size_t height);
+bool cpu_uyvy_to_gray(const uint8_t* input, size_t input_pitch,
+    float* output, size_t output_pitch, size_t width, size_t height);
+
+/** RGBA to YUV 4:2:0 planar (I420 / YV12), same integer formulas as
+ * cudaRGBAToI420 / cudaRGBAToYV12: bitwise identical outputs.
+ */
+bool cpu_rgba_to_i420(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+bool cpu_rgba_to_yv12(const uint8_t* input, size_t input_pitch,
+    uint8_t* output, size_t output_pitch, size_t width, size_t height);
+
+/** Direct YUV frame to network input: nearest neighbour resize to the output
+ * shape (same sampling as cpu_rgba_to_chw_normalize), YUV to RGB conversion
+ * (as cpu_yuv_to_rgba) and per-channel normalization out = rgb * scale[c] +
+ * shift[c], into a CHW fp32 or fp16 (half_output) buffer. No RGBA intermediate
+ * image. scale and shift: arrays of 3 values (nullptr: identity).
+ * Host version of cuda_yuv_to_chw_normalize, with bitwise identical outputs.
+ */
+bool cpu_yuv_to_chw_normalize(tfrt::yuv_format format, const uint8_t* input,
+    size_t input_pitch, uint32_t inwidth, uint32_t inheight, void* output,
+    uint32_t outwidth, uint32_t outheight, const float* scale, const float* shift,
+    bool half_output);
+
+#endif
@@ -13,7 +13,10 @@
 # from Robik AI Ltd.
 # =========================================================================== */
 
+#include <cuda_fp16.h>
 #include "cudaUtility.h"
+#include "../misc/resampling.h"
+#include "../misc/yuv.h"
 
 // ========================================================================== //
 // RGBX <=> CHW.
@@ -133,3 +136,373 @@ cudaError_t cuda_rgba_to_chw_resize(uint8_t* d_input, float* d_output,
         inwidth, inheight, instride_x, instride_y, outwidth, outheight);
     return CUDA(cudaGetLastError());
 }
+
+// ========================================================================== //
+// RGBX => CHW fused preprocessing: resize + normalization.
+// ========================================================================== //
+/** Normalization parameters, passed by value to the kernels. */
+struct chw_normalization
+{
+    float scale[3];
+    float shift[3];
+};
+inline chw_normalization make_chw_normalization(const float* scale, const float* shift)
+{
+    chw_normalization n;
+    for(int c = 0 ; c < 3 ; ++c) {
+        n.scale[c] = scale ? scale[c] : 1.0f;
+        n.shift[c] = shift ? shift[c] : 0.0f;
+    }
+    return n;
+}
+
+/** Store a value in a fp32 / fp16 CHW output. */
+__device__ inline void store_chw(float* output, int idx, float v) {
+    output[idx] = v;
+}
+__device__ inline void store_chw(__half* output, int idx, float v) {
+    output[idx] = __float2half_rn(v);
+}
+
+template <typename T>
+__global__ void kernel_rgbx_to_chw_normalize(const uint8_t* input, T* output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, float scale_x, float scale_y,
+    chw_normalization norm)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = outwidth * outheight;
+    if( x >= outwidth || y >= outheight ) {
+        return;
+    }
+    // Nearest-neighbour, in single precision (same as host).
+    const int in_x = min(int((float(x) + 0.5f) * scale_x), int(inwidth) - 1);
+    const int in_y = min(int((float(y) + 0.5f) * scale_y), int(inheight) - 1);
+    const uint8_t* px = input + in_y * instride_y + in_x * instride_x;
+    // No FMA contraction: bitwise identical to the host implementation.
+    const int idx = y * outwidth + x;
+    #pragma unroll
+    for(int c = 0 ; c < 3 ; ++c) {
+        store_chw(output, n * c + idx, __fadd_rn(__fmul_rn(float(px[c]), norm.scale[c]), norm.shift[c]));
+    }
+}
+/** Separable fixed-point filter (bilinear, area): same integer taps and sums
+ * as the host horizontal + vertical passes, computed per output pixel.
+ */
+template <typename T>
+__device__ inline void filter_pixel(const uint8_t* input, T* output,
+    int inwidth, int inheight, uint32_t instride_x, uint32_t instride_y,
+    int outwidth, int outheight, int x, int y, tfrt::resize_mode mode,
+    const chw_normalization& norm, int n, int idx)
+{
+    int first_x, count_x, first_y, count_y;
+    tfrt::resampling::taps(mode, inwidth, outwidth, x, first_x, count_x);
+    tfrt::resampling::taps(mode, inheight, outheight, y, first_y, count_y);
+    int acc[3] = {0, 0, 0};
+    for(int ky = 0 ; ky < count_y ; ++ky) {
+        const int wy = tfrt::resampling::weight(mode, inheight, outheight, y, first_y + ky);
+        const uint8_t* px = input + (first_y + ky) * instride_y + first_x * instride_x;
+        int h[3] = {0, 0, 0};
+        for(int kx = 0 ; kx < count_x ; ++kx) {
+            const int wx = tfrt::resampling::weight(mode, inwidth, outwidth, x, first_x + kx);
+            #pragma unroll
+            for(int c = 0 ; c < 3 ; ++c) {
+                h[c] += px[c] * wx;
+            }
+            px += instride_x;
+        }
+        #pragma unroll
+        for(int c = 0 ; c < 3 ; ++c) {
+            acc[c] += h[c] * wy;
+        }
+    }
+    #pragma unroll
+    for(int c = 0 ; c < 3 ; ++c) {
+        const float v = __fmul_rn(__int2float_rn(acc[c]), tfrt::resampling::inv_norm());
+        store_chw(output, n * c + idx, __fadd_rn(__fmul_rn(v, norm.scale[c]), norm.shift[c]));
+    }
+}
+template <typename T>
+__global__ void kernel_rgbx_to_chw_filter(const uint8_t* input, T* output,
+    int inwidth, int inheight, uint32_t instride_x, uint32_t instride_y,
+    int outwidth, int outheight, tfrt::resize_mode mode, chw_normalization norm)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if( x >= outwidth || y >= outheight ) {
+        return;
+    }
+    filter_pixel(input, output, inwidth, inheight, instride_x, instride_y,
+        outwidth, outheight, x, y, mode, norm, outwidth * outheight, y * outwidth + x);
+}
+
+cudaError_t cuda_rgba_to_chw_normalize(const uint8_t* d_input, void* d_output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output, cudaStream_t stream)
+{
+    if( !d_input || !d_output ) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if( inwidth == 0 || inheight == 0 || outwidth == 0 || outheight == 0 ) {
+        return cudaErrorInvalidValue;
+    }
+    if( instride_x < 3 || instride_y < inwidth * instride_x ) {
+        return cudaErrorInvalidValue;
+    }
+    if( mode != tfrt::resize_mode::nearest && mode != tfrt::resize_mode::bilinear &&
+        mode != tfrt::resize_mode::area ) {
+        return cudaErrorInvalidValue;
+    }
+    const chw_normalization norm = make_chw_normalization(scale, shift);
+    const float scale_x = float(inwidth) / float(outwidth);
+    const float scale_y = float(inheight) / float(outheight);
+    // Launch convertion kernel.
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(outwidth, blockDim.x), iDivUp(outheight, blockDim.y));
+    if(mode != tfrt::resize_mode::nearest) {
+        if(half_output) {
+            kernel_rgbx_to_chw_filter<__half><<<gridDim, blockDim, 0, stream>>>(
+                d_input, (__half*)d_output, inwidth, inheight, instride_x, instride_y,
+                outwidth, outheight, mode, norm);
+        }
+        else {
+            kernel_rgbx_to_chw_filter<float><<<gridDim, blockDim, 0, stream>>>(
+                d_input, (float*)d_output, inwidth, inheight, instride_x, instride_y,
+                outwidth, outheight, mode, norm);
+        }
+    }
+    else if(half_output) {
+        kernel_rgbx_to_chw_normalize<__half><<<gridDim, blockDim, 0, stream>>>(
+            d_input, (__half*)d_output, inwidth, inheight, instride_x, instride_y,
+            outwidth, outheight, scale_x, scale_y, norm);
+    }
+    else {
+        kernel_rgbx_to_chw_normalize<float><<<gridDim, blockDim, 0, stream>>>(
+            d_input, (float*)d_output, inwidth, inheight, instride_x, instride_y,
+            outwidth, outheight, scale_x, scale_y, norm);
+    }
+    return CUDA(cudaGetLastError());
+}
+
+/** One block z per ROI (x, y, width, height): crop of the input image,
+ * resized in the batch slot z. Invalid ROIs give zero slots.
+ */
+template <typename T>
+__global__ void kernel_rgbx_rois_to_chw(const uint8_t* input, T* output,
+    int inwidth, int inheight, uint32_t instride_x, uint32_t instride_y,
+    const int32_t* rois, int outwidth, int outheight, tfrt::resize_mode mode,
+    chw_normalization norm)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if( x >= outwidth || y >= outheight ) {
+        return;
+    }
+    const int32_t* roi = rois + 4 * blockIdx.z;
+    T* slot = output + size_t(blockIdx.z) * 3 * outwidth * outheight;
+    if( roi[0] < 0 || roi[1] < 0 || roi[2] <= 0 || roi[3] <= 0 ||
+        roi[0] + roi[2] > inwidth || roi[1] + roi[3] > inheight ) {
+        const int n = outwidth * outheight;
+        #pragma unroll
+        for(int c = 0 ; c < 3 ; ++c) {
+            store_chw(slot, n * c + y * outwidth + x, 0.0f);
+        }
+        return;
+    }
+    filter_pixel(input + roi[1] * instride_y + roi[0] * instride_x, slot, roi[2], roi[3],
+        instride_x, instride_y, outwidth, outheight, x, y, mode, norm,
+        outwidth * outheight, y * outwidth + x);
+}
+cudaError_t cuda_rgba_rois_to_chw_normalize(const uint8_t* d_input,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    const int32_t* d_rois, uint32_t num_rois, void* d_output,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output, cudaStream_t stream)
+{
+    if( !d_input || !d_output || !d_rois ) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if( inwidth == 0 || inheight == 0 || outwidth == 0 || outheight == 0 ) {
+        return cudaErrorInvalidValue;
+    }
+    if( instride_x < 3 || instride_y < inwidth * instride_x ) {
+        return cudaErrorInvalidValue;
+    }
+    if( mode != tfrt::resize_mode::nearest && mode != tfrt::resize_mode::bilinear &&
+        mode != tfrt::resize_mode::area ) {
+        return cudaErrorInvalidValue;
+    }
+    if( num_rois == 0 ) {
+        return cudaSuccess;
+    }
+    const chw_normalization norm = make_chw_normalization(scale, shift);
+    // Single launch for all the ROIs.
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(outwidth, blockDim.x), iDivUp(outheight, blockDim.y), num_rois);
+    if(half_output) {
+        kernel_rgbx_rois_to_chw<__half><<<gridDim, blockDim, 0, stream>>>(
+            d_input, (__half*)d_output, inwidth, inheight, instride_x, instride_y,
+            d_rois, outwidth, outheight, mode, norm);
+    }
+    else {
+        kernel_rgbx_rois_to_chw<float><<<gridDim, blockDim, 0, stream>>>(
+            d_input, (float*)d_output, inwidth, inheight, instride_x, instride_y,
+            d_rois, outwidth, outheight, mode, norm);
+    }
+    return CUDA(cudaGetLastError());
+}
+
+/** Letterbox: filtered source in the inner rectangle, normalized pad value
+ * outside.
+ */
+template <typename T>
+__global__ void kernel_rgbx_to_chw_letterbox(const uint8_t* input, T* output,
+    int inwidth, int inheight, uint32_t instride_x, uint32_t instride_y,
+    int outwidth, int outheight, tfrt::letterbox lb, tfrt::resize_mode mode,
+    float pad_value, chw_normalization norm)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if( x >= outwidth || y >= outheight ) {
+        return;
+    }
+    const int n = outwidth * outheight;
+    const int idx = y * outwidth + x;
+    const int ix = x - lb.offset_x;
+    const int iy = y - lb.offset_y;
+    if( ix < 0 || iy < 0 || ix >= lb.width || iy >= lb.height ) {
+        #pragma unroll
+        for(int c = 0 ; c < 3 ; ++c) {
+            store_chw(output, n * c + idx, __fadd_rn(__fmul_rn(pad_value, norm.scale[c]), norm.shift[c]));
+        }
+        return;
+    }
+    filter_pixel(input, output, inwidth, inheight, instride_x, instride_y,
+        lb.width, lb.height, ix, iy, mode, norm, n, idx);
+}
+cudaError_t cuda_rgba_to_chw_letterbox(const uint8_t* d_input, void* d_output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, const tfrt::letterbox& lb, uint8_t pad_value,
+    tfrt::resize_mode mode, const float* scale, const float* shift, bool half_output,
+    cudaStream_t stream)
+{
+    if( !d_input || !d_output ) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if( inwidth == 0 || inheight == 0 || outwidth == 0 || outheight == 0 ) {
+        return cudaErrorInvalidValue;
+    }
+    if( instride_x < 3 || instride_y < inwidth * instride_x ) {
+        return cudaErrorInvalidValue;
+    }
+    if( lb.width <= 0 || lb.height <= 0 || lb.offset_x < 0 || lb.offset_y < 0 ||
+        lb.offset_x + lb.width > int(outwidth) || lb.offset_y + lb.height > int(outheight) ) {
+        return cudaErrorInvalidValue;
+    }
+    if( mode != tfrt::resize_mode::nearest && mode != tfrt::resize_mode::bilinear &&
+        mode != tfrt::resize_mode::area ) {
+        return cudaErrorInvalidValue;
+    }
+    const chw_normalization norm = make_chw_normalization(scale, shift);
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(outwidth, blockDim.x), iDivUp(outheight, blockDim.y));
+    if(half_output) {
+        kernel_rgbx_to_chw_letterbox<__half><<<gridDim, blockDim, 0, stream>>>(
+            d_input, (__half*)d_output, inwidth, inheight, instride_x, instride_y,
+            outwidth, outheight, lb, mode, float(pad_value), norm);
+    }
+    else {
+        kernel_rgbx_to_chw_letterbox<float><<<gridDim, blockDim, 0, stream>>>(
+            d_input, (float*)d_output, inwidth, inheight, instride_x, instride_y,
+            outwidth, outheight, lb, mode, float(pad_value), norm);
+    }
+    return CUDA(cudaGetLastError());
+}
+
+__global__ void kernel_chw_normalize(float* data, int width, int height,
+    chw_normalization norm)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = width * height;
+    if( x >= width || y >= height ) {
+        return;
+    }
+    const int idx = y * width + x;
+    #pragma unroll
+    for(int c = 0 ; c < 3 ; ++c) {
+        data[n * c + idx] = __fadd_rn(__fmul_rn(data[n * c + idx], norm.scale[c]), norm.shift[c]);
+    }
+}
+cudaError_t cuda_chw_normalize(float* d_data, uint32_t width, uint32_t height,
+    const float* scale, const float* shift, cudaStream_t stream)
+{
+    if( !d_data ) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if( width == 0 || height == 0 ) {
+        return cudaErrorInvalidValue;
+    }
+    const chw_normalization norm = make_chw_normalization(scale, shift);
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(width, blockDim.x), iDivUp(height, blockDim.y));
+    kernel_chw_normalize<<<gridDim, blockDim, 0, stream>>>(d_data, width, height, norm);
+    return CUDA(cudaGetLastError());
+}
+
+// ========================================================================== //
+// YUV => CHW fused preprocessing: colour conversion + resize + normalization.
+// ========================================================================== //
+/** One thread per output pixel: nearest neighbour source pixel, fixed-point
+ * YUV => RGB (tfrt::yuv) and normalization, as cpu_yuv_to_chw_normalize.
+ */
+template <typename T>
+__global__ void kernel_yuv_to_chw_normalize(tfrt::yuv::planes planes, T* output,
+    int inwidth, int inheight, int outwidth, int outheight, chw_normalization norm)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = outwidth * outheight;
+    if( x >= outwidth || y >= outheight ) {
+        return;
+    }
+    int in_x, in_y, count;
+    tfrt::resampling::taps(tfrt::resize_mode::nearest, inwidth, outwidth, x, in_x, count);
+    tfrt::resampling::taps(tfrt::resize_mode::nearest, inheight, outheight, y, in_y, count);
+    int luma, u, v, rgb[3];
+    tfrt::yuv::fetch(planes, in_x, in_y, luma, u, v);
+    tfrt::yuv::to_rgb(luma, u, v, rgb[0], rgb[1], rgb[2]);
+    const int idx = y * outwidth + x;
+    #pragma unroll
+    for(int c = 0 ; c < 3 ; ++c) {
+        store_chw(output, n * c + idx, __fadd_rn(__fmul_rn(float(rgb[c]), norm.scale[c]), norm.shift[c]));
+    }
+}
+cudaError_t cuda_yuv_to_chw_normalize(tfrt::yuv_format format, const uint8_t* d_input,
+    size_t input_pitch, uint32_t inwidth, uint32_t inheight, void* d_output,
+    uint32_t outwidth, uint32_t outheight, const float* scale, const float* shift,
+    bool half_output, cudaStream_t stream)
+{
+    if( !d_input || !d_output ) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    tfrt::yuv::planes planes;
+    if( outwidth == 0 || outheight == 0 ||
+        !tfrt::yuv::make_planes(format, d_input, input_pitch, inwidth, inheight, planes) ) {
+        return cudaErrorInvalidValue;
+    }
+    const chw_normalization norm = make_chw_normalization(scale, shift);
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(outwidth, blockDim.x), iDivUp(outheight, blockDim.y));
+    if(half_output) {
+        kernel_yuv_to_chw_normalize<__half><<<gridDim, blockDim, 0, stream>>>(
+            planes, (__half*)d_output, inwidth, inheight, outwidth, outheight, norm);
+    }
+    else {
+        kernel_yuv_to_chw_normalize<float><<<gridDim, blockDim, 0, stream>>>(
+            planes, (float*)d_output, inwidth, inheight, outwidth, outheight, norm);
+    }
+    return CUDA(cudaGetLastError());
+}
@@ -16,6 +16,8 @@
 #define TFRT_CUDA_CHW_IMAGE_H
 
 #include "cudaUtility.h"
+#include "../misc/resampling.h"
+#include "../misc/yuv.h"
 
 /** Convert a RGBX image to CHW format. Both are supposed to be stored on
  * device/CUDA space and have same size. The input image is uint8 RGBA format.
@@ -36,4 +38,61 @@ cudaError_t cuda_rgba_to_chw_resize(uint8_t* d_input, float* d_output,
     uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
     uint32_t outwidth, uint32_t outheight, cudaStream_t stream=0);
 
+/** Fused preprocessing of a RGBX image (uint8, any strides in bytes): resize
+ * to the output shape, conversion to CHW (RGB order) and per-channel
+ * normalization out = in * scale[c] + shift[c]. The output is written in fp32
+ * or fp16 (half_output), e.g. straight into a batch slot of the input.
+ * scale and shift are host arrays of 3 values (nullptr: identity).
+ * Resize modes (see tfrt::resampling):
+ *  - nearest: in_x = min(int((x + 0.5f) * (inwidth / outwidth)), inwidth-1);
+ *  - bilinear: half-pixel centers, 1/128 pixel fixed-point weights;
+ *  - area: box filter averaging all covered source pixels (anti-aliasing).
+ * Bitwise identical to the host cpu_rgba_to_chw_normalize.
+ */
+cudaError_t cuda_rgba_to_chw_normalize(const uint8_t* d_input, void* d_output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output, cudaStream_t stream=0);
+
+/** Letterbox variant of cuda_rgba_to_chw_normalize: the source is resized to
+ * the inner rectangle lb of the output (see tfrt::make_letterbox, aspect
+ * preserving), pixels outside being set to the normalized pad_value.
+ * Bitwise identical to the host cpu_rgba_to_chw_letterbox.
+ */
+cudaError_t cuda_rgba_to_chw_letterbox(const uint8_t* d_input, void* d_output,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    uint32_t outwidth, uint32_t outheight, const tfrt::letterbox& lb, uint8_t pad_value,
+    tfrt::resize_mode mode, const float* scale, const float* shift, bool half_output,
+    cudaStream_t stream=0);
+
+/** Fused preprocessing of a YUV camera frame (NV12, YUYV, ... see
+ * tfrt::yuv_format; pitch in bytes): nearest neighbour resize, fixed-point
+ * YUV => RGB conversion and per-channel normalization, written in CHW fp32 or
+ * fp16 (half_output). Reads the source frame once, without RGBA float4
+ * intermediate. Bitwise identical to the host cpu_yuv_to_chw_normalize.
+ */
+cudaError_t cuda_yuv_to_chw_normalize(tfrt::yuv_format format, const uint8_t* d_input,
+    size_t input_pitch, uint32_t inwidth, uint32_t inheight, void* d_output,
+    uint32_t outwidth, uint32_t outheight, const float* scale, const float* shift,
+    bool half_output, cudaStream_t stream=0);
+
+/** Batched ROIs preprocessing (e.g. second-stage classifier on detections):
+ * every ROI (x, y, width, height in pixels, int32 array of num_rois x 4 in
+ * device memory) of a RGBX image is cropped, resized and normalized as
+ * cuda_rgba_to_chw_normalize, into the consecutive CHW batch slots of d_output.
+ * Single kernel launch. ROIs outside the image give zero slots.
+ * Bitwise identical to the host cpu_rgba_rois_to_chw_normalize.
+ */
+cudaError_t cuda_rgba_rois_to_chw_normalize(const uint8_t* d_input,
+    uint32_t inwidth, uint32_t inheight, uint32_t instride_x, uint32_t instride_y,
+    const int32_t* d_rois, uint32_t num_rois, void* d_output,
+    uint32_t outwidth, uint32_t outheight, tfrt::resize_mode mode,
+    const float* scale, const float* shift, bool half_output, cudaStream_t stream=0);
+
+/** Inplace per-channel normalization of a 3 channels CHW float image:
+ * x = x * scale[c] + shift[c]. scale and shift are host arrays of 3 values.
+ */
+cudaError_t cuda_chw_normalize(float* d_data, uint32_t width, uint32_t height,
+    const float* scale, const float* shift, cudaStream_t stream=0);
+
 #endif
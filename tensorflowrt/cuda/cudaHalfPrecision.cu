@@ -45,6 +45,26 @@ cudaError_t cuda_float2half_array(float* host_input, uint16_t* host_output, uint
     return CUDA(cudaGetLastError());
 }
 
+__global__ void float2half_device(const float* din, half* dout, uint32_t dsize)
+{
+    const uint32_t idx = threadIdx.x + blockDim.x * blockIdx.x;
+    if(idx < dsize) {
+        dout[idx] = __float2half(din[idx]);
+    }
+}
+cudaError_t cuda_float2half_device(const float* d_input, uint16_t* d_output, uint32_t size,
+    cudaStream_t stream)
+{
+    if(!d_input || !d_output) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if(!size) {
+        return cudaSuccess;
+    }
+    float2half_device<<<iDivUp(size, nTPB), nTPB, 0, stream>>>(d_input, (half*)d_output, size);
+    return CUDA(cudaGetLastError());
+}
+
 __global__ void half2float_array(half* din, float* dout, uint32_t dsize)
 {
     int idx = threadIdx.x+blockDim.x*blockIdx.x;
@@ -69,4 +89,24 @@ cudaError_t cuda_half2float_array(uint16_t* host_input, float* host_output, uint
     return CUDA(cudaGetLastError());
 }
 
+__global__ void half2float_device(const half* din, float* dout, uint32_t dsize)
+{
+    const uint32_t idx = threadIdx.x + blockDim.x * blockIdx.x;
+    if(idx < dsize) {
+        dout[idx] = __half2float(din[idx]);
+    }
+}
+cudaError_t cuda_half2float_device(const uint16_t* d_input, float* d_output, uint32_t size,
+    cudaStream_t stream)
+{
+    if(!d_input || !d_output) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if(!size) {
+        return cudaSuccess;
+    }
+    half2float_device<<<iDivUp(size, nTPB), nTPB, 0, stream>>>((const half*)d_input, d_output, size);
+    return CUDA(cudaGetLastError());
+}
+
     // return CUDA(cudaGetLastError());
\ No newline at end of file
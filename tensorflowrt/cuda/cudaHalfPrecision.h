@@ -32,4 +32,15 @@ cudaError_t cuda_float2half_array(float* host_input, uint16_t* host_output, uint
  */
 cudaError_t cuda_half2float_array(uint16_t* host_input, float* host_output, uint32_t size);
 
+/** Convert float to half precision on device memory (e.g. mapped tensors
+ * CUDA pointers), enqueued on a stream. No allocation nor synchronization.
+ */
+cudaError_t cuda_float2half_device(const float* d_input, uint16_t* d_output, uint32_t size,
+    cudaStream_t stream=0);
+/** Convert half precision to float on device memory, enqueued on a stream.
+ * No allocation nor synchronization.
+ */
+cudaError_t cuda_half2float_device(const uint16_t* d_input, float* d_output, uint32_t size,
+    cudaStream_t stream=0);
+
 #endif
@@ -3,6 +3,7 @@
  */
 
 #include "cudaUtility.h"
+#include "cudaImageNet.h"
 
 // gpuPreImageNet
 __global__ void gpuPreImageNet(float2 scale, float4* input, int iWidth,
@@ -94,5 +95,60 @@ cudaError_t cudaPreImageNetMean(float4* input, size_t inputWidth, size_t inputHe
     return CUDA(cudaGetLastError());
 }
 
+// gpuPreImageNetLetterbox
+__global__ void gpuPreImageNetLetterbox(float2 scale, float4* input, int iWidth,
+                                        float* output, int oWidth, int oHeight,
+                                        int4 box, float pad_value)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = oWidth * oHeight;
+
+    if( x >= oWidth || y >= oHeight )
+        return;
+
+    // box: x = offset x, y = offset y, z = width, w = height.
+    const int bx = x - box.x;
+    const int by = y - box.y;
+    float3 rgb = make_float3(pad_value, pad_value, pad_value);
+
+    if( bx >= 0 && by >= 0 && bx < box.z && by < box.w )
+    {
+        const int dx = ((float)bx * scale.x);
+        const int dy = ((float)by * scale.y);
+        const float4 px = input[ dy * iWidth + dx ];
+        rgb = make_float3(px.x, px.y, px.z);
+    }
+
+    output[n * 0 + y * oWidth + x] = rgb.x;
+    output[n * 1 + y * oWidth + x] = rgb.y;
+    output[n * 2 + y * oWidth + x] = rgb.z;
+}
+
+// cudaPreImageNetLetterbox
+cudaError_t cudaPreImageNetLetterbox(float4* input, size_t inputWidth, size_t inputHeight,
+                                     float* output, size_t outputWidth, size_t outputHeight,
+                                     const tfrt::letterbox& lb, float pad_value)
+{
+    if( !input || !output )
+        return cudaErrorInvalidDevicePointer;
+
+    if( inputWidth == 0 || outputWidth == 0 || inputHeight == 0 || outputHeight == 0 )
+        return cudaErrorInvalidValue;
+
+    if( lb.width <= 0 || lb.height <= 0 || lb.offset_x < 0 || lb.offset_y < 0 ||
+        lb.offset_x + lb.width > int(outputWidth) || lb.offset_y + lb.height > int(outputHeight) )
+        return cudaErrorInvalidValue;
 
+    const float2 scale = make_float2( float(inputWidth) / float(lb.width),
+                                float(inputHeight) / float(lb.height) );
+    const int4 box = make_int4(lb.offset_x, lb.offset_y, lb.width, lb.height);
 
+    // launch kernel
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(outputWidth,blockDim.x), iDivUp(outputHeight,blockDim.y));
+
+    gpuPreImageNetLetterbox<<<gridDim, blockDim>>>(scale, input, inputWidth, output, outputWidth, outputHeight, box, pad_value);
+
+    return CUDA(cudaGetLastError());
+}
@@ -7,6 +7,7 @@
 
 
 #include "cudaUtility.h"
+#include "../misc/resampling.h"
 
 /** Resize and normalize an RGBA input tensor, and convert RGB.
  */
@@ -21,4 +22,12 @@ cudaError_t cudaPreImageNet(
     float4* input, size_t inputWidth, size_t inputHeight,
 	float* output, size_t outputWidth, size_t outputHeight);
 
+/** Letterbox resize of an RGBA input tensor, and convert RGB: aspect preserving
+ * resize in the inner rectangle lb of the output, pad_value outside.
+ */
+cudaError_t cudaPreImageNetLetterbox(
+    float4* input, size_t inputWidth, size_t inputHeight,
+    float* output, size_t outputWidth, size_t outputHeight,
+    const tfrt::letterbox& lb, float pad_value);
+
 #endif
@@ -122,3 +122,103 @@ cudaError_t cuda2DBoxOutlineOverlay(float4* input, float4* output,
     gpuRectOutlines<float4><<<gridDim, blockDim>>>(input, output, width, height, box2d, color);
     return cudaGetLastError();
 }
+
+/* ============================================================================
+ * Scanline spans overlay: all boxes / labels in a single launch.
+ * ========================================================================== */
+/** Integer blending, as tfrt::overlay_blend. */
+static inline __device__ uint8_t blend_u8( uint8_t p, uint8_t c, uint8_t a )
+{
+	const int v = p * (255 - a) + c * a + 128;
+	return uint8_t((v + (v >> 8)) >> 8);
+}
+/** RGB(X) pixels, copied in registers (RGBX: single 32 bits load / store). */
+struct rgb_pixel
+{
+	uint8_t x, y, z;
+};
+struct __align__(4) rgbx_pixel
+{
+	uint8_t x, y, z, w;
+};
+template<typename T>
+static inline __device__ void blend_pixel( T* px, const tfrt::overlay_color& c )
+{
+	px->x = blend_u8(px->x, c.r, c.a);
+	px->y = blend_u8(px->y, c.g, c.a);
+	px->z = blend_u8(px->z, c.b, c.a);
+}
+template<>
+inline __device__ void blend_pixel<float4>( float4* px, const tfrt::overlay_color& c )
+{
+	const float alpha = c.a / 255.0f;
+	const float ialph = 1.0f - alpha;
+	px->x = alpha * c.r + ialph * px->x;
+	px->y = alpha * c.g + ialph * px->y;
+	px->z = alpha * c.b + ialph * px->z;
+}
+
+/** One block per row. Every thread owns a set of pixels of the row and blends
+ * the spans covering them in drawing order: no synchronization, every pixel is
+ * read and written once. Strides in bytes.
+ */
+template<typename T>
+__global__ void gpuOverlaySpans( uint8_t* img, int width, int stride_x, int stride_y,
+                                 const int32_t* offsets, const tfrt::overlay_span* spans )
+{
+	const int y = blockIdx.x;
+	const int s0 = offsets[y];
+	const int s1 = offsets[y+1];
+	if( s0 == s1 )
+		return;
+	// Row extent covered by the spans.
+	int xmin = width;
+	int xmax = 0;
+	for( int s = s0; s < s1; s++ )
+	{
+		xmin = min(xmin, spans[s].x0);
+		xmax = max(xmax, spans[s].x1);
+	}
+	for( int x = xmin + threadIdx.x; x < xmax; x += blockDim.x )
+	{
+		T* px = (T*)(img + size_t(y) * stride_y + size_t(x) * stride_x);
+		T val = *px;
+		for( int s = s0; s < s1; s++ )
+		{
+			const tfrt::overlay_span span = spans[s];
+			if( x >= span.x0 && x < span.x1 )
+				blend_pixel(&val, span.color);
+		}
+		*px = val;
+	}
+}
+
+cudaError_t cuda_overlay_spans( uint8_t* d_img, uint32_t width, uint32_t height,
+                                uint32_t stride_x, uint32_t stride_y,
+                                const int32_t* d_offsets, const tfrt::overlay_span* d_spans )
+{
+	if( !d_img || !d_offsets || !d_spans )
+		return cudaErrorInvalidDevicePointer;
+	if( width == 0 || height == 0 || stride_x < 3 || stride_y == 0 )
+		return cudaErrorInvalidValue;
+	const dim3 blockDim(128);
+	const dim3 gridDim(height);
+	if( stride_x == 4 && stride_y % 4 == 0 && size_t(d_img) % 4 == 0 )
+		gpuOverlaySpans<rgbx_pixel><<<gridDim, blockDim>>>(d_img, width, stride_x, stride_y, d_offsets, d_spans);
+	else
+		gpuOverlaySpans<rgb_pixel><<<gridDim, blockDim>>>(d_img, width, stride_x, stride_y, d_offsets, d_spans);
+	return cudaGetLastError();
+}
+cudaError_t cuda_overlay_spans( float4* d_img, uint32_t width, uint32_t height,
+                                const int32_t* d_offsets, const tfrt::overlay_span* d_spans )
+{
+	if( !d_img || !d_offsets || !d_spans )
+		return cudaErrorInvalidDevicePointer;
+	if( width == 0 || height == 0 )
+		return cudaErrorInvalidValue;
+	const dim3 blockDim(128);
+	const dim3 gridDim(height);
+	gpuOverlaySpans<float4><<<gridDim, blockDim>>>((uint8_t*)d_img, width, sizeof(float4),
+	                                               width * sizeof(float4), d_offsets, d_spans);
+	return cudaGetLastError();
+}
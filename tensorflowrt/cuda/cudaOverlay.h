@@ -6,6 +6,7 @@
 #define __CUDA_OVERLAY_H__
 
 #include "cudaUtility.h"
+#include "../misc/overlay.h"
 
 
 /** cudaRectOutlineOverlay
@@ -18,6 +19,18 @@ cudaError_t cudaRectOutlineOverlay( float4* input, float4* output, uint32_t widt
 cudaError_t cuda2DBoxOutlineOverlay(float4* input, float4* output,
     uint32_t width, uint32_t height, const float4& box2d, const float4& color);
 
+/** Overlay of scanline spans (see tfrt::overlay_spans), in place, in a single
+ * launch: one block per row, every pixel covered by spans read and written
+ * once. d_offsets (height + 1) and d_spans in device (or mapped) memory.
+ * uint8 RGB(X) images: integer blending, bitwise identical to cpu_overlay_spans.
+ */
+cudaError_t cuda_overlay_spans( uint8_t* d_img, uint32_t width, uint32_t height,
+                                uint32_t stride_x, uint32_t stride_y,
+                                const int32_t* d_offsets, const tfrt::overlay_span* d_spans );
+/** float RGBA images (values in [0, 255]): float blending. */
+cudaError_t cuda_overlay_spans( float4* d_img, uint32_t width, uint32_t height,
+                                const int32_t* d_offsets, const tfrt::overlay_span* d_spans );
+
 /**
  * cudaRectFillOverlay
  * @ingroup util
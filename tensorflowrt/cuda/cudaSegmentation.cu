@@ -16,8 +16,6 @@
 #include <array>
 #include "cudaUtility.h"
 
-#define ALPHA_COLOR 128
-
 // selected_categories = {
 //     Categories.ignore: 0,
 //     Categories.car: 1,
@@ -43,58 +41,20 @@
 // ========================================================================== //
 // Segmentation overlay.
 // ========================================================================== //
+/** Integer blending, as tfrt::overlay_blend (host / device bitwise identical). */
+__device__ inline uint8_t blend_u8(uint8_t p, uint8_t c, uint8_t a)
+{
+    const int v = p * (255 - a) + c * a + 128;
+    return uint8_t((v + (v >> 8)) >> 8);
+}
+
 __global__ void kernel_seg_overlay(
-    uint8_t* d_img, uint8_t* d_mask, float2 scale,
+    uint8_t* d_img, const uint8_t* d_mask, const uchar4* d_lut, float2 scale,
     uint32_t img_width, uint32_t img_height,
     uint32_t img_stride_x, uint32_t img_stride_y,
     uint32_t mask_width, uint32_t mask_height,
     uint32_t mask_stride_x, uint32_t mask_stride_y)
 {
-    // UGLY! I know!
-    /* static uchar4 colors[] = {
-        {0, 0, 0, ALPHA_COLOR},
-        {0, 0, 142, ALPHA_COLOR},
-        {0, 110, 100, ALPHA_COLOR},
-        {30, 30, 70, ALPHA_COLOR},
-        {0, 60, 100, ALPHA_COLOR},
-        {119, 11, 32, ALPHA_COLOR},
-        {50, 0, 230, ALPHA_COLOR},
-        {220, 20, 60, ALPHA_COLOR},
-        {128, 64, 128, ALPHA_COLOR},
-        {244, 35, 232, ALPHA_COLOR},
-        {152, 251, 152, ALPHA_COLOR},
-        {220, 220, 0, ALPHA_COLOR},
-        {250, 170, 30, ALPHA_COLOR},
-        {107, 142, 35, ALPHA_COLOR},
-        {70, 70, 70, ALPHA_COLOR},
-        {70, 130, 180, ALPHA_COLOR},
-        {190, 153, 153, ALPHA_COLOR},
-        {153, 53, 153, ALPHA_COLOR},
-        {250, 170, 160, ALPHA_COLOR}
-    };*/
-    // UGLY! I know!
-    static uchar4 colors[] = {
-        {0, 0, 0, ALPHA_COLOR},
-        {0, 0, 142, ALPHA_COLOR},
-        {0, 0, 142, ALPHA_COLOR},
-        {0, 0, 142, ALPHA_COLOR},
-        {0, 0, 142, ALPHA_COLOR},
-        {119, 11, 32, ALPHA_COLOR},
-        {50, 0, 230, ALPHA_COLOR},
-        {220, 20, 60, ALPHA_COLOR},
-        {128, 64, 128, ALPHA_COLOR},
-        {244, 35, 232, ALPHA_COLOR},
-        {152, 251, 152, ALPHA_COLOR},
-        {220, 220, 0, ALPHA_COLOR},
-        {250, 170, 30, ALPHA_COLOR},
-        {107, 142, 35, ALPHA_COLOR},
-        {70, 70, 70, ALPHA_COLOR},
-        {70, 130, 180, ALPHA_COLOR},
-        {190, 153, 153, ALPHA_COLOR},
-        {153, 53, 153, ALPHA_COLOR},
-        {250, 170, 160, ALPHA_COLOR}
-    };
-
     // Image coordinates.
     const int x = blockIdx.x * blockDim.x + threadIdx.x;
     const int y = blockIdx.y * blockDim.y + threadIdx.y;
@@ -103,38 +63,27 @@ __global__ void kernel_seg_overlay(
     }
     const int idx = y * img_stride_y + x * img_stride_x;
     // Convertion to mask coordinates.
-    const int mx = max(min(int((float)x * scale.x), mask_width-1), 0);
-    const int my = max(min(int((float)y * scale.y), mask_height-1), 0);
+    const int mx = max(min(int((float)x * scale.x), int(mask_width)-1), 0);
+    const int my = max(min(int((float)y * scale.y), int(mask_height)-1), 0);
 
     const int mval = d_mask[my * mask_stride_y + mx * mask_stride_x];
-    // const uchar3 color = make_uchar3(colors[mval].x, colors[mval].y, colors[mval].z);
-    // const float alpha = float(colors[mval].w) / 255.f;
-    // const int mval = 1;
-    const uchar3 color = make_uchar3(colors[mval].x, colors[mval].y, colors[mval].z);
-    const float alpha = float(colors[mval].w) / 255.f;
-    // const uchar3 color = make_uchar3(255, 0, 0);
-    // const float alpha = 0.3;
-
+    const uchar4 color = d_lut[mval];
     // Mask overlay.
-    const uchar3 rgb = make_uchar3(
-        d_img[idx + 0] * (1. - alpha) + color.x * alpha,
-        d_img[idx + 1] * (1. - alpha) + color.y * alpha,
-        d_img[idx + 2] * (1. - alpha) + color.z * alpha);
-    d_img[idx + 0] = rgb.x;
-    d_img[idx + 1] = rgb.y;
-    d_img[idx + 2] = rgb.z;
+    d_img[idx + 0] = blend_u8(d_img[idx + 0], color.x, color.w);
+    d_img[idx + 1] = blend_u8(d_img[idx + 1], color.y, color.w);
+    d_img[idx + 2] = blend_u8(d_img[idx + 2], color.z, color.w);
 }
 cudaError_t cuda_seg_overlay(
-    uint8_t* d_img, uint8_t* d_mask,
+    uint8_t* d_img, const uint8_t* d_mask, const uchar4* d_lut,
     uint32_t img_width, uint32_t img_height,
     uint32_t img_stride_x, uint32_t img_stride_y,
     uint32_t mask_width, uint32_t mask_height,
     uint32_t mask_stride_x, uint32_t mask_stride_y)
 {
-    if( !d_img || !d_mask ) {
+    if( !d_img || !d_mask || !d_lut ) {
         return cudaErrorInvalidDevicePointer;
     }
-    if( img_width == 0 || img_height == 0 || img_stride_x == 0 || img_stride_y == 0 ) {
+    if( img_width == 0 || img_height == 0 || img_stride_x < 3 || img_stride_y == 0 ) {
         return cudaErrorInvalidValue;
     }
     if( mask_width == 0 || mask_height == 0 || mask_stride_x == 0 || mask_stride_y == 0 ) {
@@ -146,7 +95,7 @@ cudaError_t cuda_seg_overlay(
     // Launch kernel!
     const dim3 blockDim(8, 8);
     const dim3 gridDim(iDivUp(img_width,blockDim.x), iDivUp(img_height,blockDim.y));
-    kernel_seg_overlay<<<gridDim, blockDim>>>(d_img, d_mask, scale,
+    kernel_seg_overlay<<<gridDim, blockDim>>>(d_img, d_mask, d_lut, scale,
         img_width, img_height, img_stride_x, img_stride_y,
         mask_width, mask_height, mask_stride_x, mask_stride_y);
     return cudaGetLastError();
@@ -233,3 +182,64 @@ cudaError_t cuda_seg_post_process(
         empty_class, threshold);
     return cudaGetLastError();
 }
+
+// ========================================================================== //
+// Temporal fusion of segmentation probabilities.
+// ========================================================================== //
+__global__ void kernel_seg_fusion(
+    float* d_raw_prob, float* d_prev_prob, float* d_fused_prob, float* d_tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes, float alpha)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if( x >= seg_width || y >= seg_height ) {
+        return;
+    }
+    const int d_idx = y * seg_width + x;
+    const int stride = seg_width * seg_height;
+    // Position in the previous frame: same convention as post-processing.
+    const float tx_f = (x+0.5) * d_tr_matrix[0] + (y+0.5) * d_tr_matrix[3] + d_tr_matrix[6];
+    const float ty_f = (x+0.5) * d_tr_matrix[1] + (y+0.5) * d_tr_matrix[4] + d_tr_matrix[7];
+    const float tz_f = (x+0.5) * d_tr_matrix[2] + (y+0.5) * d_tr_matrix[5] + d_tr_matrix[8];
+    const float tx = floor(tx_f / tz_f);
+    const float ty = floor(ty_f / tz_f);
+    const bool inside = (tx >= 0.0f && tx < seg_width && ty >= 0.0f && ty < seg_height);
+    const int s_idx = inside ? int(ty) * seg_width + int(tx) : 0;
+
+    for (int k = 0 ; k < num_classes ; ++k) {
+        const float prev = inside ? d_prev_prob[k*stride + s_idx] : 0.0f;
+        float fused;
+        if (!d_raw_prob) {
+            // Prediction only: previous probabilities warped.
+            fused = prev;
+        }
+        else if (!inside) {
+            // No history: raw probabilities.
+            fused = d_raw_prob[k*stride + d_idx];
+        }
+        else {
+            fused = alpha * d_raw_prob[k*stride + d_idx] + (1.0f - alpha) * prev;
+        }
+        d_fused_prob[k*stride + d_idx] = fused;
+    }
+}
+cudaError_t cuda_seg_fusion(
+    float* d_raw_prob, float* d_prev_prob, float* d_fused_prob, float* d_tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes, float alpha)
+{
+    if( !d_prev_prob || !d_fused_prob || !d_tr_matrix ) {
+        return cudaErrorInvalidDevicePointer;
+    }
+    if( d_prev_prob == d_fused_prob || d_raw_prob == d_fused_prob ) {
+        return cudaErrorInvalidValue;
+    }
+    if( seg_width == 0 || seg_height == 0 || num_classes == 0 ) {
+        return cudaErrorInvalidValue;
+    }
+    const dim3 blockDim(8, 8);
+    const dim3 gridDim(iDivUp(seg_width,blockDim.x), iDivUp(seg_height,blockDim.y));
+    kernel_seg_fusion<<<gridDim, blockDim>>>(
+        d_raw_prob, d_prev_prob, d_fused_prob, d_tr_matrix,
+        seg_width, seg_height, num_classes, alpha);
+    return cudaGetLastError();
+}
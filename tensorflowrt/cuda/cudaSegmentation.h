@@ -20,10 +20,12 @@
 /** Overlay a segmentation result with an original image.
  * The original image is supposed to uint8 RGB(X) format.
  * The mask is supposed to be an uint8 monochrome image (or equivalent).
- * The masks is upscaled to the dimension of the input image.
+ * The masks is upscaled to the dimension of the input image, and every class
+ * blended with its colour in the LUT (256 RGBA entries in device memory, see
+ * tfrt::overlay_lut). Integer blending, bitwise identical to cpu_seg_overlay.
  */
 cudaError_t cuda_seg_overlay(
-    uint8_t* d_img, uint8_t* d_mask, 
+    uint8_t* d_img, const uint8_t* d_mask, const uchar4* d_lut,
     uint32_t img_width, uint32_t img_height,
     uint32_t img_stride_x, uint32_t img_stride_y,
     uint32_t mask_width, uint32_t mask_height,
@@ -37,4 +39,17 @@ cudaError_t cuda_seg_post_process(
     uint32_t seg_width, uint32_t seg_height, uint32_t num_classes,
     bool empty_class, float threshold);
 
+/** Temporal fusion of segmentation probabilities (CHW tensors). Previous
+ * probabilities are warped with the transformation matrix (current pixel =>
+ * previous frame pixel, same convention as post-processing), and blended with
+ * the raw probabilities with an exponential moving average:
+ *   fused = alpha * raw + (1 - alpha) * warped_prev
+ * Pixels without history take the raw probabilities. If d_raw_prob is null,
+ * only prediction: warped previous probabilities (zero if outside).
+ * Fused buffer can not alias inputs.
+ */
+cudaError_t cuda_seg_fusion(
+    float* d_raw_prob, float* d_prev_prob, float* d_fused_prob, float* d_tr_matrix,
+    uint32_t seg_width, uint32_t seg_height, uint32_t num_classes, float alpha);
+
 #endif
@@ -12,6 +12,8 @@
 # is strictly forbidden unless prior written permission is obtained
 # from Robik AI Ltd.
 # =========================================================================== */
+#include <algorithm>
+
 #include <gflags/gflags.h>
 #include <glog/logging.h>
 
@@ -70,14 +72,13 @@ std::pair<int, float> imagenet_network::classify(float* rgba, uint32_t height, u
     CHECK(width) << "Invalid image width.";
 
     // Downsample and convert to RGB.
-    cudaError_t r = cudaPreImageNet((float4*)rgba, width, height,
-        m_cuda_input.cuda, m_cuda_input.shape.w(), m_cuda_input.shape.h());
+    cudaError_t r = this->preprocess(rgba, height, width);
     CHECK_EQ(r, cudaSuccess) << "Failed to resize image to ImageNet network input shape."
         << "CUDA error: " << r;
 
     // Execute TensorRT network (batch size = 1).
-    void* inferenceBuffers[] = { m_cuda_input.cuda, m_cuda_outputs[0].cuda };
-    m_nv_context->execute(1, inferenceBuffers);
+    m_nv_context->execute(1, (void**)m_cached_bindings.data());
+    this->outputs_to_float(1);
     //CUDA(cudaDeviceSynchronize());
     PROFILER_REPORT();
 
@@ -99,5 +100,40 @@ std::pair<int, float> imagenet_network::classify(float* rgba, uint32_t height, u
                << "' with score " << class_score;
     return std::make_pair(class_idx, class_score);
 }
+std::vector<std::pair<int, float> > imagenet_network::classify_rois(
+    const nvx_image_patch& image, const tfrt::boxes2d::bboxes2d& bboxes, float margin)
+{
+    std::vector<int32_t> rois;
+    const long num_rois = tfrt::boxes2d::pixel_rois(bboxes,
+        image.addr.dim_x, image.addr.dim_y, margin, bboxes.size(), rois);
+    std::vector<std::pair<int, float> > classes(num_rois);
+    // Batches of max batch size crops.
+    const long batch_size = m_cuda_input.shape.n();
+    for(long first = 0 ; first < num_rois ; first += batch_size) {
+        const long n = std::min(batch_size, num_rois - first);
+        cudaError_t r = this->preprocess_rois(image, rois.data() + 4 * first, n);
+        CHECK_EQ(r, cudaSuccess) << "Failed to crop ROIs to ImageNet network input shape."
+            << "CUDA error: " << r;
+        m_nv_context->execute(n, (void**)m_cached_bindings.data());
+        this->outputs_to_float(n);
+        CUDA(cudaDeviceSynchronize());
+        for(long i = 0 ; i < n ; ++i) {
+            const float* scores = m_cuda_outputs[0].cpu_ptr(i);
+            int class_idx = -1;
+            float class_score = -1.0f;
+            for(size_t c = 0 ; c < m_num_classes ; ++c) {
+                if(scores[c] > class_score) {
+                    class_idx = c;
+                    class_score = scores[c];
+                }
+            }
+            if(this->m_empty_class) {
+                class_idx--;
+            }
+            classes[first + i] = std::make_pair(class_idx, class_score);
+        }
+    }
+    return classes;
+}
 
 }
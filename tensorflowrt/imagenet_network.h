@@ -17,9 +17,11 @@
 
 #include <tuple>
 #include <memory>
+#include <vector>
 #include <NvInfer.h>
 
 #include "network.h"
+#include "boxes2d/boxes2d.h"
 
 namespace tfrt
 {
@@ -38,6 +40,13 @@ public:
     /** Classify an image. Return a tuple <class, score>
      */
     std::pair<int, float> classify(float* rgba, uint32_t height, uint32_t width);
+    /** Second-stage classification of detected boxes (normalized coordinates,
+     * leading non-null boxes) in a RGBA uint8 image. Boxes are enlarged by a
+     * relative margin, then cropped, resized and normalized in a single kernel
+     * per batch of max batch size ROIs. Return a pair <class, score> per box.
+     */
+    std::vector<std::pair<int, float> > classify_rois(const nvx_image_patch& image,
+        const tfrt::boxes2d::bboxes2d& bboxes, float margin=0.0f);
 
 public:
     /** Number of classes. */
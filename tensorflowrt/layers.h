@@ -99,8 +99,11 @@ protected:
     nvinfer1::ITensor* mark_output(nvinfer1::ITensor* tensor, std::string suffix="output") {
         tensor->setName(this->m_scope.sub(suffix).cname());
         if(m_is_output) {
-            LOG(INFO) << "MARK output (layer) on tensor: " << tensor->getName();
+            TFRT_LAYER_LOG << "MARK output (layer) on tensor: " << tensor->getName();
             m_scope.network()->markOutput(*tensor);
+            if(m_scope.tfrt_network()->half_bindings()) {
+                tensor->setType(nvinfer1::DataType::kHALF);
+            }
         }
         return tensor;
     }
@@ -130,15 +133,18 @@ public:
     }
     /** Input construction */
     virtual nvinfer1::ITensor* operator()() {
-        auto dt = m_scope.tfrt_network()->datatype();
-        dt = nvinfer1::DataType::kFLOAT;
+        // Float input, unless fp16 bindings are enabled.
+        auto dt = m_scope.tfrt_network()->half_bindings() ?
+            nvinfer1::DataType::kHALF : nvinfer1::DataType::kFLOAT;
         // TensorRT input.
         nvinfer1::ITensor* input = m_scope.network()->addInput(
             m_scope.name().c_str(), dt, DIMRT(this->m_shape));
-        LOG(INFO) << "LAYER input '" << m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER input '" << m_scope.name() << "'. "
             << "Shape: " << dims_str(input->getDimensions());
-        // Input scaling.
-        input = this->scale(input);
+        // Input scaling, unless fused in the preprocessing.
+        if(!m_scope.tfrt_network()->fused_preprocessing()) {
+            input = this->scale(input);
+        }
         // return this->mark_output(input);
         return input;
     }
@@ -152,7 +158,7 @@ protected:
         nvinfer1::Weights shift = m_scope.weights("shift", wshape);
         nvinfer1::Weights scale = m_scope.weights("scale", wshape);
         if(shift.values || scale.values) {
-            LOG(INFO) << "OP input pre-scaling (shift + scale).";
+            TFRT_LAYER_LOG << "OP input pre-scaling (shift + scale).";
             nvinfer1::Weights power{shift.type, nullptr, 0};
             auto layer = this->m_scope.network()->addScale(
                 *input, nvinfer1::ScaleMode::kUNIFORM, shift, scale, power);
@@ -197,7 +203,7 @@ public:
     /** Add the scaling layer to network graph, using operator(root).
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER scale '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER scale '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->scale_op(net);
         return this->mark_output(net);
@@ -209,7 +215,7 @@ protected:
     nvinfer1::ITensor* scale_op(nvinfer1::ITensor* net) {
         auto inshape = static_cast<nvinfer1::DimsCHW&&>(net->getDimensions());
         auto wshape = this->weights_shape(inshape);
-        LOG(INFO) << "OP scaling. Input shape: " << dims_str(inshape);
+        TFRT_LAYER_LOG << "OP scaling. Input shape: " << dims_str(inshape);
         // Get weights and add scale layer.
         auto drift = m_scope.weights("drift", wshape);
         auto scale = m_scope.weights("scale", wshape);
@@ -253,7 +259,7 @@ public:
         return nullptr;
     }
     nvinfer1::ITensor* operator()(nvinfer1::ITensor* net1, nvinfer1::ITensor* net2) {
-        LOG(INFO) << "LAYER add '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER add '" << this->m_scope.name() << "'. "
             << "Inputs shape: " << dims_str(net1->getDimensions())
             << " and " << dims_str(net2->getDimensions());
         auto layer = this->m_scope.network()->addElementWise(
@@ -278,7 +284,7 @@ public:
         return nullptr;
     }
     nvinfer1::ITensor* operator()(nvinfer1::ITensor* net1, nvinfer1::ITensor* net2) {
-        LOG(INFO) << "LAYER multiply '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER multiply '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net1->getDimensions())
             << " and " << dims_str(net2->getDimensions());
         auto layer = this->m_scope.network()->addElementWise(
@@ -303,7 +309,7 @@ public:
         return nullptr;
     }
     nvinfer1::ITensor* operator()(nvinfer1::ITensor* net1, nvinfer1::ITensor* net2) {
-        LOG(INFO) << "LAYER maximum '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER maximum '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net1->getDimensions())
             << " and " << dims_str(net2->getDimensions());
         auto layer = this->m_scope.network()->addElementWise(
@@ -481,7 +487,7 @@ protected:
         if(BN) {
             auto inshape = static_cast<nvinfer1::DimsCHW&&>(input->getDimensions());
             auto bnshape = this->bn_weights_shape(inshape);
-            LOG(INFO) << "OP Batch Norm. Input shape: " << dims_str(inshape);
+            TFRT_LAYER_LOG << "OP Batch Norm. Input shape: " << dims_str(inshape);
             // TODO: transform moving mean and variance in export...
             nvinfer1::IScaleLayer* bnlayer = nullptr;
             tfrt::scope bnsc = this->m_scope.sub("BatchNorm");
@@ -510,7 +516,7 @@ protected:
     /** Set up an activation operation.
      */
     nvinfer1::ITensor* activation(nvinfer1::ITensor* input) {
-        LOG(INFO) << "OP activation. Type: " << ActivationName(ACT)
+        TFRT_LAYER_LOG << "OP activation. Type: " << ActivationName(ACT)
                 << " Input shape: " << dims_str(input->getDimensions());
         std::string aname = ActivationName(ACT);
         if(ACT != ActivationType::NONE && ACT != ActivationType::SOFTMAX) {
@@ -563,7 +569,7 @@ public:
      * 2D convolution + batch norm + activation.
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D contrib convolution '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER 2D contrib convolution '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->convolution(net);
         net = this->batch_norm(net);
@@ -582,7 +588,7 @@ protected:
         auto inshape = static_cast<nvinfer1::DimsCHW&&>(input->getDimensions());
         auto wshape = this->weights_shape(inshape);
         auto bshape = this->biases_shape(inshape);
-        LOG(INFO) << "OP 2D convolution. "
+        TFRT_LAYER_LOG << "OP 2D convolution. "
             << "Input shape: " << dims_str(inshape)
             << ". PARAMETERS: "
             << "ksize: " << dims_str(this->ksize()) << " | "
@@ -646,7 +652,7 @@ public:
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
         auto inshape = static_cast<nvinfer1::DimsCHW&&>(net->getDimensions());
-        LOG(INFO) << "LAYER 2D contrib separable convolution '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER 2D contrib separable convolution '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(inshape);
         // Number of groups: input channel size.
         int ngroups = dims_channels(inshape);
@@ -734,7 +740,7 @@ public:
      * 2D tranpose convolution + batch norm + activation.
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D contrib transpose convolution '" << this->m_scope.name()
+        TFRT_LAYER_LOG << "LAYER 2D contrib transpose convolution '" << this->m_scope.name()
             << ". Input shape: " << dims_str(net->getDimensions());
         net = this->tr_convolution(net);
         net = this->batch_norm(net);
@@ -799,7 +805,7 @@ protected:
         auto inshape = static_cast<nvinfer1::DimsCHW&&>(input->getDimensions());
         auto wshape = this->weights_shape(inshape);
         auto bshape = this->biases_shape(inshape);
-        LOG(INFO) << "OP 2D transpose convolution. "
+        TFRT_LAYER_LOG << "OP 2D transpose convolution. "
             << "Input shape: " << dims_str(inshape)
             << ". PARAMETERS: "
             << "ksize: " << dims_str(this->ksize()) << " | "
@@ -864,7 +870,7 @@ public:
     }
     /** Add the layer to network graph, using operator(root). */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D contrib batch norm '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER 2D contrib batch norm '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->operation2d<ActivationType::NONE, PaddingType::SAME, true>::batch_norm(net);
         return this->mark_output(net);
@@ -889,7 +895,7 @@ public:
     /** Add the layer to network graph.
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D activation '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER 2D activation '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->operation2d<ACT, PaddingType::SAME, false>::activation(net);
         return this->mark_output(net);
@@ -917,7 +923,7 @@ public:
     /** Add the layer to network graph, using operator(root).
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D contrib pooling '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER 2D contrib pooling '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->pooling(net);
         return this->mark_output(net);
@@ -975,7 +981,7 @@ public:
     /** Add the layer to network graph, using operator(root).
      */
     nvinfer1::ITensor* operator()(const std::vector<nvinfer1::ITensor*>& inputs) {
-        LOG(INFO) << "LAYER concat '" << this->m_scope.name() << "'.";
+        TFRT_LAYER_LOG << "LAYER concat '" << this->m_scope.name() << "'.";
         auto clayer = this->m_scope.network()->addConcatenation(&inputs[0], inputs.size());
         CHECK_NOTNULL(clayer);
         clayer->setName(this->m_scope.name().c_str());
@@ -1004,7 +1010,7 @@ public:
     }
     /** Add the layer to network graph, using operator(root).*/
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D bilinear-pool interpolation '"
+        TFRT_LAYER_LOG << "LAYER 2D bilinear-pool interpolation '"
             << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->interpolation(net);
@@ -1085,7 +1091,7 @@ public:
     }
     /** Add the layer to network graph, using operator(root). */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER 2D bilinear-conv interpolation '"
+        TFRT_LAYER_LOG << "LAYER 2D bilinear-conv interpolation '"
             << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         net = this->interpolation(net);
@@ -0,0 +1,227 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <glog/logging.h>
+
+#include "metrics.h"
+#include "memory_tracker.h"
+
+namespace tfrt
+{
+namespace
+{
+thread_local std::string  t_owner;
+
+void stats_reset(memory_tracker::stats& s, const std::string& owner)
+{
+    s.owner = owner;
+    std::fill(s.live, s.live + memory_tracker::kNumCategories, 0);
+    std::fill(s.peak, s.peak + memory_tracker::kNumCategories, 0);
+    s.live_total = s.peak_total = s.num_allocs = 0;
+}
+double mb(uint64_t bytes)
+{
+    return bytes / double(1 << 20);
+}
+}
+
+/* ============================================================================
+ * tfrt::memory_tracker
+ * ========================================================================== */
+const char* memory_tracker::category_name(category cat)
+{
+    static const char* names[kNumCategories] = {"tensor", "weights", "engine", "workspace"};
+    return names[cat];
+}
+memory_tracker& memory_tracker::global()
+{
+    // Never destroyed: tensors may be released during static destruction.
+    static memory_tracker* tracker = new memory_tracker();
+    return *tracker;
+}
+memory_tracker::memory_tracker()
+{
+    stats_reset(m_total, "total");
+}
+
+size_t memory_tracker::owner_index(const std::string& owner)
+{
+    const std::string name = owner.length() ? owner : "(none)";
+    for(size_t i = 0 ; i < m_owners.size() ; ++i) {
+        if(m_owners[i].owner == name) {
+            return i;
+        }
+    }
+    m_owners.emplace_back();
+    stats_reset(m_owners.back(), name);
+    return m_owners.size() - 1;
+}
+void memory_tracker::update(stats& s, category cat, int64_t delta)
+{
+    s.live[cat] += delta;
+    s.live_total += delta;
+    s.peak[cat] = std::max(s.peak[cat], s.live[cat]);
+    s.peak_total = std::max(s.peak_total, s.live_total);
+    s.num_allocs += (delta > 0);
+}
+
+void memory_tracker::allocate(const void* ptr, uint64_t bytes, category cat,
+    const std::string& label)
+{
+    if(!ptr) {
+        return;
+    }
+    this->release(ptr);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t owner = this->owner_index(t_owner);
+    m_records[ptr] = record{owner, cat, bytes, label};
+    update(m_owners[owner], cat, int64_t(bytes));
+    update(m_total, cat, int64_t(bytes));
+    DLOG(INFO) << "[memory] " << m_owners[owner].owner << " | " << category_name(cat)
+        << " | " << label << ": +" << bytes << " bytes";
+}
+void memory_tracker::release(const void* ptr)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_records.find(ptr);
+    if(it == m_records.end()) {
+        return;
+    }
+    const record& r = it->second;
+    update(m_owners[r.owner], r.cat, -int64_t(r.bytes));
+    update(m_total, r.cat, -int64_t(r.bytes));
+    m_records.erase(it);
+}
+
+memory_tracker::stats memory_tracker::total() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_total;
+}
+std::vector<memory_tracker::stats> memory_tracker::owners() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_owners;
+}
+
+void memory_tracker::print(std::ostream& out, uint64_t min_bytes) const
+{
+    char buf[512];
+    auto print_stats = [&](const stats& s) {
+        int n = snprintf(buf, sizeof(buf), "%-32.32s", s.owner.c_str());
+        for(int c = 0 ; c < kNumCategories ; ++c) {
+            n += snprintf(buf + n, sizeof(buf) - n, " %8.2f/%-8.2f", mb(s.live[c]), mb(s.peak[c]));
+        }
+        snprintf(buf + n, sizeof(buf) - n, " %8.2f/%-8.2f\n", mb(s.live_total), mb(s.peak_total));
+        out << buf;
+    };
+    int n = snprintf(buf, sizeof(buf), "%-32s", "Memory (MB, live/peak)");
+    for(int c = 0 ; c < kNumCategories ; ++c) {
+        n += snprintf(buf + n, sizeof(buf) - n, " %17s", category_name(category(c)));
+    }
+    snprintf(buf + n, sizeof(buf) - n, " %17s\n", "total");
+    out << buf;
+    for(auto&& s : this->owners()) {
+        print_stats(s);
+    }
+    print_stats(this->total());
+    // Largest live allocations.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(auto&& it : m_records) {
+        const record& r = it.second;
+        if(r.bytes >= min_bytes) {
+            snprintf(buf, sizeof(buf), "  %-64.64s %-10s %8.2f MB\n",
+                (m_owners[r.owner].owner + "/" + r.label).c_str(), category_name(r.cat), mb(r.bytes));
+            out << buf;
+        }
+    }
+}
+bool memory_tracker::save_json(const std::string& filename) const
+{
+    std::ofstream out(filename);
+    if(!out) {
+        LOG(ERROR) << "Could not open memory JSON file: " << filename;
+        return false;
+    }
+    auto json_stats = [&](const stats& s) {
+        out << "{\"owner\": \"" << s.owner << "\", \"num_allocs\": " << s.num_allocs
+            << ", \"live_total\": " << s.live_total << ", \"peak_total\": " << s.peak_total;
+        for(int c = 0 ; c < kNumCategories ; ++c) {
+            out << ", \"live_" << category_name(category(c)) << "\": " << s.live[c]
+                << ", \"peak_" << category_name(category(c)) << "\": " << s.peak[c];
+        }
+        out << "}";
+    };
+    out << "{\n  \"unit\": \"bytes\",\n  \"total\": ";
+    json_stats(this->total());
+    out << ",\n  \"owners\": [";
+    const auto owners = this->owners();
+    for(size_t i = 0 ; i < owners.size() ; ++i) {
+        out << (i ? ",\n    " : "\n    ");
+        json_stats(owners[i]);
+    }
+    out << "\n  ]\n}\n";
+    return bool(out);
+}
+void memory_tracker::dump_at_exit()
+{
+    static bool registered = false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(!registered) {
+        registered = true;
+        std::atexit([]() { memory_tracker::global().print(std::cerr); });
+    }
+}
+
+void memory_tracker::register_metrics(metrics::registry& reg)
+{
+    std::vector<metrics::gauge*> live, peak;
+    for(int c = 0 ; c < kNumCategories ; ++c) {
+        const std::string label = std::string("{category=\"") + category_name(category(c)) + "\"}";
+        live.push_back(&reg.gauge("tfrt_memory_live_bytes" + label, "TF-RT live memory."));
+        peak.push_back(&reg.gauge("tfrt_memory_peak_bytes" + label, "TF-RT memory high-water mark."));
+    }
+    reg.add_collector([this, live, peak]() {
+        const stats s = this->total();
+        for(int c = 0 ; c < kNumCategories ; ++c) {
+            live[c]->set(int64_t(s.live[c]));
+            peak[c]->set(int64_t(s.peak[c]));
+        }
+    });
+}
+
+/* ============================================================================
+ * tfrt::memory_owner
+ * ========================================================================== */
+memory_owner::memory_owner(const std::string& name) :
+    m_previous{t_owner}
+{
+    t_owner = name;
+}
+memory_owner::~memory_owner()
+{
+    t_owner = m_previous;
+}
+const std::string& memory_owner::current()
+{
+    return t_owner;
+}
+
+}
@@ -0,0 +1,128 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MEMORY_TRACKER_H
+#define TFRT_MEMORY_TRACKER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tfrt
+{
+namespace metrics
+{
+class registry;
+}
+
+/* ============================================================================
+ * tfrt::memory_tracker
+ * ========================================================================== */
+/** Accounting of the memory allocated by TF-RT: CUDA tensors, protobuf
+ * weights and TensorRT engines. Allocations are keyed by pointer, and
+ * attributed to a category and to the owner (network name) of the calling
+ * thread, see tfrt::memory_owner. Live bytes and high-water marks are kept
+ * per category, per owner and in total.
+ *
+ * Allocations are rare (loading / first inference): simple mutex.
+ */
+class memory_tracker
+{
+public:
+    enum category {
+        kTensor = 0,    // CUDA mapped tensors (bindings, post-processing buffers).
+        kWeights,       // Protobuf weights stores (host).
+        kEngine,        // TensorRT engine (serialized model size).
+        kWorkspace,     // TensorRT execution context workspace (upper bound).
+        kNumCategories
+    };
+    /** Category name. */
+    static const char* category_name(category cat);
+
+    /** Memory statistics of an owner (or total). */
+    struct stats
+    {
+        std::string  owner;
+        uint64_t  live[kNumCategories];
+        uint64_t  peak[kNumCategories];
+        uint64_t  live_total;
+        uint64_t  peak_total;
+        uint64_t  num_allocs;
+    };
+
+public:
+    /** Global tracker of the process. */
+    static memory_tracker& global();
+
+    /** Record an allocation (replaces a previous record on the same pointer). */
+    void allocate(const void* ptr, uint64_t bytes, category cat, const std::string& label="");
+    /** Record a release. Unknown pointers are ignored. */
+    void release(const void* ptr);
+
+    /** Total statistics, and statistics per owner. */
+    stats total() const;
+    std::vector<stats> owners() const;
+    /** Live allocations larger than a threshold: (owner/label, category, bytes). */
+    void print(std::ostream& out, uint64_t min_bytes=1 << 20) const;
+    bool save_json(const std::string& filename) const;
+    /** Print statistics on stderr at exit. */
+    void dump_at_exit();
+
+    /** Register gauges of live / peak bytes per category in a metrics registry. */
+    void register_metrics(metrics::registry& reg);
+
+private:
+    struct record
+    {
+        size_t  owner;
+        category  cat;
+        uint64_t  bytes;
+        std::string  label;
+    };
+    memory_tracker();
+    size_t owner_index(const std::string& owner);
+    static void update(stats& s, category cat, int64_t delta);
+
+private:
+    mutable std::mutex  m_mutex;
+    std::map<const void*, record>  m_records;
+    std::vector<stats>  m_owners;
+    stats  m_total;
+};
+
+/** Scoped owner of the allocations of the calling thread (e.g. network name).
+ * Nested scopes restore the previous owner at destruction.
+ */
+class memory_owner
+{
+public:
+    memory_owner(const std::string& name);
+    ~memory_owner();
+    /** Current owner of the calling thread (empty: none). */
+    static const std::string& current();
+
+private:
+    memory_owner(const memory_owner&) = delete;
+    memory_owner& operator=(const memory_owner&) = delete;
+
+private:
+    std::string  m_previous;
+};
+
+}
+
+#endif
@@ -0,0 +1,326 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <glog/logging.h>
+#include <cuda_runtime_api.h>
+
+#include "metrics.h"
+
+namespace tfrt
+{
+namespace metrics
+{
+namespace
+{
+/** Split a series name into family and labels (without braces). */
+void split_name(const std::string& name, std::string& family, std::string& labels)
+{
+    const size_t pos = name.find('{');
+    if(pos == std::string::npos) {
+        family = name;
+        labels.clear();
+    }
+    else {
+        family = name.substr(0, pos);
+        labels = name.substr(pos + 1, name.rfind('}') - pos - 1);
+    }
+}
+/** Series name with an additional label. */
+std::string series(const std::string& family, const std::string& labels,
+    const std::string& extra="")
+{
+    if(labels.empty() && extra.empty()) {
+        return family;
+    }
+    if(labels.empty() || extra.empty()) {
+        return family + "{" + labels + extra + "}";
+    }
+    return family + "{" + labels + "," + extra + "}";
+}
+}
+
+/* ============================================================================
+ * tfrt::metrics::registry
+ * ========================================================================== */
+registry& registry::global()
+{
+    static registry reg;
+    return reg;
+}
+
+registry::entry& registry::get_entry(const std::string& name, const std::string& help,
+    metric_type type)
+{
+    auto it = m_entries.find(name);
+    if(it != m_entries.end()) {
+        CHECK(it->second.type == type) << "Metric registered with another type: " << name;
+        return it->second;
+    }
+    entry& e = m_entries[name];
+    e.type = type;
+    e.help = help;
+    e.scale = 1.0;
+    return e;
+}
+metrics::counter& registry::counter(const std::string& name, const std::string& help)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry& e = this->get_entry(name, help, metric_type::counter);
+    if(!e.pcounter) {
+        e.pcounter.reset(new metrics::counter());
+    }
+    return *e.pcounter;
+}
+metrics::gauge& registry::gauge(const std::string& name, const std::string& help)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry& e = this->get_entry(name, help, metric_type::gauge);
+    if(!e.pgauge) {
+        e.pgauge.reset(new metrics::gauge());
+    }
+    return *e.pgauge;
+}
+tfrt::histogram& registry::histogram(const std::string& name, const std::string& help,
+    double scale)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry& e = this->get_entry(name, help, metric_type::histogram);
+    if(!e.phistogram) {
+        e.phistogram.reset(new tfrt::histogram());
+        e.scale = scale;
+    }
+    return *e.phistogram;
+}
+void registry::add_collector(std::function<void()> fn)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_collectors.push_back(fn);
+}
+
+void registry::to_prometheus(std::ostream& out) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(auto&& fn : m_collectors) {
+        fn();
+    }
+    static const char* type_names[3] = {"counter", "gauge", "summary"};
+    static const double quantiles[3] = {50.0, 95.0, 99.0};
+    static const char* quantile_labels[3] = {
+        "quantile=\"0.5\"", "quantile=\"0.95\"", "quantile=\"0.99\""};
+    // Group series by family: map order alone interleaves families sharing a
+    // prefix (e.g. "foo{...}" sorts after "foo_total").
+    std::string family, labels;
+    std::map<std::string, std::vector<const std::pair<const std::string, entry>*>> families;
+    for(auto&& it : m_entries) {
+        split_name(it.first, family, labels);
+        families[family].push_back(&it);
+    }
+    char buf[64];
+    for(auto&& f : families) {
+        // HELP and TYPE once per family.
+        const entry& first = f.second.front()->second;
+        if(first.help.length()) {
+            out << "# HELP " << f.first << " " << first.help << "\n";
+        }
+        out << "# TYPE " << f.first << " " << type_names[int(first.type)] << "\n";
+        for(auto&& pit : f.second) {
+            const std::string& name = pit->first;
+            const entry& e = pit->second;
+            split_name(name, family, labels);
+            if(e.type == metric_type::counter) {
+                out << name << " " << e.pcounter->value() << "\n";
+            }
+            else if(e.type == metric_type::gauge) {
+                out << name << " " << e.pgauge->value() << "\n";
+            }
+            else {
+                const tfrt::histogram& h = *e.phistogram;
+                for(int i = 0 ; i < 3 ; ++i) {
+                    snprintf(buf, sizeof(buf), "%.9g", h.percentile(quantiles[i]) * e.scale);
+                    out << series(family, labels, quantile_labels[i]) << " " << buf << "\n";
+                }
+                snprintf(buf, sizeof(buf), "%.9g", h.sum() * e.scale);
+                out << series(family + "_sum", labels) << " " << buf << "\n";
+                out << series(family + "_count", labels) << " " << h.count() << "\n";
+            }
+        }
+    }
+}
+std::string registry::to_prometheus() const
+{
+    std::ostringstream out;
+    this->to_prometheus(out);
+    return out.str();
+}
+
+void register_cuda_memory(registry& reg)
+{
+    metrics::gauge& used = reg.gauge("tfrt_gpu_memory_used_bytes", "GPU memory used.");
+    metrics::gauge& total = reg.gauge("tfrt_gpu_memory_total_bytes", "GPU memory total.");
+    reg.add_collector([&used, &total]() {
+        size_t free_bytes = 0, total_bytes = 0;
+        if(cudaMemGetInfo(&free_bytes, &total_bytes) == cudaSuccess) {
+            used.set(int64_t(total_bytes - free_bytes));
+            total.set(int64_t(total_bytes));
+        }
+    });
+}
+
+/* ============================================================================
+ * tfrt::metrics::exporter
+ * ========================================================================== */
+exporter::exporter(registry& reg) :
+    m_registry(reg), m_period_ms{1000}, m_socket_fd{-1}, m_running{false}
+{
+}
+exporter::~exporter()
+{
+    this->stop();
+}
+
+bool exporter::start(const std::string& file_path, uint32_t period_ms,
+    const std::string& socket_path)
+{
+    CHECK(!m_running) << "Metrics exporter already running.";
+    m_file_path = file_path;
+    m_period_ms = std::max(period_ms, uint32_t(10));
+    m_socket_path = socket_path;
+    if(m_file_path.empty() && m_socket_path.empty()) {
+        return false;
+    }
+    // Local Unix socket endpoint.
+    if(m_socket_path.length()) {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if(m_socket_path.length() >= sizeof(addr.sun_path)) {
+            LOG(ERROR) << "Metrics socket path too long: " << m_socket_path;
+            return false;
+        }
+        strncpy(addr.sun_path, m_socket_path.c_str(), sizeof(addr.sun_path) - 1);
+        m_socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        unlink(m_socket_path.c_str());
+        if(m_socket_fd < 0 || bind(m_socket_fd, (sockaddr*)&addr, sizeof(addr)) < 0 ||
+                listen(m_socket_fd, 8) < 0) {
+            LOG(ERROR) << "Could not open metrics socket: " << m_socket_path
+                << " (" << strerror(errno) << ")";
+            if(m_socket_fd >= 0) {
+                close(m_socket_fd);
+                m_socket_fd = -1;
+            }
+            return false;
+        }
+        LOG(INFO) << "Metrics endpoint on Unix socket: " << m_socket_path;
+    }
+    m_running = true;
+    m_thread = std::thread(&exporter::run, this);
+    return true;
+}
+void exporter::stop()
+{
+    if(!m_running) {
+        return;
+    }
+    m_running = false;
+    m_thread.join();
+    if(m_socket_fd >= 0) {
+        close(m_socket_fd);
+        unlink(m_socket_path.c_str());
+        m_socket_fd = -1;
+    }
+    // Last dump, with final values.
+    if(m_file_path.length()) {
+        this->dump_file();
+    }
+}
+
+void exporter::run()
+{
+    // Bounded polling, to stop quickly.
+    const int kPollMs = 100;
+    auto next_dump = std::chrono::steady_clock::now();
+    while(m_running) {
+        if(m_file_path.length() && std::chrono::steady_clock::now() >= next_dump) {
+            this->dump_file();
+            next_dump += std::chrono::milliseconds(m_period_ms);
+        }
+        if(m_socket_fd >= 0) {
+            pollfd pfd{m_socket_fd, POLLIN, 0};
+            if(poll(&pfd, 1, kPollMs) > 0 && (pfd.revents & POLLIN)) {
+                int client = accept(m_socket_fd, nullptr, nullptr);
+                if(client >= 0) {
+                    this->serve_client(client);
+                    close(client);
+                }
+            }
+        }
+        else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(
+                std::min(uint32_t(kPollMs), m_period_ms)));
+        }
+    }
+}
+bool exporter::dump_file() const
+{
+    // Write + rename: readers never see a partial file.
+    const std::string tmp_path = m_file_path + ".tmp";
+    {
+        std::ofstream file(tmp_path);
+        if(!file) {
+            LOG(ERROR) << "Could not open metrics file: " << tmp_path;
+            return false;
+        }
+        m_registry.to_prometheus(file);
+    }
+    return rename(tmp_path.c_str(), m_file_path.c_str()) == 0;
+}
+void exporter::serve_client(int fd) const
+{
+    // Optional request (HTTP GET), with a short timeout.
+    char request[1024];
+    ssize_t nreq = 0;
+    pollfd pfd{fd, POLLIN, 0};
+    if(poll(&pfd, 1, 50) > 0) {
+        nreq = recv(fd, request, sizeof(request), 0);
+    }
+    std::string body = m_registry.to_prometheus();
+    if(nreq >= 4 && strncmp(request, "GET ", 4) == 0) {
+        body = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+            "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+    }
+    size_t sent = 0;
+    while(sent < body.size()) {
+        ssize_t n = send(fd, body.data() + sent, body.size() - sent, MSG_NOSIGNAL);
+        if(n <= 0) {
+            break;
+        }
+        sent += n;
+    }
+}
+
+}
+}
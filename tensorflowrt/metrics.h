@@ -0,0 +1,178 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_METRICS_H
+#define TFRT_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "misc/histogram.h"
+
+namespace tfrt
+{
+namespace metrics
+{
+/* ============================================================================
+ * Metrics: counters, gauges and latency histograms.
+ * ========================================================================== */
+/** Monotonic counter (e.g. frames fetched). Relaxed atomic increment. */
+class counter
+{
+public:
+    counter() : m_value{0} {}
+    void inc(uint64_t n=1) {
+        m_value.fetch_add(n, std::memory_order_relaxed);
+    }
+    uint64_t value() const {
+        return m_value.load(std::memory_order_relaxed);
+    }
+private:
+    std::atomic<uint64_t>  m_value;
+};
+/** Gauge: value which can go up and down (e.g. queue depth, memory). */
+class gauge
+{
+public:
+    gauge() : m_value{0} {}
+    void set(int64_t v) {
+        m_value.store(v, std::memory_order_relaxed);
+    }
+    void add(int64_t n) {
+        m_value.fetch_add(n, std::memory_order_relaxed);
+    }
+    int64_t value() const {
+        return m_value.load(std::memory_order_relaxed);
+    }
+private:
+    std::atomic<int64_t>  m_value;
+};
+/** Scoped timer: record the elapsed time (ns) in a histogram at destruction. */
+class timer
+{
+public:
+    timer(tfrt::histogram& hist) :
+        m_hist(hist), m_start{std::chrono::steady_clock::now()} {}
+    ~timer() {
+        m_hist.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start).count());
+    }
+private:
+    tfrt::histogram&  m_hist;
+    std::chrono::steady_clock::time_point  m_start;
+};
+
+/* ============================================================================
+ * Registry.
+ * ========================================================================== */
+/** Registry of named metrics, exported in the Prometheus text format.
+ * Metrics are registered once (mutex) and the references cached: the hot path
+ * is a relaxed atomic operation. Names follow Prometheus conventions, with
+ * optional labels, e.g. 'tfrt_network_inference_seconds{network="inception2"}'.
+ * Histograms record integer values, scaled at export (default: ns to s), and
+ * are exported as summaries (p50, p95, p99, sum, count).
+ */
+class registry
+{
+public:
+    /** Global registry of the process. */
+    static registry& global();
+
+    /** Get or create metrics. References are valid for the registry lifetime. */
+    metrics::counter& counter(const std::string& name, const std::string& help="");
+    metrics::gauge& gauge(const std::string& name, const std::string& help="");
+    tfrt::histogram& histogram(const std::string& name, const std::string& help="",
+        double scale=1e-9);
+    /** Collector called before every export, e.g. to update gauges. */
+    void add_collector(std::function<void()> fn);
+
+    /** Export all metrics in the Prometheus text format. */
+    void to_prometheus(std::ostream& out) const;
+    std::string to_prometheus() const;
+
+private:
+    enum class metric_type { counter, gauge, histogram };
+    struct entry
+    {
+        metric_type  type;
+        std::string  help;
+        double  scale;
+        std::unique_ptr<metrics::counter>  pcounter;
+        std::unique_ptr<metrics::gauge>  pgauge;
+        std::unique_ptr<tfrt::histogram>  phistogram;
+    };
+    entry& get_entry(const std::string& name, const std::string& help, metric_type type);
+
+private:
+    mutable std::mutex  m_mutex;
+    // Ordered: series of a same family are contiguous.
+    std::map<std::string, entry>  m_entries;
+    std::vector<std::function<void()> >  m_collectors;
+};
+
+/** Register GPU memory gauges (used / total bytes, cudaMemGetInfo). */
+void register_cuda_memory(registry& reg);
+
+/* ============================================================================
+ * Exporter.
+ * ========================================================================== */
+/** Background export of a registry: periodic dump in a text file (atomic
+ * rename, e.g. for node_exporter textfile collector) and / or a local Unix
+ * socket endpoint, answering plain text or HTTP GET requests
+ * (curl --unix-socket /tmp/tfrt.sock http://localhost/metrics).
+ */
+class exporter
+{
+public:
+    exporter(registry& reg=registry::global());
+    ~exporter();
+
+    /** Start exporting. Empty file / socket path: disabled. */
+    bool start(const std::string& file_path, uint32_t period_ms,
+        const std::string& socket_path);
+    /** Stop the exporting thread. */
+    void stop();
+
+private:
+    void run();
+    bool dump_file() const;
+    void serve_client(int fd) const;
+
+private:
+    exporter(const exporter&) = delete;
+    exporter& operator=(const exporter&) = delete;
+
+private:
+    registry&  m_registry;
+    std::string  m_file_path;
+    uint32_t  m_period_ms;
+    std::string  m_socket_path;
+    int  m_socket_fd;
+    std::atomic<bool>  m_running;
+    std::thread  m_thread;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,159 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MISC_HISTOGRAM_H
+#define TFRT_MISC_HISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace tfrt
+{
+/* ============================================================================
+ * tfrt::histogram
+ * ========================================================================== */
+/** Lock-free latency histogram, log-linear buckets on integer values
+ * (typically nanoseconds): exact below 32, then 16 linear sub-buckets per
+ * power of two, i.e. ~6% relative precision, up to 2^40.
+ * Recording is wait-free (relaxed atomics): any thread can record while
+ * another one reads the statistics, which are then only approximately
+ * consistent.
+ */
+class histogram
+{
+public:
+    /** Number of sub-buckets per power of two (log2). */
+    static const int kSubBits = 4;
+    static const int kSubCount = 1 << kSubBits;
+    /** Largest power of two recorded (values clamped above). */
+    static const int kMaxBits = 40;
+    static const int kNumBuckets = 2*kSubCount + (kMaxBits - kSubBits - 1) * kSubCount;
+
+public:
+    histogram() {
+        this->reset();
+    }
+    /** Reset all counters. Not thread safe with concurrent recording. */
+    void reset()
+    {
+        for(int i = 0 ; i < kNumBuckets ; ++i) {
+            m_buckets[i].store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+    /** Record a value. */
+    void record(uint64_t v)
+    {
+        m_buckets[bucket_index(v)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(v, std::memory_order_relaxed);
+        uint64_t vmax = m_max.load(std::memory_order_relaxed);
+        while(v > vmax && !m_max.compare_exchange_weak(vmax, v, std::memory_order_relaxed)) {}
+    }
+
+public:
+    /** Number of values recorded. */
+    uint64_t count() const {
+        return m_count.load(std::memory_order_relaxed);
+    }
+    /** Sum, mean and max of values. */
+    uint64_t sum() const {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+    double mean() const {
+        const uint64_t n = this->count();
+        return n ? double(this->sum()) / n : 0.0;
+    }
+    uint64_t max() const {
+        return m_max.load(std::memory_order_relaxed);
+    }
+    /** Percentile, q in [0, 100]. Middle of the bucket, capped by the max. */
+    uint64_t percentile(double q) const
+    {
+        const uint64_t n = this->count();
+        if(n == 0) {
+            return 0;
+        }
+        // Rank of the percentile (nearest-rank definition).
+        uint64_t rank = uint64_t(q / 100.0 * n + 0.5);
+        rank = rank < 1 ? 1 : (rank > n ? n : rank);
+        uint64_t acc = 0;
+        for(int i = 0 ; i < kNumBuckets ; ++i) {
+            acc += m_buckets[i].load(std::memory_order_relaxed);
+            if(acc >= rank) {
+                const uint64_t v = (bucket_lower(i) + bucket_lower(i+1) - 1) / 2;
+                const uint64_t vmax = this->max();
+                return v < vmax ? v : vmax;
+            }
+        }
+        return this->max();
+    }
+    /** Merge another histogram (e.g. for aggregated statistics). */
+    void merge(const histogram& h)
+    {
+        for(int i = 0 ; i < kNumBuckets ; ++i) {
+            m_buckets[i].fetch_add(h.m_buckets[i].load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+        m_count.fetch_add(h.count(), std::memory_order_relaxed);
+        m_sum.fetch_add(h.sum(), std::memory_order_relaxed);
+        const uint64_t v = h.max();
+        uint64_t vmax = m_max.load(std::memory_order_relaxed);
+        while(v > vmax && !m_max.compare_exchange_weak(vmax, v, std::memory_order_relaxed)) {}
+    }
+
+public:
+    /** Bucket index of a value. */
+    static int bucket_index(uint64_t v)
+    {
+        if(v < uint64_t(2*kSubCount)) {
+            return int(v);
+        }
+        int msb = 63 - __builtin_clzll(v);
+        if(msb >= kMaxBits) {
+            return kNumBuckets - 1;
+        }
+        const int shift = msb - kSubBits;
+        const int mantissa = int(v >> shift);
+        return 2*kSubCount + (shift - 1) * kSubCount + (mantissa - kSubCount);
+    }
+    /** Lower bound of a bucket. */
+    static uint64_t bucket_lower(int idx)
+    {
+        if(idx < 2*kSubCount) {
+            return uint64_t(idx);
+        }
+        const int shift = (idx - 2*kSubCount) / kSubCount + 1;
+        const int mantissa = (idx - 2*kSubCount) % kSubCount + kSubCount;
+        return uint64_t(mantissa) << shift;
+    }
+
+private:
+    // No copy: atomics.
+    histogram(const histogram&) = delete;
+    histogram& operator=(const histogram&) = delete;
+
+private:
+    std::atomic<uint64_t>  m_buckets[kNumBuckets];
+    std::atomic<uint64_t>  m_count;
+    std::atomic<uint64_t>  m_sum;
+    std::atomic<uint64_t>  m_max;
+};
+
+}
+
+#endif
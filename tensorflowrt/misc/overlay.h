@@ -0,0 +1,158 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MISC_OVERLAY_H
+#define TFRT_MISC_OVERLAY_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace tfrt
+{
+/* ============================================================================
+ * Overlay drawing: colour LUT and scanline spans.
+ * ========================================================================== */
+/** RGBA colour (alpha: blending weight, out of 255). */
+struct overlay_color
+{
+    uint8_t  r, g, b, a;
+};
+/** Blending of a uint8 channel: (p * (255 - a) + c * a) / 255, rounded to the
+ * nearest (exact integer division). Shared by host and device overlays.
+ */
+inline uint8_t overlay_blend(uint8_t p, uint8_t c, uint8_t a)
+{
+    const int v = p * (255 - a) + c * a + 128;
+    return uint8_t((v + (v >> 8)) >> 8);
+}
+
+/** Colour lookup table of segmentation classes (256 entries, transparent by
+ * default). Mask overlays blend every pixel with the colour of its class.
+ */
+struct overlay_lut
+{
+    overlay_color  colors[256];
+
+    overlay_lut() {
+        std::fill(colors, colors + 256, overlay_color{0, 0, 0, 0});
+    }
+    overlay_lut& set(int idx, overlay_color c) {
+        colors[idx & 0xff] = c;
+        return *this;
+    }
+    /** Segmentation palette of the bundled models (Cityscapes-like colours,
+     * vehicles merged), with a common alpha.
+     */
+    static overlay_lut segmentation(uint8_t alpha=128) {
+        static const uint8_t palette[19][3] = {
+            {0, 0, 0}, {0, 0, 142}, {0, 0, 142}, {0, 0, 142}, {0, 0, 142},
+            {119, 11, 32}, {50, 0, 230}, {220, 20, 60}, {128, 64, 128},
+            {244, 35, 232}, {152, 251, 152}, {220, 220, 0}, {250, 170, 30},
+            {107, 142, 35}, {70, 70, 70}, {70, 130, 180}, {190, 153, 153},
+            {153, 53, 153}, {250, 170, 160}};
+        overlay_lut lut;
+        for(int i = 0 ; i < 19 ; ++i) {
+            lut.set(i, overlay_color{palette[i][0], palette[i][1], palette[i][2], alpha});
+        }
+        return lut;
+    }
+};
+
+/** Horizontal span [x0, x1) of a row, filled with a colour. */
+struct overlay_span
+{
+    int32_t  x0;
+    int32_t  x1;
+    overlay_color  color;
+};
+
+/** Scanline spans of an overlay (boxes outlines, labels, ...): rectangles are
+ * clipped to the frame and split into per-row spans, stored row by row (CSR:
+ * spans of row y in [offsets[y], offsets[y+1])), in the drawing order. The
+ * whole overlay is then blended in a single pass over the covered pixels.
+ */
+class overlay_spans
+{
+public:
+    overlay_spans(int width=0, int height=0) {
+        this->reset(width, height);
+    }
+    /** Clear the overlay, for a frame size. Buffers capacity is kept. */
+    void reset(int width, int height) {
+        m_width = width;
+        m_height = height;
+        m_rects.clear();
+        m_offsets.assign(height + 1, 0);
+        m_spans.clear();
+    }
+    /** Filled rectangle [x0, x1) x [y0, y1), in pixels. */
+    void add_rect(int x0, int y0, int x1, int y1, overlay_color c) {
+        x0 = std::max(x0, 0);  y0 = std::max(y0, 0);
+        x1 = std::min(x1, m_width);  y1 = std::min(y1, m_height);
+        if(x0 < x1 && y0 < y1 && c.a) {
+            m_rects.push_back(rect{x0, y0, x1, y1, c});
+        }
+    }
+    /** Rectangle outline, with a thickness inside the rectangle. */
+    void add_outline(int x0, int y0, int x1, int y1, int thickness, overlay_color c) {
+        const int t = std::max(1, std::min(thickness, std::min(x1 - x0, y1 - y0) / 2));
+        this->add_rect(x0, y0, x1, y0 + t, c);
+        this->add_rect(x0, y1 - t, x1, y1, c);
+        this->add_rect(x0, y0 + t, x0 + t, y1 - t, c);
+        this->add_rect(x1 - t, y0 + t, x1, y1 - t, c);
+    }
+    /** Split the rectangles into row spans (counting sort by row). */
+    void build() {
+        m_offsets.assign(m_height + 1, 0);
+        for(const rect& r : m_rects) {
+            for(int y = r.y0 ; y < r.y1 ; ++y) {
+                m_offsets[y+1]++;
+            }
+        }
+        for(int y = 0 ; y < m_height ; ++y) {
+            m_offsets[y+1] += m_offsets[y];
+        }
+        m_spans.resize(m_offsets[m_height]);
+        std::vector<int32_t> pos(m_offsets.begin(), m_offsets.end() - 1);
+        for(const rect& r : m_rects) {
+            for(int y = r.y0 ; y < r.y1 ; ++y) {
+                m_spans[pos[y]++] = overlay_span{r.x0, r.x1, r.color};
+            }
+        }
+    }
+
+public:
+    int width() const {  return m_width;  }
+    int height() const {  return m_height;  }
+    /** Row offsets (height + 1) and spans, after build. */
+    const std::vector<int32_t>& offsets() const {  return m_offsets;  }
+    const std::vector<overlay_span>& spans() const {  return m_spans;  }
+
+private:
+    struct rect
+    {
+        int  x0, y0, x1, y1;
+        overlay_color  color;
+    };
+    int  m_width;
+    int  m_height;
+    std::vector<rect>  m_rects;
+    std::vector<int32_t>  m_offsets;
+    std::vector<overlay_span>  m_spans;
+};
+
+}
+
+#endif
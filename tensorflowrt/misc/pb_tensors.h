@@ -0,0 +1,40 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MISC_PB_TENSORS_H
+#define TFRT_MISC_PB_TENSORS_H
+
+#include <string>
+#include "network.pb.h"
+
+namespace tfrt
+{
+/** Find a weights tensor by name in a protobuf network. Linear scan over the
+ * weights (called for every layer at build time). nullptr if not found.
+ */
+inline const tfrt_pb::tensor* find_tensor(const tfrt_pb::network& pb_network,
+    const std::string& name)
+{
+    for(int i = 0 ; i < pb_network.weights_size() ; ++i) {
+        const tfrt_pb::tensor& tensor = pb_network.weights(i);
+        if(tensor.name() == name) {
+            return &tensor;
+        }
+    }
+    return nullptr;
+}
+
+}
+
+#endif
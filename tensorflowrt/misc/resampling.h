@@ -0,0 +1,168 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MISC_RESAMPLING_H
+#define TFRT_MISC_RESAMPLING_H
+
+#include <cstdint>
+#include <string>
+
+// Shared by host and device code.
+#ifndef TFRT_HOST_DEVICE
+#if defined(__CUDACC__)
+#define TFRT_HOST_DEVICE __host__ __device__
+#else
+#define TFRT_HOST_DEVICE
+#endif
+#endif
+
+namespace tfrt
+{
+/* ============================================================================
+ * Resampling filters of the input preprocessing.
+ * ========================================================================== */
+/** Resize mode: nearest neighbour, bilinear (half-pixel centers) or area
+ * averaging (exact box filter, anti-aliased downscaling).
+ */
+enum class resize_mode : int
+{
+    nearest = 0,
+    bilinear = 1,
+    area = 2
+};
+inline std::string resize_mode_name(resize_mode mode) {
+    if(mode == resize_mode::bilinear) {  return "bilinear";  }
+    if(mode == resize_mode::area) {  return "area";  }
+    return "nearest";
+}
+/** Parse a resize mode name. Return false if unknown. */
+inline bool resize_mode_parse(const std::string& name, resize_mode& mode) {
+    for(int i = 0 ; i < 3 ; ++i) {
+        if(name == resize_mode_name(resize_mode(i))) {
+            mode = resize_mode(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace resampling
+{
+/** Separable fixed-point filters: per axis, an output pixel is a weighted sum
+ * of `count` consecutive source pixels starting at `first`, with integer
+ * weights summing to kOne. Everything is computed with integer arithmetic (or
+ * the same single precision formula for nearest neighbour), so host and device
+ * implementations get exactly the same taps. Sizes are limited to 16384.
+ */
+static const int kBits = 7;
+static const int kOne = 1 << kBits;
+
+/** Source taps range of an output pixel. */
+TFRT_HOST_DEVICE inline void taps(resize_mode mode, int insize, int outsize, int x,
+    int& first, int& count)
+{
+    if(mode == resize_mode::bilinear) {
+        // Source position (x + 0.5) * in / out - 0.5, in 1/kOne units.
+        const int num = (2*x + 1) * insize - outsize;
+        const int den = 2 * outsize;
+        const int pos = num <= 0 ? 0 : (num / den) * kOne + (num % den) * kOne / den;
+        first = pos >> kBits;
+        count = (first < insize - 1 && (pos & (kOne - 1))) ? 2 : 1;
+        first = first < insize - 1 ? first : insize - 1;
+    }
+    else if(mode == resize_mode::area) {
+        // Output pixel covers [x*in, (x+1)*in), source pixel i [i*out, (i+1)*out).
+        first = (x * insize) / outsize;
+        count = ((x + 1) * insize - 1) / outsize - first + 1;
+    }
+    else {
+        const float scale = float(insize) / float(outsize);
+        const int idx = int((float(x) + 0.5f) * scale);
+        first = idx < insize - 1 ? idx : insize - 1;
+        count = 1;
+    }
+}
+/** Weight of the source pixel i (first <= i < first + count). */
+TFRT_HOST_DEVICE inline int weight(resize_mode mode, int insize, int outsize, int x, int i)
+{
+    if(mode == resize_mode::bilinear) {
+        const int num = (2*x + 1) * insize - outsize;
+        const int den = 2 * outsize;
+        const int pos = num <= 0 ? 0 : (num / den) * kOne + (num % den) * kOne / den;
+        const int first = pos >> kBits;
+        if(first >= insize - 1) {
+            return kOne;
+        }
+        const int frac = pos & (kOne - 1);
+        return i == first ? kOne - frac : frac;
+    }
+    else if(mode == resize_mode::area) {
+        // Rounded cumulative overlap: weights always sum exactly to kOne.
+        const int lo = (i * outsize > x * insize ? i * outsize : x * insize) - x * insize;
+        const int hi = ((i + 1) * outsize < (x + 1) * insize ?
+            (i + 1) * outsize : (x + 1) * insize) - x * insize;
+        return (hi * kOne + insize / 2) / insize - (lo * kOne + insize / 2) / insize;
+    }
+    return kOne;
+}
+/** Scaling of the 2D weighted sums back to the pixel range (exact). */
+TFRT_HOST_DEVICE inline float inv_norm() {
+    return 1.0f / float(kOne * kOne);
+}
+
+}
+
+/* ============================================================================
+ * Letterbox: aspect preserving resize with padding.
+ * ========================================================================== */
+/** Placement of the resized source image in the output: the source is resized
+ * to (width, height) and written at (offset_x, offset_y), the remaining pixels
+ * being padded. Plain resizing (stretching) covers the full output.
+ */
+struct letterbox
+{
+    int  width;
+    int  height;
+    int  offset_x;
+    int  offset_y;
+};
+/** Stretching to the full output. */
+inline letterbox make_stretch(int outwidth, int outheight) {
+    return letterbox{outwidth, outheight, 0, 0};
+}
+/** Largest aspect preserving size fitting in the output (rounded to the
+ * closest pixel, integer arithmetic), centered.
+ */
+inline letterbox make_letterbox(int inwidth, int inheight, int outwidth, int outheight)
+{
+    letterbox lb = make_stretch(outwidth, outheight);
+    if(int64_t(outwidth) * inheight <= int64_t(outheight) * inwidth) {
+        lb.height = int((2 * int64_t(inheight) * outwidth + inwidth) / (2 * int64_t(inwidth)));
+        lb.height = lb.height < 1 ? 1 : (lb.height > outheight ? outheight : lb.height);
+    }
+    else {
+        lb.width = int((2 * int64_t(inwidth) * outheight + inheight) / (2 * int64_t(inheight)));
+        lb.width = lb.width < 1 ? 1 : (lb.width > outwidth ? outwidth : lb.width);
+    }
+    lb.offset_x = (outwidth - lb.width) / 2;
+    lb.offset_y = (outheight - lb.height) / 2;
+    return lb;
+}
+/** Is the letterbox a plain stretching of an output shape? */
+inline bool is_stretch(const letterbox& lb, int outwidth, int outheight) {
+    return lb.width == outwidth && lb.height == outheight;
+}
+}
+
+#endif
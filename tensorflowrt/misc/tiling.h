@@ -0,0 +1,151 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MISC_TILING_H
+#define TFRT_MISC_TILING_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace tfrt
+{
+/* ============================================================================
+ * Tiled inference geometry.
+ * ========================================================================== */
+/** Stitching tap: contribution of a tile column (or row) to a column (or row)
+ * of the frame map: nearest pixel of the tile output and blending weight.
+ */
+struct tile_tap
+{
+    int  tile;
+    int  index;
+    float  weight;
+};
+
+/** Grid of tiles_x x tiles_y overlapping tiles covering a frame: tiles of
+ * identical size, evenly spaced, the first and last ones aligned on the frame
+ * borders. ROIs (x, y, width, height) in pixels, row-major order, as expected
+ * by the batched ROIs preprocessing.
+ *
+ * Stitching of the tiles outputs (out_width x out_height each) into a frame
+ * map with the same resolution: separable taps, per map column (resp. row),
+ * over the tiles columns (resp. rows) covering it. Weights are the distance to
+ * the tile border, normalized: linear blending in the overlaps, and the
+ * product of column and row weights sums to one over the tiles.
+ */
+struct tile_grid
+{
+    // Frame size and tiles layout.
+    int  width{0};
+    int  height{0};
+    int  tiles_x{0};
+    int  tiles_y{0};
+    int  tile_width{0};
+    int  tile_height{0};
+    std::vector<int32_t>  rois;
+    // Stitched map size and taps (CSR: taps of column x in [xoffsets[x], xoffsets[x+1])).
+    int  map_width{0};
+    int  map_height{0};
+    std::vector<int>  xoffsets;
+    std::vector<int>  yoffsets;
+    std::vector<tile_tap>  xtaps;
+    std::vector<tile_tap>  ytaps;
+
+public:
+    /** Number of tiles. */
+    size_t size() const {
+        return rois.size() / 4;
+    }
+    /** Is the grid computed for a frame size? */
+    bool valid(int _width, int _height) const {
+        return !rois.empty() && width == _width && height == _height;
+    }
+};
+
+namespace tiling
+{
+/** Tiles size and positions along an axis. */
+inline void positions(int size, int ntiles, float overlap, int& tsize, std::vector<int>& pos)
+{
+    tsize = int(std::ceil(size / (ntiles - (ntiles - 1) * overlap)));
+    tsize = tsize < 1 ? 1 : (tsize > size ? size : tsize);
+    pos.resize(ntiles);
+    for(int i = 0 ; i < ntiles ; ++i) {
+        pos[i] = ntiles > 1 ? int((int64_t(2 * i) * (size - tsize) + ntiles - 1) / (2 * (ntiles - 1))) : 0;
+    }
+}
+/** Stitching taps along an axis: map pixel centers mapped to the frame. */
+inline void taps(int size, int tsize, const std::vector<int>& pos, int outsize, int mapsize,
+    std::vector<int>& offsets, std::vector<tile_tap>& taps)
+{
+    offsets.assign(1, 0);
+    taps.clear();
+    for(int x = 0 ; x < mapsize ; ++x) {
+        const float sx = (x + 0.5f) * size / mapsize;
+        const size_t first = taps.size();
+        float sum = 0.0f;
+        for(int i = 0 ; i < int(pos.size()) ; ++i) {
+            const float d = std::fmin(sx - pos[i], pos[i] + tsize - sx);
+            if(d > 0.0f) {
+                int idx = int((sx - pos[i]) * outsize / tsize);
+                idx = idx < 0 ? 0 : (idx >= outsize ? outsize - 1 : idx);
+                taps.push_back(tile_tap{i, idx, d});
+                sum += d;
+            }
+        }
+        for(size_t k = first ; k < taps.size() ; ++k) {
+            taps[k].weight /= sum;
+        }
+        offsets.push_back(int(taps.size()));
+    }
+}
+}
+
+/** Compute the tiles grid of a frame: overlap is the fraction of the tile size
+ * shared by two neighbour tiles, in [0, 1). Tiles outputs of size
+ * (out_width, out_height), e.g. the segmentation output shape.
+ */
+inline tile_grid make_tile_grid(int width, int height, int tiles_x, int tiles_y, float overlap,
+    int out_width, int out_height)
+{
+    tile_grid grid;
+    if(width <= 0 || height <= 0 || tiles_x <= 0 || tiles_y <= 0 ||
+        overlap < 0.0f || overlap >= 1.0f || out_width <= 0 || out_height <= 0) {
+        return grid;
+    }
+    grid.width = width;
+    grid.height = height;
+    grid.tiles_x = tiles_x;
+    grid.tiles_y = tiles_y;
+    std::vector<int> xpos, ypos;
+    tiling::positions(width, tiles_x, overlap, grid.tile_width, xpos);
+    tiling::positions(height, tiles_y, overlap, grid.tile_height, ypos);
+    grid.rois.reserve(tiles_x * tiles_y * 4);
+    for(int j = 0 ; j < tiles_y ; ++j) {
+        for(int i = 0 ; i < tiles_x ; ++i) {
+            grid.rois.insert(grid.rois.end(), {xpos[i], ypos[j], grid.tile_width, grid.tile_height});
+        }
+    }
+    // Map with the resolution of the tiles outputs.
+    grid.map_width = int(std::lround(double(width) * out_width / grid.tile_width));
+    grid.map_height = int(std::lround(double(height) * out_height / grid.tile_height));
+    tiling::taps(width, grid.tile_width, xpos, out_width, grid.map_width, grid.xoffsets, grid.xtaps);
+    tiling::taps(height, grid.tile_height, ypos, out_height, grid.map_height, grid.yoffsets, grid.ytaps);
+    return grid;
+}
+
+}
+
+#endif
@@ -0,0 +1,153 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_MISC_YUV_H
+#define TFRT_MISC_YUV_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Shared by host and device code.
+#ifndef TFRT_HOST_DEVICE
+#if defined(__CUDACC__)
+#define TFRT_HOST_DEVICE __host__ __device__
+#else
+#define TFRT_HOST_DEVICE
+#endif
+#endif
+
+namespace tfrt
+{
+/** YUV layouts of camera frames (pitches in bytes):
+ *  - yuyv, uyvy: packed 4:2:2, [Y0 U0 Y1 V0] / [U0 Y0 V0 Y1];
+ *  - nv12: Y plane, then interleaved UV plane (same pitch, height/2 rows);
+ *  - yv12, i420: Y plane, then V and U (yv12) or U and V (i420) planes of
+ *    pitch/2 and height/2 rows.
+ */
+enum class yuv_format : int
+{
+    yuyv = 0,
+    uyvy = 1,
+    nv12 = 2,
+    yv12 = 3,
+    i420 = 4
+};
+
+namespace yuv
+{
+/* ============================================================================
+ * YUV => RGB fixed-point conversion, shared by host and device kernels.
+ * ========================================================================== */
+/** BT.601 full range, coefficients of the CUDA YUYV kernels in 6 bits fixed
+ * point. All intermediate values fit in int16 (SIMD lanes).
+ */
+static const int kBits = 6;
+static const int kVR = 90;     // 1.4065
+static const int kUG = 22;     // 0.3455
+static const int kVG = 46;     // 0.7169
+static const int kUB = 114;    // 1.7790
+
+TFRT_HOST_DEVICE inline int clamp_u8(int v) {
+    v >>= kBits;
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+/** Conversion of one pixel (u, v centered on 0), outputs in [0, 255]. */
+TFRT_HOST_DEVICE inline void to_rgb(int y, int u, int v, int& r, int& g, int& b)
+{
+    const int y64 = (y << kBits) + (1 << (kBits - 1));
+    r = clamp_u8(y64 + kVR * v);
+    g = clamp_u8(y64 - kUG * u - kVG * v);
+    b = clamp_u8(y64 + kUB * u);
+}
+
+/** Planes of a YUV frame. */
+struct planes
+{
+    yuv_format  format;
+    const uint8_t*  y;
+    const uint8_t*  u;
+    const uint8_t*  v;
+    size_t  pitch;
+    size_t  uv_pitch;
+    // Distance between chroma samples (2 for NV12 interleaved UV).
+    int  uv_step;
+    int  height;
+};
+/** Planes of a frame. Return false on invalid layout: width must be even, and
+ * height too for 4:2:0 formats.
+ */
+inline bool make_planes(yuv_format format, const uint8_t* input, size_t pitch,
+    size_t width, size_t height, planes& p)
+{
+    if( !input || width == 0 || height == 0 || width % 2 ) {
+        return false;
+    }
+    p.format = format;
+    p.y = input;
+    p.pitch = pitch;
+    p.height = height;
+    p.uv_step = 1;
+    const uint8_t* chroma = input + pitch * height;
+    switch(format) {
+    case yuv_format::yuyv:
+    case yuv_format::uyvy:
+        p.u = p.v = nullptr;
+        p.uv_pitch = 0;
+        return pitch >= width * 2;
+    case yuv_format::nv12:
+        p.u = chroma;
+        p.v = chroma + 1;
+        p.uv_pitch = pitch;
+        p.uv_step = 2;
+        break;
+    case yuv_format::yv12:
+        p.uv_pitch = pitch / 2;
+        p.v = chroma;
+        p.u = chroma + p.uv_pitch * (height / 2);
+        break;
+    case yuv_format::i420:
+        p.uv_pitch = pitch / 2;
+        p.u = chroma;
+        p.v = chroma + p.uv_pitch * (height / 2);
+        break;
+    default:
+        return false;
+    }
+    return pitch >= width && height % 2 == 0;
+}
+/** Samples of the pixel (x, y), u and v centered on 0. 4:2:0 odd rows average
+ * the two nearest chroma rows, as cudaNV12ToRGBA.
+ */
+TFRT_HOST_DEVICE inline void fetch(const planes& p, int x, int y, int& luma, int& u, int& v)
+{
+    if(p.format == yuv_format::yuyv || p.format == yuv_format::uyvy) {
+        const bool uyvy = (p.format == yuv_format::uyvy);
+        const uint8_t* macro = p.y + y * p.pitch + (x >> 1) * 4;
+        luma = macro[(x & 1) * 2 + (uyvy ? 1 : 0)];
+        u = int(macro[uyvy ? 0 : 1]) - 128;
+        v = int(macro[uyvy ? 2 : 3]) - 128;
+        return;
+    }
+    const int cy = y >> 1;
+    const size_t off0 = cy * p.uv_pitch + (x >> 1) * p.uv_step;
+    const size_t off1 = ((y & 1) && cy < p.height / 2 - 1) ? off0 + p.uv_pitch : off0;
+    luma = p.y[y * p.pitch + x];
+    u = ((p.u[off0] + p.u[off1] + 1) >> 1) - 128;
+    v = ((p.v[off0] + p.v[off1] + 1) >> 1) - 128;
+}
+
+}
+}
+
+#endif
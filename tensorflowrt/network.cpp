@@ -15,8 +15,11 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <iomanip>
+#include <cstring>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
@@ -30,10 +33,15 @@
 #include <NVX/nvx.h>
 #include <OVX/UtilityOVX.hpp>
 
+#include <half.hpp>
+
 #include "types.h"
 #include "scope.h"
 #include "network.h"
 #include "tensorflowrt.h"
+#include "tracer.h"
+#include "memory_tracker.h"
+#include "misc/pb_tensors.h"
 
 #include "cuda/cudaHalfPrecision.h"
 #include "cuda/cudaImageNet.h"
@@ -64,12 +72,43 @@ inline nvinfer1::Dims tensor_shape(const tfrt_pb::tensor& t)
     return dims;
 }
 
+/* ============================================================================
+ * tfrt::load_profile
+ * ========================================================================== */
+void load_profile::print(std::ostream& out) const
+{
+    char buf[256];
+    auto line = [&](const char* phase, double ms, const std::string& info) {
+        snprintf(buf, sizeof(buf), "  %-16s %10.2f ms  %s\n", phase, ms, info.c_str());
+        out << buf;
+    };
+    auto mb = [](uint64_t bytes) {
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(2) << bytes / double(1 << 20) << " MB";
+        return oss.str();
+    };
+    line("parse", parse_ms, mb(parse_bytes));
+    line("weights lookup", lookup_ms,
+        std::to_string(lookup_count) + " lookups, " + mb(lookup_bytes));
+    line("graph build", graph_ms, "");
+    line("engine build", engine_ms, "");
+    line("serialize", serialize_ms, mb(model_bytes));
+    line("cache read", cache_read_ms, from_cache ? "hit" : "miss");
+    line("cache write", cache_write_ms, "");
+    line("deserialize", deserialize_ms, "");
+    line("buffers", buffers_ms, "");
+    line("total", total_ms, "");
+}
+
 /* ============================================================================
  * tfrt::network methods.
  * ========================================================================== */
 network::~network()
 {
     // TODO: unique_ptr + custom deleter.
+    memory_tracker::global().release(m_pb_network.get());
+    memory_tracker::global().release(m_nv_context);
+    memory_tracker::global().release(m_nv_engine);
     if(m_nv_engine) {
         m_nv_engine->destroy();
         m_nv_engine = nullptr;
@@ -83,6 +122,7 @@ void network::clear()
 {
     m_pb_network->Clear();
     m_zero_tensors.clear();
+    memory_tracker::global().release(m_pb_network.get());
 }
 tfrt::scope network::scope(nvinfer1::INetworkDefinition* nv_network) const
 {
@@ -96,7 +136,7 @@ tfrt::scope network::scope(nvinfer1::INetworkDefinition* nv_network) const
 const tfrt_pb::tensor& network::create_tensor(
     std::string name, nvinfer1::Dims shape, float val, nvinfer1::DataType dt) const
 {
-    LOG(INFO) << "CREATE tfrt_pb::tensor '" << name << "'. SHAPE: " << dims_str(shape);
+    TFRT_LAYER_LOG << "CREATE tfrt_pb::tensor '" << name << "'. SHAPE: " << dims_str(shape);
     // Create new tensor in the weights collection.
     auto pb_tensor = m_pb_network->add_weights();
     pb_tensor->set_name(name);
@@ -180,7 +220,7 @@ const tfrt_pb::tensor& network::create_tensor(
 const tfrt_pb::tensor& network::create_tensor(
     std::string name, const tfrt::nchw<float>::tensor& t, nvinfer1::DataType dt) const
 {
-    LOG(INFO) << "CREATE tfrt_pb::tensor '" << name << "' with datatype: " << int(dt);
+    TFRT_LAYER_LOG << "CREATE tfrt_pb::tensor '" << name << "' with datatype: " << int(dt);
     // Create new tensor in the weights collection.
     auto pb_tensor = m_pb_network->add_weights();
     pb_tensor->set_name(name);
@@ -205,7 +245,7 @@ const tfrt_pb::tensor& network::create_tensor(
 const tfrt_pb::tensor& network::create_tensor(
     std::string name, const tfrt::chw<float>::tensor& t, nvinfer1::DataType dt) const
 {
-    LOG(INFO) << "CREATE tfrt_pb::tensor '" << name << "' with datatype: " << int(dt);
+    TFRT_LAYER_LOG << "CREATE tfrt_pb::tensor '" << name << "' with datatype: " << int(dt);
     // Create new tensor in the weights collection.
     auto pb_tensor = m_pb_network->add_weights();
     pb_tensor->set_name(name);
@@ -230,7 +270,7 @@ const tfrt_pb::tensor& network::create_tensor(
 const tfrt_pb::tensor& network::create_tensor(
     std::string name, const tfrt::c<float>::tensor& t, nvinfer1::DataType dt) const
 {
-    LOG(INFO) << "CREATE tfrt_pb::tensor '" << name << "' with datatype: " << int(dt);
+    TFRT_LAYER_LOG << "CREATE tfrt_pb::tensor '" << name << "' with datatype: " << int(dt);
     // Create new tensor in the weights collection.
     auto pb_tensor = m_pb_network->add_weights();
     pb_tensor->set_name(name);
@@ -255,14 +295,16 @@ const tfrt_pb::tensor& network::create_tensor(
 const tfrt_pb::tensor& network::tensor_by_name(std::string name, nvinfer1::Dims wshape) const
 {
     // Best search algorithm ever!
-    for(int i = 0 ; i < m_pb_network->weights_size() ; ++i) {
-        const tfrt_pb::tensor& tensor = m_pb_network->weights(i);
-        if(tensor.name() == name) {
-            DLOG(INFO) << "FOUND tfrt_pb::tensor '" << name << "'. "
-                << "SHAPE: " << dims_str(tensor_shape(tensor)) << " "
-                << "SIZE: " << tensor.size() << " PTR: " << &tensor;
-            return tensor;
-        }
+    const uint64_t t0 = trace::now_ns();
+    const tfrt_pb::tensor* ptensor = tfrt::find_tensor(*m_pb_network, name);
+    m_load_profile.lookup_ms += (trace::now_ns() - t0) * 1e-6;
+    m_load_profile.lookup_count++;
+    if(ptensor) {
+        m_load_profile.lookup_bytes += ptensor->data().size();
+        DLOG(INFO) << "FOUND tfrt_pb::tensor '" << name << "'. "
+            << "SHAPE: " << dims_str(tensor_shape(*ptensor)) << " "
+            << "SIZE: " << ptensor->size() << " PTR: " << ptensor;
+        return *ptensor;
     }
     // Create new tensor if specified.
     if (m_missing_tensors) {
@@ -432,6 +474,92 @@ void network::create_missing_tensors(bool v)
 {
     m_missing_tensors = v;
 }
+bool network::enable_profiler() const
+{
+    return m_enable_profiler;
+}
+network& network::enable_profiler(bool v)
+{
+    m_enable_profiler = v;
+    return *this;
+}
+bool network::fused_preprocessing() const
+{
+    return m_fused_preprocessing;
+}
+network& network::fused_preprocessing(bool v)
+{
+    m_fused_preprocessing = v;
+    return *this;
+}
+tfrt::resize_mode network::resize_mode() const
+{
+    return m_resize_mode;
+}
+network& network::resize_mode(tfrt::resize_mode mode)
+{
+    m_resize_mode = mode;
+    return *this;
+}
+bool network::letterbox_resize() const
+{
+    return m_letterbox_resize;
+}
+network& network::letterbox_resize(bool v, uint8_t pad_value)
+{
+    m_letterbox_resize = v;
+    m_letterbox_pad = pad_value;
+    return *this;
+}
+const tfrt::letterbox& network::input_letterbox(size_t batch_idx) const
+{
+    CHECK_LT(batch_idx, m_input_letterboxes.size()) << "Invalid batch index.";
+    return m_input_letterboxes[batch_idx];
+}
+bool network::half_bindings() const
+{
+    return m_half_bindings && this->datatype() == nvinfer1::DataType::kHALF;
+}
+network& network::half_bindings(bool v)
+{
+    m_half_bindings = v;
+    return *this;
+}
+bool network::tiling() const
+{
+    return m_tiles_x > 0 && m_tiles_y > 0;
+}
+network& network::tiling(int tiles_x, int tiles_y, float overlap)
+{
+    CHECK(overlap >= 0.0f && overlap < 1.0f) << "Invalid tiles overlap: " << overlap;
+    m_tiles_x = std::max(tiles_x, 0);
+    m_tiles_y = std::max(tiles_y, 0);
+    m_tile_overlap = overlap;
+    // Geometry re-computed at next frame.
+    m_tile_grid = tfrt::tile_grid();
+    return *this;
+}
+const tfrt::tile_grid& network::tile_grid(int width, int height)
+{
+    if(!m_tile_grid.valid(width, height)) {
+        CHECK(this->tiling()) << "Tiled inference is not enabled.";
+        CHECK_LE(size_t(m_tiles_x * m_tiles_y), m_max_batch_size)
+            << "Number of tiles larger than the max batch size.";
+        const auto& oshape = m_cuda_outputs.at(0).shape;
+        m_tile_grid = tfrt::make_tile_grid(width, height, m_tiles_x, m_tiles_y,
+            m_tile_overlap, oshape.w(), oshape.h());
+        CHECK(m_tile_grid.size()) << "Invalid tiles geometry for frame: " << width << "x" << height;
+        LOG(INFO) << LOG_GIE << "Tiles grid " << m_tiles_x << "x" << m_tiles_y << " of "
+            << m_tile_grid.tile_width << "x" << m_tile_grid.tile_height << " pixels, frame "
+            << width << "x" << height << ", stitched map "
+            << m_tile_grid.map_width << "x" << m_tile_grid.map_height << ".";
+    }
+    return m_tile_grid;
+}
+const tfrt::profiler& network::profiler() const
+{
+    return m_gie_profiler;
+}
 
 tfrt::cuda_tensor* network::find_cuda_output(const std::string& name) const
 {
@@ -446,6 +574,15 @@ tfrt::cuda_tensor* network::find_cuda_output(const std::string& name) const
     LOG(WARNING) << "Could not find CUDA output tensor named: \'" << name << "\'";
     return nullptr;
 }
+tfrt::histogram& network::inference_latency()
+{
+    if(!m_inference_latency) {
+        m_inference_latency = &tfrt::metrics::registry::global().histogram(
+            "tfrt_network_inference_seconds{network=\"" + this->name() + "\"}",
+            "Synchronous network inference latency.");
+    }
+    return *m_inference_latency;
+}
 void network::cuda_output(tfrt::cuda_tensor t, size_t idx)
 {
     DLOG(INFO) << "SET a new CUDA output tensor.";
@@ -453,8 +590,10 @@ void network::cuda_output(tfrt::cuda_tensor t, size_t idx)
         // Update name and binding index.
         t.name = m_cuda_outputs[idx].name;
         t.binding_index = m_cuda_outputs[idx].binding_index;
-        // Set up the new output.
-        m_cached_bindings[t.binding_index] = t.cuda;
+        // Set up the new output (fp16 bindings: converted into it).
+        if(!m_cuda_outputs_half[idx].is_allocated()) {
+            m_cached_bindings[t.binding_index] = t.cuda;
+        }
         m_cuda_outputs[idx] = std::move(t);
     }
     else {
@@ -490,21 +629,51 @@ bool network::load_weights(const std::string& filename)
     }
     else {
         LOG(INFO) << "Loading network parameters and weights from: " << filename;
-        return parse_protobuf(filename, m_pb_network.get());
+        return this->parse_weights(filename, m_pb_network.get());
+    }
+}
+bool network::parse_weights(const std::string& filename, google::protobuf::MessageLite* message,
+    const std::function<void()>& extract_network)
+{
+    TFRT_TRACE_SCOPE("network::parse", "load");
+    const uint64_t t0 = trace::now_ns();
+    // Previous weights store no longer accounted (network message replaced).
+    memory_tracker::global().release(m_pb_network.get());
+    bool r = parse_protobuf(filename, message);
+    if(extract_network) {
+        extract_network();
+    }
+    m_load_profile.parse_ms = (trace::now_ns() - t0) * 1e-6;
+    CHECK(m_pb_network) << "No network description in protobuf file: " << filename;
+    // Weights store accounting.
+    uint64_t bytes = 0;
+    for(int i = 0 ; i < m_pb_network->weights_size() ; ++i) {
+        bytes += m_pb_network->weights(i).data().size();
     }
+    memory_tracker::global().allocate(m_pb_network.get(), bytes,
+        memory_tracker::kWeights, "weights");
+    m_load_profile.parse_bytes = bytes;
+    return r;
 }
 void network::clear_weights()
 {
     m_pb_network->clear_weights();
+    memory_tracker::global().release(m_pb_network.get());
 }
 
 bool network::load(std::string filename, nvinfer1::DimsCHW _inshape)
 {
+    // Allocations attributed to this network.
+    memory_owner owner{this->name()};
+    TFRT_TRACE_SCOPE("network::load", "load");
+    m_load_profile = tfrt::load_profile();
+    const uint64_t t0 = trace::now_ns();
     // Serialize model.
     // std::stringstream model_stream;
     // nvinfer1::IHostMemory* model_stream{nullptr};
     std::string model_buffer;
     this->serialize_model(filename, model_buffer, true, _inshape);
+    uint64_t t1 = trace::now_ns();
 
     // Inference runtime + engine + execution context.
     nvinfer1::IRuntime* infer = nvinfer1::createInferRuntime(m_gie_logger);
@@ -531,9 +700,16 @@ bool network::load(std::string filename, nvinfer1::DimsCHW _inshape)
         context->setProfiler(&m_gie_profiler);
     }
     LOG(INFO) << LOG_GIE << "CUDA engine context initialized with #bindings: " << engine->getNbBindings();
+    m_load_profile.deserialize_ms = (trace::now_ns() - t1) * 1e-6;
+    t1 = trace::now_ns();
     this->m_nv_infer = infer;
     this->m_nv_engine = engine;
     this->m_nv_context = context;
+    // Engine (serialized size) and workspace (upper bound) accounting.
+    memory_tracker::global().allocate(engine, model_buffer.size(),
+        memory_tracker::kEngine, "engine");
+    memory_tracker::global().allocate(context, m_workspace_size,
+        memory_tracker::kWorkspace, "context");
 
     // Cached binding pointers.
     nvinfer1::DimsNCHW shape;
@@ -554,9 +730,26 @@ bool network::load(std::string filename, nvinfer1::DimsCHW _inshape)
         << dims_str(shape) << " | "<< input_name(true);
     m_cuda_input.binding_index = input_idx;
     m_cached_bindings[input_idx] = m_cuda_input.cuda;
+    // fp16 input binding: the float input is only used for staging.
+    m_cuda_input_half = std::move(tfrt::cuda_tensor_u16());
+    if(engine->getBindingDataType(input_idx) == nvinfer1::DataType::kHALF) {
+        LOG(INFO) << LOG_GIE << "Input binding '" << input_name(true) << "' in half precision.";
+        m_cuda_input_half = std::move(tfrt::cuda_tensor_u16(input_name(true) + "_fp16", shape));
+        r = m_cuda_input_half.allocate();
+        CHECK(r) << LOG_GIE << "Could not allocate memory for CUDA fp16 input: "
+            << dims_str(shape) << " | "<< input_name(true);
+        m_cuda_input_half.binding_index = input_idx;
+        m_cached_bindings[input_idx] = m_cuda_input_half.cuda;
+    }
+    m_cuda_rois = std::move(tfrt::cuda_tensor_i32("rois",
+        nvinfer1::DimsNCHW{int(m_max_batch_size), 4, 1, 1}));
+    r = m_cuda_rois.allocate();
+    CHECK(r) << LOG_GIE << "Could not allocate memory for CUDA ROIs.";
+    m_input_letterboxes.assign(m_max_batch_size, tfrt::make_stretch(inshape.w(), inshape.h()));
 
     // CUDA allocate outputs memory.
     m_cuda_outputs.clear();
+    m_cuda_outputs_half.clear();
     for(size_t i = 0 ; i < outputs_name.size() ; ++i) {
         const int output_idx = engine->getBindingIndex(outputs_name[i].c_str());
         if(output_idx > -1) {
@@ -572,12 +765,29 @@ bool network::load(std::string filename, nvinfer1::DimsCHW _inshape)
                 << dims_str(shape) << " | "<< outputs_name[i];
             m_cuda_outputs.back().binding_index = output_idx;
             m_cached_bindings[output_idx] = m_cuda_outputs.back().cuda;
+            // fp16 output binding, converted into the float tensor.
+            m_cuda_outputs_half.push_back(tfrt::cuda_tensor_u16());
+            if(engine->getBindingDataType(output_idx) == nvinfer1::DataType::kHALF) {
+                LOG(INFO) << LOG_GIE << "Output binding '" << outputs_name[i] << "' in half precision.";
+                tfrt::cuda_tensor_u16& t = m_cuda_outputs_half.back();
+                t = std::move(tfrt::cuda_tensor_u16(outputs_name[i] + "_fp16", shape));
+                r = t.allocate();
+                CHECK(r) << LOG_GIE << "Could not allocate memory for CUDA fp16 output: "
+                    << dims_str(shape) << " | "<< outputs_name[i];
+                t.binding_index = output_idx;
+                m_cached_bindings[output_idx] = t.cuda;
+            }
         }
         else {
             LOG(ERROR) << LOG_GIE << "Could not find binding index for output tensor: " << outputs_name[i];
         }
     }
     CHECK(m_cuda_outputs.size()) << LOG_GIE << "No output found in the network.";
+    m_load_profile.buffers_ms = (trace::now_ns() - t1) * 1e-6;
+    m_load_profile.total_ms = (trace::now_ns() - t0) * 1e-6;
+    std::ostringstream profile;
+    m_load_profile.print(profile);
+    LOG(INFO) << LOG_GIE << "Network '" << this->name() << "' loaded.\n" << profile.str();
     return true;
 }
 
@@ -590,7 +800,9 @@ std::string network::filename_cached_model(const std::string& filename) const
     auto inshape = this->input_shape();
     std::ostringstream  filename_cache;
     filename_cache << filename << "."  << m_max_batch_size
-        << "x" << inshape.c() << "x" << inshape.h() << "x" << inshape.w() << ".cache";
+        << "x" << inshape.c() << "x" << inshape.h() << "x" << inshape.w()
+        << (m_fused_preprocessing ? ".fused" : "")
+        << (this->half_bindings() ? ".half" : "") << ".cache";
     return filename_cache.str();
 }
 bool network::serialize_model(
@@ -599,6 +811,7 @@ bool network::serialize_model(
 {
     // Load model parameters and weights.
     this->load_weights(filename);
+    this->read_input_normalization();
     // Update input shape, if necessary.
     this->input_shape(inshape);
     LOG(INFO) << LOG_GIE << "Network with input shape: "<< dims_str(inshape);
@@ -608,6 +821,7 @@ bool network::serialize_model(
     if(caching && filename.length()) {
         LOG(INFO) << LOG_GIE << "Try reading cached model from: "<< filename_cache;
         // Successful read of cached file => load and return.
+        const uint64_t t0 = trace::now_ns();
         std::ifstream model_cached(filename_cache);
         if(model_cached) {
             // Set model stream back to beginning.
@@ -618,6 +832,9 @@ bool network::serialize_model(
             model_cached.close();
             // UGLY copy!!!
             model_buffer = model_stream.str();
+            m_load_profile.from_cache = true;
+            m_load_profile.model_bytes = model_buffer.size();
+            m_load_profile.cache_read_ms = (trace::now_ns() - t0) * 1e-6;
             return true;
         }
         LOG(WARNING) << LOG_GIE << "Could not read cached model. Back to th' old way.";
@@ -639,13 +856,16 @@ bool network::serialize_model(
     model_buffer.assign((char*)nv_model_stream->data(), nv_model_stream->size());
     nv_model_stream->destroy();
     #endif
+    m_load_profile.model_bytes = model_buffer.size();
 
     if(caching && filename.length()) {
         LOG(INFO) << LOG_GIE << "Writing cached model to: " << filename_cache;
+        const uint64_t t0 = trace::now_ns();
         std::ofstream model_cached;
         model_cached.open(filename_cache);
         model_cached << model_buffer;
         model_cached.close();
+        m_load_profile.cache_write_ms = (trace::now_ns() - t0) * 1e-6;
         // model_stream.seekg(0, model_stream.beg);
     }
     return true;
@@ -664,8 +884,15 @@ bool network::profile_model(nvinfer1::IHostMemory** nv_model_stream)
 
     // Build the network.
     LOG(INFO) << LOG_GIE << "Building network from scratch!";
-    auto net = this->build(this->scope(network));
+    uint64_t t0 = trace::now_ns();
+    const double lookup_ms = m_load_profile.lookup_ms;
+    nvinfer1::ITensor* net;
+    {
+        TFRT_TRACE_SCOPE("network::graph", "load");
+        net = this->build(this->scope(network));
+    }
     CHECK_NOTNULL(net);
+    m_load_profile.graph_ms = (trace::now_ns() - t0) * 1e-6 - (m_load_profile.lookup_ms - lookup_ms);
     LOG(INFO) << LOG_GIE << "Network successfully built."
         << " #Inputs: " << network->getNbInputs() << " #Outputs: " << network->getNbOutputs();
 
@@ -688,26 +915,192 @@ bool network::profile_model(nvinfer1::IHostMemory** nv_model_stream)
     builder->setHalf2Mode(useFP16);
     // builder->setHalf2Mode(builder->platformHasFastFp16());
 
-    nvinfer1::ICudaEngine* engine = builder->buildCudaEngine(*network);
+    t0 = trace::now_ns();
+    nvinfer1::ICudaEngine* engine;
+    {
+        TFRT_TRACE_SCOPE("network::engine", "load");
+        engine = builder->buildCudaEngine(*network);
+    }
     CHECK_NOTNULL(engine);
+    m_load_profile.engine_ms = (trace::now_ns() - t0) * 1e-6;
     network->destroy();
     // Serialize the engine, then close everything down
     LOG(INFO) << LOG_GIE << "Serializing the engine.";
+    t0 = trace::now_ns();
     #ifndef NV_TENSORRT_MAJOR   // TensorRT 1
     engine->serialize(**nv_model_stream);
     #else   // TensorRT 2
     (*nv_model_stream) = engine->serialize();
     #endif
+    m_load_profile.serialize_ms = (trace::now_ns() - t0) * 1e-6;
     engine->destroy();
     builder->destroy();
     return true;
 }
 
+/* ============================================================================
+ * Input preprocessing.
+ * ========================================================================== */
+void network::read_input_normalization()
+{
+    // Uniform or per-channel input weights, fp32 or fp16.
+    auto read_weights = [this](const std::string& wname, float* values) {
+        const tfrt_pb::tensor* t = tfrt::find_tensor(*m_pb_network, wname);
+        if(!t || t->size() == 0) {
+            return false;
+        }
+        const bool half = (t->datatype() == tfrt_pb::HALF);
+        for(int c = 0 ; c < 3 ; ++c) {
+            const size_t idx = t->size() >= 3 ? c : 0;
+            if(half) {
+                half_float::half h;
+                std::memcpy(&h, t->data().data() + idx * sizeof(h), sizeof(h));
+                values[c] = float(h);
+            }
+            else {
+                std::memcpy(&values[c], t->data().data() + idx * sizeof(float), sizeof(float));
+            }
+        }
+        return true;
+    };
+    for(int c = 0 ; c < 3 ; ++c) {
+        m_input_scale[c] = 1.0f;
+        m_input_shift[c] = 0.0f;
+    }
+    const std::string iname = this->input_name(true);
+    bool r = read_weights(iname + "/scale", m_input_scale);
+    r = read_weights(iname + "/shift", m_input_shift) || r;
+    if(r) {
+        LOG(INFO) << LOG_GIE << "Input normalization: scale " << m_input_scale[0]
+            << " | shift " << m_input_shift[0]
+            << (m_fused_preprocessing ? " (fused in preprocessing)." : ".");
+    }
+}
+void* network::input_binding(size_t batch_idx) const
+{
+    if(this->half_input()) {
+        return m_cuda_input_half.cuda_ptr(batch_idx);
+    }
+    return m_cuda_input.cuda_ptr(batch_idx);
+}
+void network::input_to_half(size_t batch_size)
+{
+    if(!this->half_input()) {
+        return;
+    }
+    TFRT_TRACE_SCOPE("network::input_to_half");
+    const auto& shape = m_cuda_input.shape;
+    CUDA(cuda_float2half_device(m_cuda_input.cuda, m_cuda_input_half.cuda,
+        batch_size * shape.c() * shape.h() * shape.w()));
+}
+void network::outputs_to_float(size_t batch_size, cudaStream_t stream)
+{
+    TFRT_TRACE_SCOPE("network::outputs_to_float");
+    for(size_t i = 0 ; i < m_cuda_outputs_half.size() ; ++i) {
+        const tfrt::cuda_tensor_u16& t = m_cuda_outputs_half[i];
+        if(t.is_allocated()) {
+            CUDA(cuda_half2float_device(t.cuda, m_cuda_outputs[i].cuda,
+                batch_size * t.shape.c() * t.shape.h() * t.shape.w(), stream));
+        }
+    }
+}
+cudaError_t network::preprocess(const nvx_image_patch& image, size_t batch_idx,
+    cudaStream_t stream)
+{
+    TFRT_TRACE_SCOPE("network::preprocess");
+    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
+    const float* scale = m_fused_preprocessing ? m_input_scale : nullptr;
+    const float* shift = m_fused_preprocessing ? m_input_shift : nullptr;
+    if(m_letterbox_resize) {
+        const tfrt::letterbox lb = tfrt::make_letterbox(
+            image.addr.dim_x, image.addr.dim_y, inshape.w(), inshape.h());
+        m_input_letterboxes[batch_idx] = lb;
+        return cuda_rgba_to_chw_letterbox(image.cuda, this->input_binding(batch_idx),
+            image.addr.dim_x, image.addr.dim_y, image.addr.stride_x, image.addr.stride_y,
+            inshape.w(), inshape.h(), lb, m_letterbox_pad, m_resize_mode,
+            scale, shift, this->half_input(), stream);
+    }
+    m_input_letterboxes[batch_idx] = tfrt::make_stretch(inshape.w(), inshape.h());
+    return cuda_rgba_to_chw_normalize(image.cuda, this->input_binding(batch_idx),
+        image.addr.dim_x, image.addr.dim_y, image.addr.stride_x, image.addr.stride_y,
+        inshape.w(), inshape.h(), m_resize_mode, scale, shift, this->half_input(), stream);
+}
+cudaError_t network::preprocess(float* rgba, uint32_t height, uint32_t width)
+{
+    TFRT_TRACE_SCOPE("network::preprocess");
+    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
+    cudaError_t r;
+    if(m_letterbox_resize) {
+        m_input_letterboxes[0] = tfrt::make_letterbox(width, height, inshape.w(), inshape.h());
+        r = cudaPreImageNetLetterbox((float4*)rgba, width, height, m_cuda_input.cuda,
+            inshape.w(), inshape.h(), m_input_letterboxes[0], float(m_letterbox_pad));
+    }
+    else {
+        m_input_letterboxes[0] = tfrt::make_stretch(inshape.w(), inshape.h());
+        r = cudaPreImageNet((float4*)rgba, width, height,
+            m_cuda_input.cuda, inshape.w(), inshape.h());
+    }
+    if(r == cudaSuccess && m_fused_preprocessing) {
+        r = cuda_chw_normalize(m_cuda_input.cuda, m_cuda_input.shape.w(),
+            m_cuda_input.shape.h(), m_input_scale, m_input_shift);
+    }
+    if(r == cudaSuccess) {
+        this->input_to_half(1);
+    }
+    return r;
+}
+cudaError_t network::preprocess(tfrt::yuv_format format, const uint8_t* frame, size_t pitch,
+    uint32_t height, uint32_t width, size_t batch_idx, cudaStream_t stream)
+{
+    TFRT_TRACE_SCOPE("network::preprocess");
+    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
+    const float* scale = m_fused_preprocessing ? m_input_scale : nullptr;
+    const float* shift = m_fused_preprocessing ? m_input_shift : nullptr;
+    m_input_letterboxes[batch_idx] = tfrt::make_stretch(inshape.w(), inshape.h());
+    return cuda_yuv_to_chw_normalize(format, frame, pitch, width, height,
+        this->input_binding(batch_idx), inshape.w(), inshape.h(), scale, shift,
+        this->half_input(), stream);
+}
+cudaError_t network::preprocess_rois(const nvx_image_patch& image, const int32_t* rois,
+    size_t num_rois, cudaStream_t stream)
+{
+    TFRT_TRACE_SCOPE("network::preprocess_rois");
+    CHECK_LE(num_rois, size_t(m_cuda_input.shape.n())) << "Too many ROIs for the batch size.";
+    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
+    const float* scale = m_fused_preprocessing ? m_input_scale : nullptr;
+    const float* shift = m_fused_preprocessing ? m_input_shift : nullptr;
+    std::copy(rois, rois + num_rois * 4, m_cuda_rois.cpu);
+    std::fill(m_input_letterboxes.begin(), m_input_letterboxes.begin() + num_rois,
+        tfrt::make_stretch(inshape.w(), inshape.h()));
+    return cuda_rgba_rois_to_chw_normalize(image.cuda,
+        image.addr.dim_x, image.addr.dim_y, image.addr.stride_x, image.addr.stride_y,
+        m_cuda_rois.cuda, num_rois, this->input_binding(0), inshape.w(), inshape.h(),
+        m_resize_mode, scale, shift, this->half_input(), stream);
+}
+
 /* ============================================================================
  * Inference methods.
  * ========================================================================== */
+const tfrt::tile_grid& network::inference_tiles(const nvx_image_patch& image)
+{
+    TFRT_TRACE_SCOPE("network::inference_tiles");
+    tfrt::metrics::timer latency_timer{this->inference_latency()};
+    const tfrt::tile_grid& grid = this->tile_grid(image.addr.dim_x, image.addr.dim_y);
+    const size_t num_tiles = grid.size();
+    cudaError_t r = this->preprocess_rois(image, grid.rois.data(), num_tiles);
+    CHECK_EQ(r, cudaSuccess) << "Failed to crop tiles to network input shape. CUDA error: " << r;
+    {
+        TFRT_TRACE_SCOPE("network::execute");
+        m_nv_context->execute(num_tiles, (void**)m_cached_bindings.data());
+        this->outputs_to_float(num_tiles);
+    }
+    CUDA(cudaDeviceSynchronize());
+    return grid;
+}
 void network::inference(const tfrt::nchw<float>::tensor& tensor)
 {
+    TFRT_TRACE_SCOPE("network::inference");
+    tfrt::metrics::timer latency_timer{this->inference_latency()};
     DLOG(INFO) << "Inference on the neural network:" << this->name();
     // Check tensor dimensions.
     CHECK_EQ(tensor.dimension(1), m_cuda_input.shape.c())
@@ -719,25 +1112,55 @@ void network::inference(const tfrt::nchw<float>::tensor& tensor)
     CHECK_LE(tensor.dimension(0), m_cuda_input.shape.n())
         << "Input tensor with wrong batch dimension.";
     std::memcpy(m_cuda_input.cpu, tensor.data(), tensor.dimension(0) * m_cuda_input.shape.c() * m_cuda_input.shape.h() * m_cuda_input.shape.w() * sizeof(float));
+    std::fill(m_input_letterboxes.begin(), m_input_letterboxes.begin() + tensor.dimension(0),
+        tfrt::make_stretch(m_cuda_input.shape.w(), m_cuda_input.shape.h()));
+    if(m_fused_preprocessing) {
+        for(long n = 0 ; n < tensor.dimension(0) ; ++n) {
+            CUDA(cuda_chw_normalize(m_cuda_input.cuda_ptr(n), m_cuda_input.shape.w(),
+                m_cuda_input.shape.h(), m_input_scale, m_input_shift));
+        }
+    }
+    this->input_to_half(tensor.dimension(0));
     CUDA(cudaDeviceSynchronize());
+    TFRT_TRACE_SCOPE("network::execute");
     m_nv_context->execute(tensor.dimension(0), (void**)m_cached_bindings.data());
+    this->outputs_to_float(tensor.dimension(0));
     CUDA(cudaDeviceSynchronize());
 }
 void network::inference(float* rgba, uint32_t height, uint32_t width)
 {
+    TFRT_TRACE_SCOPE("network::inference");
+    tfrt::metrics::timer latency_timer{this->inference_latency()};
     DLOG(INFO) << "Inference on the neural network:" << this->name();
     // Checking inputs!
     CHECK(rgba) << "Invalid image buffer.";
     CHECK(height) << "Invalid image height.";
     CHECK(width) << "Invalid image width.";
     // Downsample and convert to RGB.
-    cudaError_t r = cudaPreImageNet((float4*)rgba, width, height,
-        m_cuda_input.cuda, m_cuda_input.shape.w(), m_cuda_input.shape.h());
+    cudaError_t r = this->preprocess(rgba, height, width);
     CHECK_EQ(r, cudaSuccess) << "Failed to resize image to network input shape. "
         << "CUDA error: " << r;
     // Execute TensorRT network (batch size = 1).
     size_t num_batches = 1;
+    TFRT_TRACE_SCOPE("network::execute");
+    m_nv_context->execute(num_batches, (void**)m_cached_bindings.data());
+    this->outputs_to_float(num_batches);
+}
+void network::inference(tfrt::yuv_format format, const uint8_t* frame, size_t pitch,
+    uint32_t height, uint32_t width)
+{
+    TFRT_TRACE_SCOPE("network::inference");
+    tfrt::metrics::timer latency_timer{this->inference_latency()};
+    DLOG(INFO) << "Inference on the neural network:" << this->name();
+    CHECK(frame) << "Invalid frame buffer.";
+    cudaError_t r = this->preprocess(format, frame, pitch, height, width, 0);
+    CHECK_EQ(r, cudaSuccess) << "Failed to convert YUV frame to network input. "
+        << "CUDA error: " << r;
+    // Execute TensorRT network (batch size = 1).
+    size_t num_batches = 1;
+    TFRT_TRACE_SCOPE("network::execute");
     m_nv_context->execute(num_batches, (void**)m_cached_bindings.data());
+    this->outputs_to_float(num_batches);
 }
 void network::inference(vx_image image)
 {
@@ -752,19 +1175,19 @@ void network::inference(vx_image image)
 }
 void network::inference(const nvx_image_patch& image)
 {
-    cudaError_t r;
-    const auto& img_patch1 = image;
-    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
+    TFRT_TRACE_SCOPE("network::inference");
+    tfrt::metrics::timer latency_timer{this->inference_latency()};
     LOG(INFO) << "Converting RGBA image to CHW format.";
-    r = cuda_rgba_to_chw(img_patch1.cuda, m_cuda_input.cuda_ptr(0),
-        inshape.w(), inshape.h(), img_patch1.addr.stride_x, img_patch1.addr.stride_y);
+    cudaError_t r = this->preprocess(image, 0);
     CHECK_EQ(r, cudaSuccess) << "Failed to convert VX image 0 to CHW format. CUDA error: " << r;
     
     // CUDA(cudaDeviceSynchronize());
     // Execute TensorRT network (batch size = 1).
     size_t num_batches = 1;
     LOG(INFO) << "Executing neural network.";
+    TFRT_TRACE_SCOPE("network::execute");
     m_nv_context->execute(num_batches, (void**)m_cached_bindings.data());
+    this->outputs_to_float(num_batches);
 }
 
 void network::inference(vx_image img1, vx_image img2)
@@ -778,24 +1201,19 @@ void network::inference(vx_image img1, vx_image img2)
 }
 void network::inference(const nvx_image_patch& img1, const nvx_image_patch& img2)
 {
+    TFRT_TRACE_SCOPE("network::inference");
+    tfrt::metrics::timer latency_timer{this->inference_latency()};
     cudaError_t r;
     const auto& img_patch1 = img1;
     const auto& img_patch2 = img2;
-    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
     LOG(INFO) << "Converting RGBA image to CHW format.";
 
-    r = cuda_rgba_to_chw_resize(img_patch1.cuda, m_cuda_input.cuda_ptr(0),
-        img_patch1.addr.dim_x, img_patch1.addr.dim_y, 
-        img_patch1.addr.stride_x, img_patch1.addr.stride_y,
-        inshape.w(), inshape.h());
+    r = this->preprocess(img_patch1, 0);
     // r = cuda_rgba_to_chw(img_patch1.cuda, m_cuda_input.cuda_ptr(0),
     //     inshape.w(), inshape.h(), img_patch1.addr.stride_x, img_patch1.addr.stride_y);
     CHECK_EQ(r, cudaSuccess) << "Failed to convert VX image 0 to CHW format. CUDA error: " << r;
 
-    r = cuda_rgba_to_chw_resize(img_patch2.cuda, m_cuda_input.cuda_ptr(1),
-        img_patch2.addr.dim_x, img_patch2.addr.dim_y, 
-        img_patch2.addr.stride_x, img_patch2.addr.stride_y,
-        inshape.w(), inshape.h());
+    r = this->preprocess(img_patch2, 1);
     // r = cuda_rgba_to_chw(img_patch2.cuda, m_cuda_input.cuda_ptr(1),
     //     inshape.w(), inshape.h(), img_patch2.addr.stride_x, img_patch2.addr.stride_y);
     CHECK_EQ(r, cudaSuccess) << "Failed to convert VX image 1 to CHW format. CUDA error: " << r;
@@ -805,7 +1223,9 @@ void network::inference(const nvx_image_patch& img1, const nvx_image_patch& img2
     // Note: execute use the default CUDA stream, hence should force synchronisation.
     size_t num_batches = 2;
     LOG(INFO) << "Executing neural network.";
+    TFRT_TRACE_SCOPE("network::execute");
     m_nv_context->execute(num_batches, (void**)m_cached_bindings.data());
+    this->outputs_to_float(num_batches);
 }
 
 /* ============================================================================
@@ -814,46 +1234,36 @@ void network::inference(const nvx_image_patch& img1, const nvx_image_patch& img2
 void network::inference_async(const nvx_image_patch& img1, 
     const nvx_image_patch& img2, cudaStream_t stream)
 {
+    TFRT_TRACE_SCOPE("network::inference_async");
     cudaError_t r;
     const auto& img_patch1 = img1;
     const auto& img_patch2 = img2;
-    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
     LOG(INFO) << "Enqueue CUDA convertion RGBA to CHW.";
     
-    r = cuda_rgba_to_chw_resize(img_patch1.cuda, m_cuda_input.cuda_ptr(0),
-        img_patch1.addr.dim_x, img_patch1.addr.dim_y, 
-        img_patch1.addr.stride_x, img_patch1.addr.stride_y,
-        inshape.w(), inshape.h(), stream);
+    r = this->preprocess(img_patch1, 0, stream);
     CHECK_EQ(r, cudaSuccess) << "FAILED to convert VX img 0 to CHW format. CUDA error: " << r;
-    r = cuda_rgba_to_chw_resize(img_patch2.cuda, m_cuda_input.cuda_ptr(1),
-        img_patch2.addr.dim_x, img_patch2.addr.dim_y, 
-        img_patch2.addr.stride_x, img_patch2.addr.stride_y,
-        inshape.w(), inshape.h(), stream);
+    r = this->preprocess(img_patch2, 1, stream);
     CHECK_EQ(r, cudaSuccess) << "FAILED to convert VX img 1 to CHW format. CUDA error: " << r;
     // Enqueue Network inference.
     size_t num_batches = 2;
     LOG(INFO) << "Enqueue neural network.";
+    TFRT_TRACE_SCOPE("network::enqueue");
     m_nv_context->enqueue(num_batches, (void**)m_cached_bindings.data(), stream, nullptr);
+    this->outputs_to_float(num_batches, stream);
 }
 void network::inference_async(vx_image img1, vx_image img2, cudaStream_t stream)
 {
+    TFRT_TRACE_SCOPE("network::inference_async");
     cudaError_t r;
-    const nvinfer1::DimsNCHW& inshape{m_cuda_input.shape};
     // Async patch creation???
     DLOG(INFO) << "Enqueue CUDA convertion RGBA to CHW.";
     
     // Try to speed up a bit by enqueuing directly the convertion.
     nvx_image_patch img_patch1{img1, VX_READ_ONLY, NVX_MEMORY_TYPE_CUDA};
     nvx_image_patch img_patch2{img2, VX_READ_ONLY, NVX_MEMORY_TYPE_CUDA};
-    r = cuda_rgba_to_chw_resize(img_patch1.cuda, m_cuda_input.cuda_ptr(0),
-        img_patch1.addr.dim_x, img_patch1.addr.dim_y, 
-        img_patch1.addr.stride_x, img_patch1.addr.stride_y,
-        inshape.w(), inshape.h(), stream);
+    r = this->preprocess(img_patch1, 0, stream);
     CHECK_EQ(r, cudaSuccess) << "FAILED to convert VX img 0 to CHW format. CUDA error: " << r;
-    r = cuda_rgba_to_chw_resize(img_patch2.cuda, m_cuda_input.cuda_ptr(1),
-        img_patch2.addr.dim_x, img_patch2.addr.dim_y, 
-        img_patch2.addr.stride_x, img_patch2.addr.stride_y,
-        inshape.w(), inshape.h(), stream);
+    r = this->preprocess(img_patch2, 1, stream);
     CHECK_EQ(r, cudaSuccess) << "FAILED to convert VX img 1 to CHW format. CUDA error: " << r;
     
     // Event used to ensure the convertion has been properly done.
@@ -865,7 +1275,9 @@ void network::inference_async(vx_image img1, vx_image img2, cudaStream_t stream)
     // Enqueue Network inference.
     size_t num_batches = 2;
     DLOG(INFO) << "Enqueue neural network.";
+    TFRT_TRACE_SCOPE("network::enqueue");
     m_nv_context->enqueue(num_batches, (void**)m_cached_bindings.data(), stream, nullptr);
+    this->outputs_to_float(num_batches, stream);
     // Block until successful copy of inputs.
     cudaEventSynchronize(net_input_copy);
     cudaEventDestroy(net_input_copy); 
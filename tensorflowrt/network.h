@@ -15,6 +15,7 @@
 #ifndef TFRT_NETWORK_H
 #define TFRT_NETWORK_H
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <sstream>
@@ -29,9 +30,14 @@
 
 #include "tfrt_jetson.h"
 #include "network.pb.h"
+#include "profiler.h"
+#include "metrics.h"
 #include "cuda/cudaMappedMemory.h"
 #include "cuda/cudaCHWImage.h"
 #include "misc/std_make_unique.h"
+#include "misc/resampling.h"
+#include "misc/tiling.h"
+#include "misc/yuv.h"
 
 namespace tfrt
 {
@@ -61,6 +67,35 @@ inline nvinfer1::ITensor* find_end_point(tfrt::map_tensor* end_points, const std
 }
 
 
+/* ============================================================================
+ * tfrt::load_profile
+ * ========================================================================== */
+/** Build-time profile of network::load: timings (ms) and sizes (bytes) of
+ * every phase, to optimise cold start. Graph build time excludes the weights
+ * lookups, reported separately.
+ */
+struct load_profile
+{
+    double  parse_ms{0};            // Protobuf weights parsing.
+    uint64_t  parse_bytes{0};       // Weights bytes parsed.
+    double  lookup_ms{0};           // Weights lookups (tensor_by_name).
+    uint64_t  lookup_count{0};
+    uint64_t  lookup_bytes{0};
+    double  graph_ms{0};            // TF-RT => TensorRT graph construction.
+    double  engine_ms{0};           // TensorRT engine build and optimisation.
+    double  serialize_ms{0};        // Engine serialization.
+    uint64_t  model_bytes{0};       // Serialized model size.
+    bool  from_cache{false};
+    double  cache_read_ms{0};
+    double  cache_write_ms{0};
+    double  deserialize_ms{0};      // Engine deserialization + context.
+    double  buffers_ms{0};          // Input / outputs allocation.
+    double  total_ms{0};
+
+    /** Print the phases breakdown. */
+    void print(std::ostream& out) const;
+};
+
 /* ============================================================================
  * tfrt::network
  * ========================================================================== */
@@ -73,12 +108,17 @@ public:
     /** Create network, specifying the name and the datatype.
      */
     network(std::string name) :
+        m_gie_profiler{name},
         // m_pb_network(new tfrt_pb::network()),
         m_pb_network(std::make_unique<tfrt_pb::network>()),
         m_nv_infer{nullptr}, m_nv_engine{nullptr}, m_nv_context{nullptr},
         m_max_batch_size{2}, m_workspace_size{16 << 20},
-        m_enable_profiler{false}, m_enable_debug{false},
-        m_missing_tensors{false}
+        m_enable_profiler{false}, m_enable_debug{false}, m_half_bindings{false},
+        m_missing_tensors{false}, m_inference_latency{nullptr},
+        m_fused_preprocessing{false}, m_resize_mode{tfrt::resize_mode::nearest},
+        m_letterbox_resize{false}, m_letterbox_pad{128},
+        m_tiles_x{0}, m_tiles_y{0}, m_tile_overlap{0.0f},
+        m_input_scale{1.0f, 1.0f, 1.0f}, m_input_shift{0.0f, 0.0f, 0.0f}
     {
         this->name(name);
     }
@@ -117,6 +157,65 @@ public:
     // Create missing tensors?
     bool create_missing_tensors() const;
     void create_missing_tensors(bool v);
+    /** Fused input preprocessing: the input normalization (shift + scale
+     * weights) is applied by the RGBA => CHW conversion, and the scaling layer
+     * is removed from the graph. To set before loading the network.
+     */
+    bool fused_preprocessing() const;
+    network& fused_preprocessing(bool v);
+    /** Resampling of RGBA images to the input shape: nearest (default),
+     * bilinear or area (anti-aliased downscaling of camera frames).
+     */
+    tfrt::resize_mode resize_mode() const;
+    network& resize_mode(tfrt::resize_mode mode);
+    /** Aspect preserving resize of RGBA images (letterbox), padded with the
+     * pad_value pixel, instead of stretching. The placement of the image in
+     * every batch slot is recorded (see input_letterbox), e.g. for mapping
+     * detections back to the source image.
+     */
+    bool letterbox_resize() const;
+    network& letterbox_resize(bool v, uint8_t pad_value=128);
+    /** Placement of the last image preprocessed in a batch slot. */
+    const tfrt::letterbox& input_letterbox(size_t batch_idx=0) const;
+    /** Half precision input and outputs bindings of kHALF networks: the
+     * preprocessing writes fp16 directly into the input, and fp16 outputs are
+     * converted on the device into the float output tensors read by the
+     * post-processing. To set before loading (building) the network; part of
+     * the cached engine filename.
+     */
+    bool half_bindings() const;
+    network& half_bindings(bool v);
+    /** Enqueue the device conversion of the fp16 output bindings of the first
+     * batch_size slots into the float output tensors (no-op with float
+     * bindings). Done after every execution of the engine.
+     */
+    void outputs_to_float(size_t batch_size, cudaStream_t stream=0);
+    /** Tiled inference of high resolution frames: tiles_x x tiles_y tiles,
+     * overlapping by a fraction of the tile size, are resized to the input
+     * shape and run as a single batch (at most the max batch size). Disabled
+     * with zero tiles.
+     */
+    bool tiling() const;
+    network& tiling(int tiles_x, int tiles_y, float overlap=0.25f);
+    /** Tiles geometry of a frame resolution (stitching with the resolution
+     * of the first output), computed once and cached.
+     */
+    const tfrt::tile_grid& tile_grid(int width, int height);
+    /** Per-channel (RGB) input normalization x * scale + shift, read at load. */
+    const float* input_scale() const {
+        return m_input_scale;
+    }
+    const float* input_shift() const {
+        return m_input_shift;
+    }
+    // Layers profiler. To enable before loading the network.
+    bool enable_profiler() const;
+    network& enable_profiler(bool v);
+    const tfrt::profiler& profiler() const;
+    /** Build-time profile of the last load. */
+    const tfrt::load_profile& load_profile() const {
+        return m_load_profile;
+    }
 
 public:
     /// Weight tensors handling.
@@ -176,6 +275,12 @@ public:
     void inference(const tfrt::nchw<float>::tensor& tensor);
     /** Inference on a single RGBA image. */
     void inference(float* rgba, uint32_t height, uint32_t width);
+    /** Inference on a single YUV camera frame (NV12, YUYV, ..., CUDA memory,
+     * pitch in bytes). Colour conversion, resize and normalization are fused
+     * in a single pass over the frame, without RGBA float4 intermediate.
+     */
+    void inference(tfrt::yuv_format format, const uint8_t* frame, size_t pitch,
+        uint32_t height, uint32_t width);
     /** Inference on a single VX image.
      * Input image is supposed to be in RGBA, uint8 format.
      */
@@ -201,6 +306,47 @@ public:
     void inference_async(vx_image img1, vx_image img2, cudaStream_t stream);
     
     
+protected:
+    /** Preprocessing of a RGBA uint8 image into a batch slot of the input:
+     * resize, CHW conversion and, if fused, normalization.
+     */
+    cudaError_t preprocess(const nvx_image_patch& image, size_t batch_idx,
+        cudaStream_t stream=0);
+    /** Preprocessing of a RGBA float image (batch slot 0). */
+    cudaError_t preprocess(float* rgba, uint32_t height, uint32_t width);
+    /** Preprocessing of a YUV frame into a batch slot of the input. */
+    cudaError_t preprocess(tfrt::yuv_format format, const uint8_t* frame, size_t pitch,
+        uint32_t height, uint32_t width, size_t batch_idx, cudaStream_t stream=0);
+    /** Preprocessing of pixel ROIs (x, y, width, height) of a RGBA uint8 image
+     * into the batch slots [0, num_rois) of the input, in a single kernel.
+     * num_rois is limited by the max batch size.
+     */
+    cudaError_t preprocess_rois(const nvx_image_patch& image, const int32_t* rois,
+        size_t num_rois, cudaStream_t stream=0);
+    /** Synchronous inference on the tiles of a RGBA uint8 frame, as a single
+     * batch. Return the tiles grid (batch slots in the grid ROIs order).
+     */
+    const tfrt::tile_grid& inference_tiles(const nvx_image_patch& image);
+    /** Read the input normalization weights (shift, scale). */
+    void read_input_normalization();
+    /** Input binding of a batch slot: fp16 or float. */
+    void* input_binding(size_t batch_idx=0) const;
+    bool half_input() const {
+        return m_cuda_input_half.is_allocated();
+    }
+    /** Convert the float input of the first batch_size slots to the fp16
+     * binding (no-op with a float binding), on the device default stream.
+     */
+    void input_to_half(size_t batch_size);
+    /** Parse a .tfrt protobuf file into a message: the network message, or a
+     * message embedding it, moved into m_pb_network by extract_network. The
+     * network weights are then registered in the memory tracker, and the
+     * parse time and size in the load profile. Shared by all load_weights
+     * implementations.
+     */
+    bool parse_weights(const std::string& filename, google::protobuf::MessageLite* message,
+        const std::function<void()>& extract_network=nullptr);
+
 protected:
     /** Find a output CUDA tensor from the all collection! 
      * Return first partial match. 
@@ -208,6 +354,10 @@ protected:
     tfrt::cuda_tensor* find_cuda_output(const std::string& name) const;
     /** Set a CUDA output tensor. */
     void cuda_output(tfrt::cuda_tensor t, size_t idx);
+    /** Inference latency histogram, registered in the global metrics registry
+     * at first use (tfrt_network_inference_seconds{network="name"}).
+     */
+    tfrt::histogram& inference_latency();
 
 protected:
 	/** Prefix used for tagging printed log output. */
@@ -223,25 +373,15 @@ protected:
 				printf(LOG_GIE "%s\n", msg);
 		}
 	} m_gie_logger;
-	/** Profiler interface for measuring layer timings
+	/** Layers profiler: timings aggregated into histograms.
 	 */
-	class Profiler : public nvinfer1::IProfiler
-	{
-	public:
-		Profiler() : timingAccumulator(0.0f) {}
-		virtual void reportLayerTime(const char* layerName, float ms)
-		{
-			printf(LOG_GIE "layer %s - %f ms\n", layerName, ms);
-			timingAccumulator += ms;
-		}
-		float timingAccumulator;
-
-	} m_gie_profiler;
+	tfrt::profiler  m_gie_profiler;
 	/** When profiling is enabled, end a profiling section and report timing statistics.
 	 */
 	inline void PROFILER_REPORT()	{
         if(m_enable_profiler) {
-            printf(LOG_GIE "layer network time - %f ms\n", m_gie_profiler.timingAccumulator); m_gie_profiler.timingAccumulator = 0.0f;
+            m_gie_profiler.end_run();
+            DLOG(INFO) << LOG_GIE << "layer network time - " << m_gie_profiler.last_run_time() << " ms";
         }
     }
 
@@ -262,14 +402,38 @@ public:
 
     // CUDA input and outputs.
     tfrt::cuda_tensor  m_cuda_input;
+    // ROIs of batched crops preprocessing (mapped memory, max batch x 4).
+    tfrt::cuda_tensor_i32  m_cuda_rois;
     std::vector<tfrt::cuda_tensor>  m_cuda_outputs;
+    // fp16 bindings (unallocated when the binding is float).
+    bool  m_half_bindings;
+    tfrt::cuda_tensor_u16  m_cuda_input_half;
+    std::vector<tfrt::cuda_tensor_u16>  m_cuda_outputs_half;
     // Cached bindings vector.
-    std::vector<float*>  m_cached_bindings;
+    std::vector<void*>  m_cached_bindings;
 
     // Create missing tensors?
     bool  m_missing_tensors;
     // Temporary collection of zero tensors.
     std::vector<tfrt_pb::tensor>  m_zero_tensors;
+    // Inference latency metric (synchronous calls).
+    tfrt::histogram*  m_inference_latency;
+    // Load profile (updated by const weights lookups).
+    mutable tfrt::load_profile  m_load_profile;
+    // Fused input preprocessing and normalization parameters.
+    bool  m_fused_preprocessing;
+    tfrt::resize_mode  m_resize_mode;
+    // Letterbox resize and placement of the image in every batch slot.
+    bool  m_letterbox_resize;
+    uint8_t  m_letterbox_pad;
+    std::vector<tfrt::letterbox>  m_input_letterboxes;
+    // Tiled inference parameters and cached geometry.
+    int  m_tiles_x;
+    int  m_tiles_y;
+    float  m_tile_overlap;
+    tfrt::tile_grid  m_tile_grid;
+    float  m_input_scale[3];
+    float  m_input_shift[3];
 };
 
 }
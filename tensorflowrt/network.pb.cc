@@ -0,0 +1,2330 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: network.proto
+
+#include "network.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace tfrt_pb {
+PROTOBUF_CONSTEXPR dimsHW::dimsHW(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.h_)*/0
+  , /*decltype(_impl_.w_)*/0} {}
+struct dimsHWDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR dimsHWDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~dimsHWDefaultTypeInternal() {}
+  union {
+    dimsHW _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dimsHWDefaultTypeInternal _dimsHW_default_instance_;
+PROTOBUF_CONSTEXPR dimsCHW::dimsCHW(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.c_)*/0
+  , /*decltype(_impl_.h_)*/0
+  , /*decltype(_impl_.w_)*/0} {}
+struct dimsCHWDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR dimsCHWDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~dimsCHWDefaultTypeInternal() {}
+  union {
+    dimsCHW _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dimsCHWDefaultTypeInternal _dimsCHW_default_instance_;
+PROTOBUF_CONSTEXPR input::input(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.scalemode_)*/0
+  , /*decltype(_impl_.c_)*/3
+  , /*decltype(_impl_.h_)*/224
+  , /*decltype(_impl_.w_)*/224} {}
+struct inputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR inputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~inputDefaultTypeInternal() {}
+  union {
+    input _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 inputDefaultTypeInternal _input_default_instance_;
+PROTOBUF_CONSTEXPR output::output(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.suffix_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.c_)*/1
+  , /*decltype(_impl_.h_)*/1
+  , /*decltype(_impl_.w_)*/1} {}
+struct outputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR outputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~outputDefaultTypeInternal() {}
+  union {
+    output _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 outputDefaultTypeInternal _output_default_instance_;
+PROTOBUF_CONSTEXPR tensor::tensor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shape_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.datatype_)*/0
+  , /*decltype(_impl_.size_)*/0} {}
+struct tensorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR tensorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~tensorDefaultTypeInternal() {}
+  union {
+    tensor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 tensorDefaultTypeInternal _tensor_default_instance_;
+PROTOBUF_CONSTEXPR network::network(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.weights_)*/{}
+  , /*decltype(_impl_.outputs_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.input_)*/nullptr
+  , /*decltype(_impl_.datatype_)*/0} {}
+struct networkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR networkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~networkDefaultTypeInternal() {}
+  union {
+    network _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 networkDefaultTypeInternal _network_default_instance_;
+}  // namespace tfrt_pb
+static ::_pb::Metadata file_level_metadata_network_2eproto[6];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_network_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_network_2eproto = nullptr;
+
+const uint32_t TableStruct_network_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsHW, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsHW, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsHW, _impl_.h_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsHW, _impl_.w_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsCHW, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsCHW, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsCHW, _impl_.c_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsCHW, _impl_.h_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::dimsCHW, _impl_.w_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _impl_.h_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _impl_.w_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _impl_.c_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::input, _impl_.scalemode_),
+  0,
+  3,
+  4,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _impl_.suffix_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _impl_.h_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _impl_.w_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::output, _impl_.c_),
+  0,
+  1,
+  3,
+  4,
+  2,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _impl_.datatype_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::tensor, _impl_.size_),
+  0,
+  1,
+  2,
+  ~0u,
+  3,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _impl_.weights_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _impl_.datatype_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _impl_.input_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::network, _impl_.outputs_),
+  0,
+  ~0u,
+  2,
+  1,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::tfrt_pb::dimsHW)},
+  { 10, 19, -1, sizeof(::tfrt_pb::dimsCHW)},
+  { 22, 33, -1, sizeof(::tfrt_pb::input)},
+  { 38, 49, -1, sizeof(::tfrt_pb::output)},
+  { 54, 65, -1, sizeof(::tfrt_pb::tensor)},
+  { 70, 81, -1, sizeof(::tfrt_pb::network)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::tfrt_pb::_dimsHW_default_instance_._instance,
+  &::tfrt_pb::_dimsCHW_default_instance_._instance,
+  &::tfrt_pb::_input_default_instance_._instance,
+  &::tfrt_pb::_output_default_instance_._instance,
+  &::tfrt_pb::_tensor_default_instance_._instance,
+  &::tfrt_pb::_network_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_network_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rnetwork.proto\022\007tfrt_pb\"$\n\006dimsHW\022\014\n\001h\030"
+  "\001 \001(\005:\0010\022\014\n\001w\030\002 \001(\005:\0010\"3\n\007dimsCHW\022\014\n\001c\030\001"
+  " \001(\005:\0010\022\014\n\001h\030\002 \001(\005:\0010\022\014\n\001w\030\003 \001(\005:\0010\"q\n\005i"
+  "nput\022\023\n\004name\030\001 \001(\t:\005input\022\016\n\001h\030\002 \001(\005:\00322"
+  "4\022\016\n\001w\030\003 \001(\005:\003224\022\014\n\001c\030\004 \001(\005:\0013\022%\n\tscale"
+  "mode\030\005 \001(\0162\022.tfrt_pb.ScaleMode\"`\n\006output"
+  "\022\024\n\004name\030\001 \001(\t:\006output\022\026\n\006suffix\030\005 \001(\t:\006"
+  "output\022\014\n\001h\030\002 \001(\005:\0011\022\014\n\001w\030\003 \001(\005:\0011\022\014\n\001c\030"
+  "\004 \001(\005:\0011\"f\n\006tensor\022\014\n\004name\030\001 \001(\t\022\014\n\004data"
+  "\030\002 \001(\014\022#\n\010datatype\030\003 \001(\0162\021.tfrt_pb.DataT"
+  "ype\022\r\n\005shape\030\004 \003(\005\022\014\n\004size\030\005 \001(\005\"\237\001\n\007net"
+  "work\022\014\n\004name\030\001 \001(\t\022 \n\007weights\030\002 \003(\0132\017.tf"
+  "rt_pb.tensor\022#\n\010datatype\030\003 \001(\0162\021.tfrt_pb"
+  ".DataType\022\035\n\005input\030\004 \001(\0132\016.tfrt_pb.input"
+  "\022 \n\007outputs\030\005 \003(\0132\017.tfrt_pb.output*)\n\010Da"
+  "taType\022\t\n\005FLOAT\020\000\022\010\n\004HALF\020\001\022\010\n\004INT8\020\002*6\n"
+  "\tScaleMode\022\013\n\007UNIFORM\020\000\022\013\n\007CHANNEL\020\001\022\017\n\013"
+  "ELEMENTWISE\020\002"
+  ;
+static ::_pbi::once_flag descriptor_table_network_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_network_2eproto = {
+    false, false, 693, descriptor_table_protodef_network_2eproto,
+    "network.proto",
+    &descriptor_table_network_2eproto_once, nullptr, 0, 6,
+    schemas, file_default_instances, TableStruct_network_2eproto::offsets,
+    file_level_metadata_network_2eproto, file_level_enum_descriptors_network_2eproto,
+    file_level_service_descriptors_network_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_network_2eproto_getter() {
+  return &descriptor_table_network_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_network_2eproto(&descriptor_table_network_2eproto);
+namespace tfrt_pb {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_network_2eproto);
+  return file_level_enum_descriptors_network_2eproto[0];
+}
+bool DataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ScaleMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_network_2eproto);
+  return file_level_enum_descriptors_network_2eproto[1];
+}
+bool ScaleMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class dimsHW::_Internal {
+ public:
+  using HasBits = decltype(std::declval<dimsHW>()._impl_._has_bits_);
+  static void set_has_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+dimsHW::dimsHW(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.dimsHW)
+}
+dimsHW::dimsHW(const dimsHW& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  dimsHW* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.h_){}
+    , decltype(_impl_.w_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.h_, &from._impl_.h_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.w_) -
+    reinterpret_cast<char*>(&_impl_.h_)) + sizeof(_impl_.w_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.dimsHW)
+}
+
+inline void dimsHW::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.h_){0}
+    , decltype(_impl_.w_){0}
+  };
+}
+
+dimsHW::~dimsHW() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.dimsHW)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void dimsHW::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void dimsHW::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void dimsHW::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.dimsHW)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.h_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.w_) -
+        reinterpret_cast<char*>(&_impl_.h_)) + sizeof(_impl_.w_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* dimsHW::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 h = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_h(&has_bits);
+          _impl_.h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 w = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_w(&has_bits);
+          _impl_.w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* dimsHW::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.dimsHW)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 h = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_h(), target);
+  }
+
+  // optional int32 w = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_w(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.dimsHW)
+  return target;
+}
+
+size_t dimsHW::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.dimsHW)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 h = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_h());
+    }
+
+    // optional int32 w = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_w());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData dimsHW::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    dimsHW::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*dimsHW::GetClassData() const { return &_class_data_; }
+
+
+void dimsHW::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<dimsHW*>(&to_msg);
+  auto& from = static_cast<const dimsHW&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.dimsHW)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.h_ = from._impl_.h_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.w_ = from._impl_.w_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void dimsHW::CopyFrom(const dimsHW& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.dimsHW)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool dimsHW::IsInitialized() const {
+  return true;
+}
+
+void dimsHW::InternalSwap(dimsHW* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(dimsHW, _impl_.w_)
+      + sizeof(dimsHW::_impl_.w_)
+      - PROTOBUF_FIELD_OFFSET(dimsHW, _impl_.h_)>(
+          reinterpret_cast<char*>(&_impl_.h_),
+          reinterpret_cast<char*>(&other->_impl_.h_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata dimsHW::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[0]);
+}
+
+// ===================================================================
+
+class dimsCHW::_Internal {
+ public:
+  using HasBits = decltype(std::declval<dimsCHW>()._impl_._has_bits_);
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+dimsCHW::dimsCHW(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.dimsCHW)
+}
+dimsCHW::dimsCHW(const dimsCHW& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  dimsCHW* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.c_){}
+    , decltype(_impl_.h_){}
+    , decltype(_impl_.w_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.c_, &from._impl_.c_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.w_) -
+    reinterpret_cast<char*>(&_impl_.c_)) + sizeof(_impl_.w_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.dimsCHW)
+}
+
+inline void dimsCHW::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.c_){0}
+    , decltype(_impl_.h_){0}
+    , decltype(_impl_.w_){0}
+  };
+}
+
+dimsCHW::~dimsCHW() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.dimsCHW)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void dimsCHW::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void dimsCHW::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void dimsCHW::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.dimsCHW)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.c_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.w_) -
+        reinterpret_cast<char*>(&_impl_.c_)) + sizeof(_impl_.w_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* dimsCHW::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 c = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_c(&has_bits);
+          _impl_.c_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 h = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_h(&has_bits);
+          _impl_.h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 w = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_w(&has_bits);
+          _impl_.w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* dimsCHW::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.dimsCHW)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 c = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_c(), target);
+  }
+
+  // optional int32 h = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_h(), target);
+  }
+
+  // optional int32 w = 3 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_w(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.dimsCHW)
+  return target;
+}
+
+size_t dimsCHW::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.dimsCHW)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 c = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_c());
+    }
+
+    // optional int32 h = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_h());
+    }
+
+    // optional int32 w = 3 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_w());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData dimsCHW::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    dimsCHW::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*dimsCHW::GetClassData() const { return &_class_data_; }
+
+
+void dimsCHW::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<dimsCHW*>(&to_msg);
+  auto& from = static_cast<const dimsCHW&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.dimsCHW)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.h_ = from._impl_.h_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.w_ = from._impl_.w_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void dimsCHW::CopyFrom(const dimsCHW& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.dimsCHW)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool dimsCHW::IsInitialized() const {
+  return true;
+}
+
+void dimsCHW::InternalSwap(dimsCHW* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(dimsCHW, _impl_.w_)
+      + sizeof(dimsCHW::_impl_.w_)
+      - PROTOBUF_FIELD_OFFSET(dimsCHW, _impl_.c_)>(
+          reinterpret_cast<char*>(&_impl_.c_),
+          reinterpret_cast<char*>(&other->_impl_.c_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata dimsCHW::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[1]);
+}
+
+// ===================================================================
+
+class input::_Internal {
+ public:
+  using HasBits = decltype(std::declval<input>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_scalemode(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString input::Impl_::_i_give_permission_to_break_this_code_default_name_{{{"input", 5}}, {nullptr}};
+input::input(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.input)
+}
+input::input(const input& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  input* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.scalemode_){}
+    , decltype(_impl_.c_){}
+    , decltype(_impl_.h_){}
+    , decltype(_impl_.w_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.scalemode_, &from._impl_.scalemode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.w_) -
+    reinterpret_cast<char*>(&_impl_.scalemode_)) + sizeof(_impl_.w_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.input)
+}
+
+inline void input::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.scalemode_){0}
+    , decltype(_impl_.c_){3}
+    , decltype(_impl_.h_){224}
+    , decltype(_impl_.w_){224}
+  };
+  _impl_.name_.InitDefault();
+}
+
+input::~input() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.input)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void input::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void input::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void input::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.input)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearToDefault(::tfrt_pb::input::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+     }
+  if (cached_has_bits & 0x0000001eu) {
+    _impl_.scalemode_ = 0;
+    _impl_.c_ = 3;
+    _impl_.h_ = 224;
+    _impl_.w_ = 224;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* input::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1 [default = "input"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.input.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 h = 2 [default = 224];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_h(&has_bits);
+          _impl_.h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 w = 3 [default = 224];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_w(&has_bits);
+          _impl_.w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 c = 4 [default = 3];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_c(&has_bits);
+          _impl_.c_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.ScaleMode scalemode = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::tfrt_pb::ScaleMode_IsValid(val))) {
+            _internal_set_scalemode(static_cast<::tfrt_pb::ScaleMode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(5, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* input::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.input)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1 [default = "input"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.input.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional int32 h = 2 [default = 224];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_h(), target);
+  }
+
+  // optional int32 w = 3 [default = 224];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_w(), target);
+  }
+
+  // optional int32 c = 4 [default = 3];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_c(), target);
+  }
+
+  // optional .tfrt_pb.ScaleMode scalemode = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_scalemode(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.input)
+  return target;
+}
+
+size_t input::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.input)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string name = 1 [default = "input"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional .tfrt_pb.ScaleMode scalemode = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_scalemode());
+    }
+
+    // optional int32 c = 4 [default = 3];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_c());
+    }
+
+    // optional int32 h = 2 [default = 224];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_h());
+    }
+
+    // optional int32 w = 3 [default = 224];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_w());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData input::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    input::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*input::GetClassData() const { return &_class_data_; }
+
+
+void input::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<input*>(&to_msg);
+  auto& from = static_cast<const input&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.input)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.scalemode_ = from._impl_.scalemode_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.h_ = from._impl_.h_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.w_ = from._impl_.w_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void input::CopyFrom(const input& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.input)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool input::IsInitialized() const {
+  return true;
+}
+
+void input::InternalSwap(input* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.scalemode_, other->_impl_.scalemode_);
+  swap(_impl_.c_, other->_impl_.c_);
+  swap(_impl_.h_, other->_impl_.h_);
+  swap(_impl_.w_, other->_impl_.w_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata input::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[2]);
+}
+
+// ===================================================================
+
+class output::_Internal {
+ public:
+  using HasBits = decltype(std::declval<output>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_suffix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString output::Impl_::_i_give_permission_to_break_this_code_default_name_{{{"output", 6}}, {nullptr}};
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString output::Impl_::_i_give_permission_to_break_this_code_default_suffix_{{{"output", 6}}, {nullptr}};
+output::output(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.output)
+}
+output::output(const output& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  output* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.suffix_){}
+    , decltype(_impl_.c_){}
+    , decltype(_impl_.h_){}
+    , decltype(_impl_.w_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.suffix_.InitDefault();
+  if (from._internal_has_suffix()) {
+    _this->_impl_.suffix_.Set(from._internal_suffix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.c_, &from._impl_.c_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.w_) -
+    reinterpret_cast<char*>(&_impl_.c_)) + sizeof(_impl_.w_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.output)
+}
+
+inline void output::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.suffix_){}
+    , decltype(_impl_.c_){1}
+    , decltype(_impl_.h_){1}
+    , decltype(_impl_.w_){1}
+  };
+  _impl_.name_.InitDefault();
+  _impl_.suffix_.InitDefault();
+}
+
+output::~output() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.output)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void output::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.suffix_.Destroy();
+}
+
+void output::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void output::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.output)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearToDefault(::tfrt_pb::output::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.suffix_.ClearToDefault(::tfrt_pb::output::Impl_::_i_give_permission_to_break_this_code_default_suffix_, GetArenaForAllocation());
+       }
+    _impl_.c_ = 1;
+    _impl_.h_ = 1;
+    _impl_.w_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* output::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1 [default = "output"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.output.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 h = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_h(&has_bits);
+          _impl_.h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 w = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_w(&has_bits);
+          _impl_.w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 c = 4 [default = 1];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_c(&has_bits);
+          _impl_.c_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string suffix = 5 [default = "output"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_suffix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.output.suffix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* output::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.output)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1 [default = "output"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.output.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional int32 h = 2 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_h(), target);
+  }
+
+  // optional int32 w = 3 [default = 1];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_w(), target);
+  }
+
+  // optional int32 c = 4 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_c(), target);
+  }
+
+  // optional string suffix = 5 [default = "output"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_suffix().data(), static_cast<int>(this->_internal_suffix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.output.suffix");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_suffix(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.output)
+  return target;
+}
+
+size_t output::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.output)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string name = 1 [default = "output"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string suffix = 5 [default = "output"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_suffix());
+    }
+
+    // optional int32 c = 4 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_c());
+    }
+
+    // optional int32 h = 2 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_h());
+    }
+
+    // optional int32 w = 3 [default = 1];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_w());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData output::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    output::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*output::GetClassData() const { return &_class_data_; }
+
+
+void output::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<output*>(&to_msg);
+  auto& from = static_cast<const output&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.output)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_suffix(from._internal_suffix());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.c_ = from._impl_.c_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.h_ = from._impl_.h_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.w_ = from._impl_.w_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void output::CopyFrom(const output& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.output)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool output::IsInitialized() const {
+  return true;
+}
+
+void output::InternalSwap(output* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.suffix_, lhs_arena,
+      &other->_impl_.suffix_, rhs_arena
+  );
+  swap(_impl_.c_, other->_impl_.c_);
+  swap(_impl_.h_, other->_impl_.h_);
+  swap(_impl_.w_, other->_impl_.w_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata output::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[3]);
+}
+
+// ===================================================================
+
+class tensor::_Internal {
+ public:
+  using HasBits = decltype(std::declval<tensor>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_datatype(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+tensor::tensor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.tensor)
+}
+tensor::tensor(const tensor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  tensor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){from._impl_.shape_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.datatype_){}
+    , decltype(_impl_.size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.datatype_, &from._impl_.datatype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.datatype_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.tensor)
+}
+
+inline void tensor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.datatype_){0}
+    , decltype(_impl_.size_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+tensor::~tensor() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.tensor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void tensor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.shape_.~RepeatedField();
+  _impl_.name_.Destroy();
+  _impl_.data_.Destroy();
+}
+
+void tensor::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void tensor::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.tensor)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.shape_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.data_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.datatype_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.size_) -
+        reinterpret_cast<char*>(&_impl_.datatype_)) + sizeof(_impl_.size_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* tensor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.tensor.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.DataType datatype = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::tfrt_pb::DataType_IsValid(val))) {
+            _internal_set_datatype(static_cast<::tfrt_pb::DataType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 shape = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_shape(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_shape(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* tensor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.tensor)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.tensor.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional bytes data = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
+  }
+
+  // optional .tfrt_pb.DataType datatype = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_datatype(), target);
+  }
+
+  // repeated int32 shape = 4;
+  for (int i = 0, n = this->_internal_shape_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_shape(i), target);
+  }
+
+  // optional int32 size = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.tensor)
+  return target;
+}
+
+size_t tensor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.tensor)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 shape = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.shape_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_shape_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional bytes data = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_data());
+    }
+
+    // optional .tfrt_pb.DataType datatype = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_datatype());
+    }
+
+    // optional int32 size = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData tensor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    tensor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*tensor::GetClassData() const { return &_class_data_; }
+
+
+void tensor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<tensor*>(&to_msg);
+  auto& from = static_cast<const tensor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.tensor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.shape_.MergeFrom(from._impl_.shape_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.datatype_ = from._impl_.datatype_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void tensor::CopyFrom(const tensor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.tensor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool tensor::IsInitialized() const {
+  return true;
+}
+
+void tensor::InternalSwap(tensor* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.shape_.InternalSwap(&other->_impl_.shape_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(tensor, _impl_.size_)
+      + sizeof(tensor::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(tensor, _impl_.datatype_)>(
+          reinterpret_cast<char*>(&_impl_.datatype_),
+          reinterpret_cast<char*>(&other->_impl_.datatype_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata tensor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[4]);
+}
+
+// ===================================================================
+
+class network::_Internal {
+ public:
+  using HasBits = decltype(std::declval<network>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_datatype(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::tfrt_pb::input& input(const network* msg);
+  static void set_has_input(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::tfrt_pb::input&
+network::_Internal::input(const network* msg) {
+  return *msg->_impl_.input_;
+}
+network::network(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.network)
+}
+network::network(const network& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  network* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weights_){from._impl_.weights_}
+    , decltype(_impl_.outputs_){from._impl_.outputs_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.input_){nullptr}
+    , decltype(_impl_.datatype_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_input()) {
+    _this->_impl_.input_ = new ::tfrt_pb::input(*from._impl_.input_);
+  }
+  _this->_impl_.datatype_ = from._impl_.datatype_;
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.network)
+}
+
+inline void network::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weights_){arena}
+    , decltype(_impl_.outputs_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.input_){nullptr}
+    , decltype(_impl_.datatype_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+network::~network() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.network)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void network::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.weights_.~RepeatedPtrField();
+  _impl_.outputs_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.input_;
+}
+
+void network::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void network::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.network)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.weights_.Clear();
+  _impl_.outputs_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.input_ != nullptr);
+      _impl_.input_->Clear();
+    }
+  }
+  _impl_.datatype_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* network::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.network.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tfrt_pb.tensor weights = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_weights(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.DataType datatype = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::tfrt_pb::DataType_IsValid(val))) {
+            _internal_set_datatype(static_cast<::tfrt_pb::DataType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.input input = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_input(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tfrt_pb.output outputs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_outputs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* network::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.network)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.network.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .tfrt_pb.tensor weights = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_weights_size()); i < n; i++) {
+    const auto& repfield = this->_internal_weights(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .tfrt_pb.DataType datatype = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_datatype(), target);
+  }
+
+  // optional .tfrt_pb.input input = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::input(this),
+        _Internal::input(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .tfrt_pb.output outputs = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_outputs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_outputs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.network)
+  return target;
+}
+
+size_t network::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.network)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tfrt_pb.tensor weights = 2;
+  total_size += 1UL * this->_internal_weights_size();
+  for (const auto& msg : this->_impl_.weights_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .tfrt_pb.output outputs = 5;
+  total_size += 1UL * this->_internal_outputs_size();
+  for (const auto& msg : this->_impl_.outputs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional .tfrt_pb.input input = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.input_);
+    }
+
+    // optional .tfrt_pb.DataType datatype = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_datatype());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData network::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    network::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*network::GetClassData() const { return &_class_data_; }
+
+
+void network::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<network*>(&to_msg);
+  auto& from = static_cast<const network&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.network)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.weights_.MergeFrom(from._impl_.weights_);
+  _this->_impl_.outputs_.MergeFrom(from._impl_.outputs_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_input()->::tfrt_pb::input::MergeFrom(
+          from._internal_input());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.datatype_ = from._impl_.datatype_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void network::CopyFrom(const network& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.network)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool network::IsInitialized() const {
+  return true;
+}
+
+void network::InternalSwap(network* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.weights_.InternalSwap(&other->_impl_.weights_);
+  _impl_.outputs_.InternalSwap(&other->_impl_.outputs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(network, _impl_.datatype_)
+      + sizeof(network::_impl_.datatype_)
+      - PROTOBUF_FIELD_OFFSET(network, _impl_.input_)>(
+          reinterpret_cast<char*>(&_impl_.input_),
+          reinterpret_cast<char*>(&other->_impl_.input_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata network::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace tfrt_pb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tfrt_pb::dimsHW*
+Arena::CreateMaybeMessage< ::tfrt_pb::dimsHW >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::dimsHW >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::dimsCHW*
+Arena::CreateMaybeMessage< ::tfrt_pb::dimsCHW >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::dimsCHW >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::input*
+Arena::CreateMaybeMessage< ::tfrt_pb::input >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::input >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::output*
+Arena::CreateMaybeMessage< ::tfrt_pb::output >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::output >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::tensor*
+Arena::CreateMaybeMessage< ::tfrt_pb::tensor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::tensor >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::network*
+Arena::CreateMaybeMessage< ::tfrt_pb::network >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::network >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2516 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: network.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_network_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_network_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_network_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_network_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_network_2eproto;
+namespace tfrt_pb {
+class dimsCHW;
+struct dimsCHWDefaultTypeInternal;
+extern dimsCHWDefaultTypeInternal _dimsCHW_default_instance_;
+class dimsHW;
+struct dimsHWDefaultTypeInternal;
+extern dimsHWDefaultTypeInternal _dimsHW_default_instance_;
+class input;
+struct inputDefaultTypeInternal;
+extern inputDefaultTypeInternal _input_default_instance_;
+class network;
+struct networkDefaultTypeInternal;
+extern networkDefaultTypeInternal _network_default_instance_;
+class output;
+struct outputDefaultTypeInternal;
+extern outputDefaultTypeInternal _output_default_instance_;
+class tensor;
+struct tensorDefaultTypeInternal;
+extern tensorDefaultTypeInternal _tensor_default_instance_;
+}  // namespace tfrt_pb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::tfrt_pb::dimsCHW* Arena::CreateMaybeMessage<::tfrt_pb::dimsCHW>(Arena*);
+template<> ::tfrt_pb::dimsHW* Arena::CreateMaybeMessage<::tfrt_pb::dimsHW>(Arena*);
+template<> ::tfrt_pb::input* Arena::CreateMaybeMessage<::tfrt_pb::input>(Arena*);
+template<> ::tfrt_pb::network* Arena::CreateMaybeMessage<::tfrt_pb::network>(Arena*);
+template<> ::tfrt_pb::output* Arena::CreateMaybeMessage<::tfrt_pb::output>(Arena*);
+template<> ::tfrt_pb::tensor* Arena::CreateMaybeMessage<::tfrt_pb::tensor>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace tfrt_pb {
+
+enum DataType : int {
+  FLOAT = 0,
+  HALF = 1,
+  INT8 = 2
+};
+bool DataType_IsValid(int value);
+constexpr DataType DataType_MIN = FLOAT;
+constexpr DataType DataType_MAX = INT8;
+constexpr int DataType_ARRAYSIZE = DataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataType_descriptor();
+template<typename T>
+inline const std::string& DataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DataType_descriptor(), enum_t_value);
+}
+inline bool DataType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DataType>(
+    DataType_descriptor(), name, value);
+}
+enum ScaleMode : int {
+  UNIFORM = 0,
+  CHANNEL = 1,
+  ELEMENTWISE = 2
+};
+bool ScaleMode_IsValid(int value);
+constexpr ScaleMode ScaleMode_MIN = UNIFORM;
+constexpr ScaleMode ScaleMode_MAX = ELEMENTWISE;
+constexpr int ScaleMode_ARRAYSIZE = ScaleMode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ScaleMode_descriptor();
+template<typename T>
+inline const std::string& ScaleMode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ScaleMode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ScaleMode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ScaleMode_descriptor(), enum_t_value);
+}
+inline bool ScaleMode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ScaleMode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ScaleMode>(
+    ScaleMode_descriptor(), name, value);
+}
+// ===================================================================
+
+class dimsHW final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.dimsHW) */ {
+ public:
+  inline dimsHW() : dimsHW(nullptr) {}
+  ~dimsHW() override;
+  explicit PROTOBUF_CONSTEXPR dimsHW(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  dimsHW(const dimsHW& from);
+  dimsHW(dimsHW&& from) noexcept
+    : dimsHW() {
+    *this = ::std::move(from);
+  }
+
+  inline dimsHW& operator=(const dimsHW& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline dimsHW& operator=(dimsHW&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const dimsHW& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const dimsHW* internal_default_instance() {
+    return reinterpret_cast<const dimsHW*>(
+               &_dimsHW_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(dimsHW& a, dimsHW& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(dimsHW* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(dimsHW* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  dimsHW* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<dimsHW>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const dimsHW& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const dimsHW& from) {
+    dimsHW::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(dimsHW* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.dimsHW";
+  }
+  protected:
+  explicit dimsHW(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHFieldNumber = 1,
+    kWFieldNumber = 2,
+  };
+  // optional int32 h = 1 [default = 0];
+  bool has_h() const;
+  private:
+  bool _internal_has_h() const;
+  public:
+  void clear_h();
+  int32_t h() const;
+  void set_h(int32_t value);
+  private:
+  int32_t _internal_h() const;
+  void _internal_set_h(int32_t value);
+  public:
+
+  // optional int32 w = 2 [default = 0];
+  bool has_w() const;
+  private:
+  bool _internal_has_w() const;
+  public:
+  void clear_w();
+  int32_t w() const;
+  void set_w(int32_t value);
+  private:
+  int32_t _internal_w() const;
+  void _internal_set_w(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.dimsHW)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t h_;
+    int32_t w_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// -------------------------------------------------------------------
+
+class dimsCHW final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.dimsCHW) */ {
+ public:
+  inline dimsCHW() : dimsCHW(nullptr) {}
+  ~dimsCHW() override;
+  explicit PROTOBUF_CONSTEXPR dimsCHW(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  dimsCHW(const dimsCHW& from);
+  dimsCHW(dimsCHW&& from) noexcept
+    : dimsCHW() {
+    *this = ::std::move(from);
+  }
+
+  inline dimsCHW& operator=(const dimsCHW& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline dimsCHW& operator=(dimsCHW&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const dimsCHW& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const dimsCHW* internal_default_instance() {
+    return reinterpret_cast<const dimsCHW*>(
+               &_dimsCHW_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(dimsCHW& a, dimsCHW& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(dimsCHW* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(dimsCHW* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  dimsCHW* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<dimsCHW>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const dimsCHW& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const dimsCHW& from) {
+    dimsCHW::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(dimsCHW* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.dimsCHW";
+  }
+  protected:
+  explicit dimsCHW(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCFieldNumber = 1,
+    kHFieldNumber = 2,
+    kWFieldNumber = 3,
+  };
+  // optional int32 c = 1 [default = 0];
+  bool has_c() const;
+  private:
+  bool _internal_has_c() const;
+  public:
+  void clear_c();
+  int32_t c() const;
+  void set_c(int32_t value);
+  private:
+  int32_t _internal_c() const;
+  void _internal_set_c(int32_t value);
+  public:
+
+  // optional int32 h = 2 [default = 0];
+  bool has_h() const;
+  private:
+  bool _internal_has_h() const;
+  public:
+  void clear_h();
+  int32_t h() const;
+  void set_h(int32_t value);
+  private:
+  int32_t _internal_h() const;
+  void _internal_set_h(int32_t value);
+  public:
+
+  // optional int32 w = 3 [default = 0];
+  bool has_w() const;
+  private:
+  bool _internal_has_w() const;
+  public:
+  void clear_w();
+  int32_t w() const;
+  void set_w(int32_t value);
+  private:
+  int32_t _internal_w() const;
+  void _internal_set_w(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.dimsCHW)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t c_;
+    int32_t h_;
+    int32_t w_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// -------------------------------------------------------------------
+
+class input final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.input) */ {
+ public:
+  inline input() : input(nullptr) {}
+  ~input() override;
+  explicit PROTOBUF_CONSTEXPR input(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  input(const input& from);
+  input(input&& from) noexcept
+    : input() {
+    *this = ::std::move(from);
+  }
+
+  inline input& operator=(const input& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline input& operator=(input&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const input& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const input* internal_default_instance() {
+    return reinterpret_cast<const input*>(
+               &_input_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(input& a, input& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(input* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(input* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  input* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<input>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const input& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const input& from) {
+    input::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(input* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.input";
+  }
+  protected:
+  explicit input(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kScalemodeFieldNumber = 5,
+    kCFieldNumber = 4,
+    kHFieldNumber = 2,
+    kWFieldNumber = 3,
+  };
+  // optional string name = 1 [default = "input"];
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional .tfrt_pb.ScaleMode scalemode = 5;
+  bool has_scalemode() const;
+  private:
+  bool _internal_has_scalemode() const;
+  public:
+  void clear_scalemode();
+  ::tfrt_pb::ScaleMode scalemode() const;
+  void set_scalemode(::tfrt_pb::ScaleMode value);
+  private:
+  ::tfrt_pb::ScaleMode _internal_scalemode() const;
+  void _internal_set_scalemode(::tfrt_pb::ScaleMode value);
+  public:
+
+  // optional int32 c = 4 [default = 3];
+  bool has_c() const;
+  private:
+  bool _internal_has_c() const;
+  public:
+  void clear_c();
+  int32_t c() const;
+  void set_c(int32_t value);
+  private:
+  int32_t _internal_c() const;
+  void _internal_set_c(int32_t value);
+  public:
+
+  // optional int32 h = 2 [default = 224];
+  bool has_h() const;
+  private:
+  bool _internal_has_h() const;
+  public:
+  void clear_h();
+  int32_t h() const;
+  void set_h(int32_t value);
+  private:
+  int32_t _internal_h() const;
+  void _internal_set_h(int32_t value);
+  public:
+
+  // optional int32 w = 3 [default = 224];
+  bool has_w() const;
+  private:
+  bool _internal_has_w() const;
+  public:
+  void clear_w();
+  int32_t w() const;
+  void set_w(int32_t value);
+  private:
+  int32_t _internal_w() const;
+  void _internal_set_w(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.input)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int scalemode_;
+    int32_t c_;
+    int32_t h_;
+    int32_t w_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// -------------------------------------------------------------------
+
+class output final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.output) */ {
+ public:
+  inline output() : output(nullptr) {}
+  ~output() override;
+  explicit PROTOBUF_CONSTEXPR output(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  output(const output& from);
+  output(output&& from) noexcept
+    : output() {
+    *this = ::std::move(from);
+  }
+
+  inline output& operator=(const output& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline output& operator=(output&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const output& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const output* internal_default_instance() {
+    return reinterpret_cast<const output*>(
+               &_output_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(output& a, output& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(output* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(output* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  output* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<output>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const output& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const output& from) {
+    output::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(output* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.output";
+  }
+  protected:
+  explicit output(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kSuffixFieldNumber = 5,
+    kCFieldNumber = 4,
+    kHFieldNumber = 2,
+    kWFieldNumber = 3,
+  };
+  // optional string name = 1 [default = "output"];
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string suffix = 5 [default = "output"];
+  bool has_suffix() const;
+  private:
+  bool _internal_has_suffix() const;
+  public:
+  void clear_suffix();
+  const std::string& suffix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_suffix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_suffix();
+  PROTOBUF_NODISCARD std::string* release_suffix();
+  void set_allocated_suffix(std::string* suffix);
+  private:
+  const std::string& _internal_suffix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_suffix(const std::string& value);
+  std::string* _internal_mutable_suffix();
+  public:
+
+  // optional int32 c = 4 [default = 1];
+  bool has_c() const;
+  private:
+  bool _internal_has_c() const;
+  public:
+  void clear_c();
+  int32_t c() const;
+  void set_c(int32_t value);
+  private:
+  int32_t _internal_c() const;
+  void _internal_set_c(int32_t value);
+  public:
+
+  // optional int32 h = 2 [default = 1];
+  bool has_h() const;
+  private:
+  bool _internal_has_h() const;
+  public:
+  void clear_h();
+  int32_t h() const;
+  void set_h(int32_t value);
+  private:
+  int32_t _internal_h() const;
+  void _internal_set_h(int32_t value);
+  public:
+
+  // optional int32 w = 3 [default = 1];
+  bool has_w() const;
+  private:
+  bool _internal_has_w() const;
+  public:
+  void clear_w();
+  int32_t w() const;
+  void set_w(int32_t value);
+  private:
+  int32_t _internal_w() const;
+  void _internal_set_w(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.output)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_suffix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr suffix_;
+    int32_t c_;
+    int32_t h_;
+    int32_t w_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// -------------------------------------------------------------------
+
+class tensor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.tensor) */ {
+ public:
+  inline tensor() : tensor(nullptr) {}
+  ~tensor() override;
+  explicit PROTOBUF_CONSTEXPR tensor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  tensor(const tensor& from);
+  tensor(tensor&& from) noexcept
+    : tensor() {
+    *this = ::std::move(from);
+  }
+
+  inline tensor& operator=(const tensor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline tensor& operator=(tensor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const tensor& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const tensor* internal_default_instance() {
+    return reinterpret_cast<const tensor*>(
+               &_tensor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(tensor& a, tensor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(tensor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(tensor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  tensor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<tensor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const tensor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const tensor& from) {
+    tensor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(tensor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.tensor";
+  }
+  protected:
+  explicit tensor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShapeFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kDataFieldNumber = 2,
+    kDatatypeFieldNumber = 3,
+    kSizeFieldNumber = 5,
+  };
+  // repeated int32 shape = 4;
+  int shape_size() const;
+  private:
+  int _internal_shape_size() const;
+  public:
+  void clear_shape();
+  private:
+  int32_t _internal_shape(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_shape() const;
+  void _internal_add_shape(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_shape();
+  public:
+  int32_t shape(int index) const;
+  void set_shape(int index, int32_t value);
+  void add_shape(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      shape() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_shape();
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional bytes data = 2;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional .tfrt_pb.DataType datatype = 3;
+  bool has_datatype() const;
+  private:
+  bool _internal_has_datatype() const;
+  public:
+  void clear_datatype();
+  ::tfrt_pb::DataType datatype() const;
+  void set_datatype(::tfrt_pb::DataType value);
+  private:
+  ::tfrt_pb::DataType _internal_datatype() const;
+  void _internal_set_datatype(::tfrt_pb::DataType value);
+  public:
+
+  // optional int32 size = 5;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.tensor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > shape_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int datatype_;
+    int32_t size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// -------------------------------------------------------------------
+
+class network final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.network) */ {
+ public:
+  inline network() : network(nullptr) {}
+  ~network() override;
+  explicit PROTOBUF_CONSTEXPR network(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  network(const network& from);
+  network(network&& from) noexcept
+    : network() {
+    *this = ::std::move(from);
+  }
+
+  inline network& operator=(const network& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline network& operator=(network&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const network& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const network* internal_default_instance() {
+    return reinterpret_cast<const network*>(
+               &_network_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(network& a, network& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(network* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(network* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  network* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<network>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const network& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const network& from) {
+    network::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(network* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.network";
+  }
+  protected:
+  explicit network(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWeightsFieldNumber = 2,
+    kOutputsFieldNumber = 5,
+    kNameFieldNumber = 1,
+    kInputFieldNumber = 4,
+    kDatatypeFieldNumber = 3,
+  };
+  // repeated .tfrt_pb.tensor weights = 2;
+  int weights_size() const;
+  private:
+  int _internal_weights_size() const;
+  public:
+  void clear_weights();
+  ::tfrt_pb::tensor* mutable_weights(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::tensor >*
+      mutable_weights();
+  private:
+  const ::tfrt_pb::tensor& _internal_weights(int index) const;
+  ::tfrt_pb::tensor* _internal_add_weights();
+  public:
+  const ::tfrt_pb::tensor& weights(int index) const;
+  ::tfrt_pb::tensor* add_weights();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::tensor >&
+      weights() const;
+
+  // repeated .tfrt_pb.output outputs = 5;
+  int outputs_size() const;
+  private:
+  int _internal_outputs_size() const;
+  public:
+  void clear_outputs();
+  ::tfrt_pb::output* mutable_outputs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::output >*
+      mutable_outputs();
+  private:
+  const ::tfrt_pb::output& _internal_outputs(int index) const;
+  ::tfrt_pb::output* _internal_add_outputs();
+  public:
+  const ::tfrt_pb::output& outputs(int index) const;
+  ::tfrt_pb::output* add_outputs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::output >&
+      outputs() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional .tfrt_pb.input input = 4;
+  bool has_input() const;
+  private:
+  bool _internal_has_input() const;
+  public:
+  void clear_input();
+  const ::tfrt_pb::input& input() const;
+  PROTOBUF_NODISCARD ::tfrt_pb::input* release_input();
+  ::tfrt_pb::input* mutable_input();
+  void set_allocated_input(::tfrt_pb::input* input);
+  private:
+  const ::tfrt_pb::input& _internal_input() const;
+  ::tfrt_pb::input* _internal_mutable_input();
+  public:
+  void unsafe_arena_set_allocated_input(
+      ::tfrt_pb::input* input);
+  ::tfrt_pb::input* unsafe_arena_release_input();
+
+  // optional .tfrt_pb.DataType datatype = 3;
+  bool has_datatype() const;
+  private:
+  bool _internal_has_datatype() const;
+  public:
+  void clear_datatype();
+  ::tfrt_pb::DataType datatype() const;
+  void set_datatype(::tfrt_pb::DataType value);
+  private:
+  ::tfrt_pb::DataType _internal_datatype() const;
+  void _internal_set_datatype(::tfrt_pb::DataType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.network)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::tensor > weights_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::output > outputs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::tfrt_pb::input* input_;
+    int datatype_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// dimsHW
+
+// optional int32 h = 1 [default = 0];
+inline bool dimsHW::_internal_has_h() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool dimsHW::has_h() const {
+  return _internal_has_h();
+}
+inline void dimsHW::clear_h() {
+  _impl_.h_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t dimsHW::_internal_h() const {
+  return _impl_.h_;
+}
+inline int32_t dimsHW::h() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.dimsHW.h)
+  return _internal_h();
+}
+inline void dimsHW::_internal_set_h(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.h_ = value;
+}
+inline void dimsHW::set_h(int32_t value) {
+  _internal_set_h(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.dimsHW.h)
+}
+
+// optional int32 w = 2 [default = 0];
+inline bool dimsHW::_internal_has_w() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool dimsHW::has_w() const {
+  return _internal_has_w();
+}
+inline void dimsHW::clear_w() {
+  _impl_.w_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t dimsHW::_internal_w() const {
+  return _impl_.w_;
+}
+inline int32_t dimsHW::w() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.dimsHW.w)
+  return _internal_w();
+}
+inline void dimsHW::_internal_set_w(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.w_ = value;
+}
+inline void dimsHW::set_w(int32_t value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.dimsHW.w)
+}
+
+// -------------------------------------------------------------------
+
+// dimsCHW
+
+// optional int32 c = 1 [default = 0];
+inline bool dimsCHW::_internal_has_c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool dimsCHW::has_c() const {
+  return _internal_has_c();
+}
+inline void dimsCHW::clear_c() {
+  _impl_.c_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t dimsCHW::_internal_c() const {
+  return _impl_.c_;
+}
+inline int32_t dimsCHW::c() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.dimsCHW.c)
+  return _internal_c();
+}
+inline void dimsCHW::_internal_set_c(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.c_ = value;
+}
+inline void dimsCHW::set_c(int32_t value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.dimsCHW.c)
+}
+
+// optional int32 h = 2 [default = 0];
+inline bool dimsCHW::_internal_has_h() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool dimsCHW::has_h() const {
+  return _internal_has_h();
+}
+inline void dimsCHW::clear_h() {
+  _impl_.h_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t dimsCHW::_internal_h() const {
+  return _impl_.h_;
+}
+inline int32_t dimsCHW::h() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.dimsCHW.h)
+  return _internal_h();
+}
+inline void dimsCHW::_internal_set_h(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.h_ = value;
+}
+inline void dimsCHW::set_h(int32_t value) {
+  _internal_set_h(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.dimsCHW.h)
+}
+
+// optional int32 w = 3 [default = 0];
+inline bool dimsCHW::_internal_has_w() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool dimsCHW::has_w() const {
+  return _internal_has_w();
+}
+inline void dimsCHW::clear_w() {
+  _impl_.w_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t dimsCHW::_internal_w() const {
+  return _impl_.w_;
+}
+inline int32_t dimsCHW::w() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.dimsCHW.w)
+  return _internal_w();
+}
+inline void dimsCHW::_internal_set_w(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.w_ = value;
+}
+inline void dimsCHW::set_w(int32_t value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.dimsCHW.w)
+}
+
+// -------------------------------------------------------------------
+
+// input
+
+// optional string name = 1 [default = "input"];
+inline bool input::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool input::has_name() const {
+  return _internal_has_name();
+}
+inline void input::clear_name() {
+  _impl_.name_.ClearToDefault(::tfrt_pb::input::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& input::name() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.input.name)
+  if (_impl_.name_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_name_.get();
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void input::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.input.name)
+}
+inline std::string* input::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.input.name)
+  return _s;
+}
+inline const std::string& input::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void input::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* input::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(::tfrt_pb::input::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+}
+inline std::string* input::release_name() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.input.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+  return p;
+}
+inline void input::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.input.name)
+}
+
+// optional int32 h = 2 [default = 224];
+inline bool input::_internal_has_h() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool input::has_h() const {
+  return _internal_has_h();
+}
+inline void input::clear_h() {
+  _impl_.h_ = 224;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t input::_internal_h() const {
+  return _impl_.h_;
+}
+inline int32_t input::h() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.input.h)
+  return _internal_h();
+}
+inline void input::_internal_set_h(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.h_ = value;
+}
+inline void input::set_h(int32_t value) {
+  _internal_set_h(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.input.h)
+}
+
+// optional int32 w = 3 [default = 224];
+inline bool input::_internal_has_w() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool input::has_w() const {
+  return _internal_has_w();
+}
+inline void input::clear_w() {
+  _impl_.w_ = 224;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t input::_internal_w() const {
+  return _impl_.w_;
+}
+inline int32_t input::w() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.input.w)
+  return _internal_w();
+}
+inline void input::_internal_set_w(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.w_ = value;
+}
+inline void input::set_w(int32_t value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.input.w)
+}
+
+// optional int32 c = 4 [default = 3];
+inline bool input::_internal_has_c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool input::has_c() const {
+  return _internal_has_c();
+}
+inline void input::clear_c() {
+  _impl_.c_ = 3;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t input::_internal_c() const {
+  return _impl_.c_;
+}
+inline int32_t input::c() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.input.c)
+  return _internal_c();
+}
+inline void input::_internal_set_c(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.c_ = value;
+}
+inline void input::set_c(int32_t value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.input.c)
+}
+
+// optional .tfrt_pb.ScaleMode scalemode = 5;
+inline bool input::_internal_has_scalemode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool input::has_scalemode() const {
+  return _internal_has_scalemode();
+}
+inline void input::clear_scalemode() {
+  _impl_.scalemode_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::tfrt_pb::ScaleMode input::_internal_scalemode() const {
+  return static_cast< ::tfrt_pb::ScaleMode >(_impl_.scalemode_);
+}
+inline ::tfrt_pb::ScaleMode input::scalemode() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.input.scalemode)
+  return _internal_scalemode();
+}
+inline void input::_internal_set_scalemode(::tfrt_pb::ScaleMode value) {
+  assert(::tfrt_pb::ScaleMode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.scalemode_ = value;
+}
+inline void input::set_scalemode(::tfrt_pb::ScaleMode value) {
+  _internal_set_scalemode(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.input.scalemode)
+}
+
+// -------------------------------------------------------------------
+
+// output
+
+// optional string name = 1 [default = "output"];
+inline bool output::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool output::has_name() const {
+  return _internal_has_name();
+}
+inline void output::clear_name() {
+  _impl_.name_.ClearToDefault(::tfrt_pb::output::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& output::name() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.output.name)
+  if (_impl_.name_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_name_.get();
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void output::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.output.name)
+}
+inline std::string* output::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.output.name)
+  return _s;
+}
+inline const std::string& output::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void output::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* output::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(::tfrt_pb::output::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+}
+inline std::string* output::release_name() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.output.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+  return p;
+}
+inline void output::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.output.name)
+}
+
+// optional string suffix = 5 [default = "output"];
+inline bool output::_internal_has_suffix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool output::has_suffix() const {
+  return _internal_has_suffix();
+}
+inline void output::clear_suffix() {
+  _impl_.suffix_.ClearToDefault(::tfrt_pb::output::Impl_::_i_give_permission_to_break_this_code_default_suffix_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& output::suffix() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.output.suffix)
+  if (_impl_.suffix_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_suffix_.get();
+  return _internal_suffix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void output::set_suffix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.suffix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.output.suffix)
+}
+inline std::string* output::mutable_suffix() {
+  std::string* _s = _internal_mutable_suffix();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.output.suffix)
+  return _s;
+}
+inline const std::string& output::_internal_suffix() const {
+  return _impl_.suffix_.Get();
+}
+inline void output::_internal_set_suffix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.suffix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* output::_internal_mutable_suffix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.suffix_.Mutable(::tfrt_pb::output::Impl_::_i_give_permission_to_break_this_code_default_suffix_, GetArenaForAllocation());
+}
+inline std::string* output::release_suffix() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.output.suffix)
+  if (!_internal_has_suffix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.suffix_.Release();
+  return p;
+}
+inline void output::set_allocated_suffix(std::string* suffix) {
+  if (suffix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.suffix_.SetAllocated(suffix, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.output.suffix)
+}
+
+// optional int32 h = 2 [default = 1];
+inline bool output::_internal_has_h() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool output::has_h() const {
+  return _internal_has_h();
+}
+inline void output::clear_h() {
+  _impl_.h_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t output::_internal_h() const {
+  return _impl_.h_;
+}
+inline int32_t output::h() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.output.h)
+  return _internal_h();
+}
+inline void output::_internal_set_h(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.h_ = value;
+}
+inline void output::set_h(int32_t value) {
+  _internal_set_h(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.output.h)
+}
+
+// optional int32 w = 3 [default = 1];
+inline bool output::_internal_has_w() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool output::has_w() const {
+  return _internal_has_w();
+}
+inline void output::clear_w() {
+  _impl_.w_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t output::_internal_w() const {
+  return _impl_.w_;
+}
+inline int32_t output::w() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.output.w)
+  return _internal_w();
+}
+inline void output::_internal_set_w(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.w_ = value;
+}
+inline void output::set_w(int32_t value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.output.w)
+}
+
+// optional int32 c = 4 [default = 1];
+inline bool output::_internal_has_c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool output::has_c() const {
+  return _internal_has_c();
+}
+inline void output::clear_c() {
+  _impl_.c_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t output::_internal_c() const {
+  return _impl_.c_;
+}
+inline int32_t output::c() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.output.c)
+  return _internal_c();
+}
+inline void output::_internal_set_c(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.c_ = value;
+}
+inline void output::set_c(int32_t value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.output.c)
+}
+
+// -------------------------------------------------------------------
+
+// tensor
+
+// optional string name = 1;
+inline bool tensor::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool tensor::has_name() const {
+  return _internal_has_name();
+}
+inline void tensor::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& tensor::name() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.tensor.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void tensor::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.tensor.name)
+}
+inline std::string* tensor::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.tensor.name)
+  return _s;
+}
+inline const std::string& tensor::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void tensor::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* tensor::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* tensor::release_name() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.tensor.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void tensor::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.tensor.name)
+}
+
+// optional bytes data = 2;
+inline bool tensor::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool tensor::has_data() const {
+  return _internal_has_data();
+}
+inline void tensor::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& tensor::data() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.tensor.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void tensor::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.tensor.data)
+}
+inline std::string* tensor::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.tensor.data)
+  return _s;
+}
+inline const std::string& tensor::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void tensor::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* tensor::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* tensor::release_data() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.tensor.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void tensor::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.tensor.data)
+}
+
+// optional .tfrt_pb.DataType datatype = 3;
+inline bool tensor::_internal_has_datatype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool tensor::has_datatype() const {
+  return _internal_has_datatype();
+}
+inline void tensor::clear_datatype() {
+  _impl_.datatype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::tfrt_pb::DataType tensor::_internal_datatype() const {
+  return static_cast< ::tfrt_pb::DataType >(_impl_.datatype_);
+}
+inline ::tfrt_pb::DataType tensor::datatype() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.tensor.datatype)
+  return _internal_datatype();
+}
+inline void tensor::_internal_set_datatype(::tfrt_pb::DataType value) {
+  assert(::tfrt_pb::DataType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.datatype_ = value;
+}
+inline void tensor::set_datatype(::tfrt_pb::DataType value) {
+  _internal_set_datatype(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.tensor.datatype)
+}
+
+// repeated int32 shape = 4;
+inline int tensor::_internal_shape_size() const {
+  return _impl_.shape_.size();
+}
+inline int tensor::shape_size() const {
+  return _internal_shape_size();
+}
+inline void tensor::clear_shape() {
+  _impl_.shape_.Clear();
+}
+inline int32_t tensor::_internal_shape(int index) const {
+  return _impl_.shape_.Get(index);
+}
+inline int32_t tensor::shape(int index) const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.tensor.shape)
+  return _internal_shape(index);
+}
+inline void tensor::set_shape(int index, int32_t value) {
+  _impl_.shape_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.tensor.shape)
+}
+inline void tensor::_internal_add_shape(int32_t value) {
+  _impl_.shape_.Add(value);
+}
+inline void tensor::add_shape(int32_t value) {
+  _internal_add_shape(value);
+  // @@protoc_insertion_point(field_add:tfrt_pb.tensor.shape)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+tensor::_internal_shape() const {
+  return _impl_.shape_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+tensor::shape() const {
+  // @@protoc_insertion_point(field_list:tfrt_pb.tensor.shape)
+  return _internal_shape();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+tensor::_internal_mutable_shape() {
+  return &_impl_.shape_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+tensor::mutable_shape() {
+  // @@protoc_insertion_point(field_mutable_list:tfrt_pb.tensor.shape)
+  return _internal_mutable_shape();
+}
+
+// optional int32 size = 5;
+inline bool tensor::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool tensor::has_size() const {
+  return _internal_has_size();
+}
+inline void tensor::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t tensor::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t tensor::size() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.tensor.size)
+  return _internal_size();
+}
+inline void tensor::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.size_ = value;
+}
+inline void tensor::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.tensor.size)
+}
+
+// -------------------------------------------------------------------
+
+// network
+
+// optional string name = 1;
+inline bool network::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool network::has_name() const {
+  return _internal_has_name();
+}
+inline void network::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& network::name() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.network.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void network::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.network.name)
+}
+inline std::string* network::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.network.name)
+  return _s;
+}
+inline const std::string& network::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void network::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* network::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* network::release_name() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.network.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void network::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.network.name)
+}
+
+// repeated .tfrt_pb.tensor weights = 2;
+inline int network::_internal_weights_size() const {
+  return _impl_.weights_.size();
+}
+inline int network::weights_size() const {
+  return _internal_weights_size();
+}
+inline void network::clear_weights() {
+  _impl_.weights_.Clear();
+}
+inline ::tfrt_pb::tensor* network::mutable_weights(int index) {
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.network.weights)
+  return _impl_.weights_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::tensor >*
+network::mutable_weights() {
+  // @@protoc_insertion_point(field_mutable_list:tfrt_pb.network.weights)
+  return &_impl_.weights_;
+}
+inline const ::tfrt_pb::tensor& network::_internal_weights(int index) const {
+  return _impl_.weights_.Get(index);
+}
+inline const ::tfrt_pb::tensor& network::weights(int index) const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.network.weights)
+  return _internal_weights(index);
+}
+inline ::tfrt_pb::tensor* network::_internal_add_weights() {
+  return _impl_.weights_.Add();
+}
+inline ::tfrt_pb::tensor* network::add_weights() {
+  ::tfrt_pb::tensor* _add = _internal_add_weights();
+  // @@protoc_insertion_point(field_add:tfrt_pb.network.weights)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::tensor >&
+network::weights() const {
+  // @@protoc_insertion_point(field_list:tfrt_pb.network.weights)
+  return _impl_.weights_;
+}
+
+// optional .tfrt_pb.DataType datatype = 3;
+inline bool network::_internal_has_datatype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool network::has_datatype() const {
+  return _internal_has_datatype();
+}
+inline void network::clear_datatype() {
+  _impl_.datatype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::tfrt_pb::DataType network::_internal_datatype() const {
+  return static_cast< ::tfrt_pb::DataType >(_impl_.datatype_);
+}
+inline ::tfrt_pb::DataType network::datatype() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.network.datatype)
+  return _internal_datatype();
+}
+inline void network::_internal_set_datatype(::tfrt_pb::DataType value) {
+  assert(::tfrt_pb::DataType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.datatype_ = value;
+}
+inline void network::set_datatype(::tfrt_pb::DataType value) {
+  _internal_set_datatype(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.network.datatype)
+}
+
+// optional .tfrt_pb.input input = 4;
+inline bool network::_internal_has_input() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.input_ != nullptr);
+  return value;
+}
+inline bool network::has_input() const {
+  return _internal_has_input();
+}
+inline void network::clear_input() {
+  if (_impl_.input_ != nullptr) _impl_.input_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::tfrt_pb::input& network::_internal_input() const {
+  const ::tfrt_pb::input* p = _impl_.input_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tfrt_pb::input&>(
+      ::tfrt_pb::_input_default_instance_);
+}
+inline const ::tfrt_pb::input& network::input() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.network.input)
+  return _internal_input();
+}
+inline void network::unsafe_arena_set_allocated_input(
+    ::tfrt_pb::input* input) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.input_);
+  }
+  _impl_.input_ = input;
+  if (input) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tfrt_pb.network.input)
+}
+inline ::tfrt_pb::input* network::release_input() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::tfrt_pb::input* temp = _impl_.input_;
+  _impl_.input_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tfrt_pb::input* network::unsafe_arena_release_input() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.network.input)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::tfrt_pb::input* temp = _impl_.input_;
+  _impl_.input_ = nullptr;
+  return temp;
+}
+inline ::tfrt_pb::input* network::_internal_mutable_input() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.input_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tfrt_pb::input>(GetArenaForAllocation());
+    _impl_.input_ = p;
+  }
+  return _impl_.input_;
+}
+inline ::tfrt_pb::input* network::mutable_input() {
+  ::tfrt_pb::input* _msg = _internal_mutable_input();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.network.input)
+  return _msg;
+}
+inline void network::set_allocated_input(::tfrt_pb::input* input) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.input_;
+  }
+  if (input) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(input);
+    if (message_arena != submessage_arena) {
+      input = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, input, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.input_ = input;
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.network.input)
+}
+
+// repeated .tfrt_pb.output outputs = 5;
+inline int network::_internal_outputs_size() const {
+  return _impl_.outputs_.size();
+}
+inline int network::outputs_size() const {
+  return _internal_outputs_size();
+}
+inline void network::clear_outputs() {
+  _impl_.outputs_.Clear();
+}
+inline ::tfrt_pb::output* network::mutable_outputs(int index) {
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.network.outputs)
+  return _impl_.outputs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::output >*
+network::mutable_outputs() {
+  // @@protoc_insertion_point(field_mutable_list:tfrt_pb.network.outputs)
+  return &_impl_.outputs_;
+}
+inline const ::tfrt_pb::output& network::_internal_outputs(int index) const {
+  return _impl_.outputs_.Get(index);
+}
+inline const ::tfrt_pb::output& network::outputs(int index) const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.network.outputs)
+  return _internal_outputs(index);
+}
+inline ::tfrt_pb::output* network::_internal_add_outputs() {
+  return _impl_.outputs_.Add();
+}
+inline ::tfrt_pb::output* network::add_outputs() {
+  ::tfrt_pb::output* _add = _internal_add_outputs();
+  // @@protoc_insertion_point(field_add:tfrt_pb.network.outputs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::output >&
+network::outputs() const {
+  // @@protoc_insertion_point(field_list:tfrt_pb.network.outputs)
+  return _impl_.outputs_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace tfrt_pb
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::tfrt_pb::DataType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tfrt_pb::DataType>() {
+  return ::tfrt_pb::DataType_descriptor();
+}
+template <> struct is_proto_enum< ::tfrt_pb::ScaleMode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tfrt_pb::ScaleMode>() {
+  return ::tfrt_pb::ScaleMode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_network_2eproto
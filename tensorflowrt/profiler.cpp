@@ -0,0 +1,292 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <glog/logging.h>
+
+#include "profiler.h"
+
+namespace tfrt
+{
+namespace
+{
+/** Escape a string for JSON output. */
+std::string json_escape(const std::string& s)
+{
+    std::string r;
+    r.reserve(s.size());
+    for(char c : s) {
+        if(c == '"' || c == '\\') {
+            r += '\\';
+            r += c;
+        }
+        else if((unsigned char)c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            r += buf;
+        }
+        else {
+            r += c;
+        }
+    }
+    return r;
+}
+void json_stats(std::ostream& out, const profiler::stats& s)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+        "\"count\": %llu, \"mean\": %.6f, \"p50\": %.6f, \"p95\": %.6f, \"p99\": %.6f, \"max\": %.6f",
+        (unsigned long long)s.count, s.mean, s.p50, s.p95, s.p99, s.max);
+    out << "{\"name\": \"" << json_escape(s.name) << "\", " << buf << "}";
+}
+/** Quote a CSV field (RFC 4180): layer names can contain commas and quotes. */
+std::string csv_quote(const std::string& s)
+{
+    std::string r = "\"";
+    r.reserve(s.size() + 2);
+    for(char c : s) {
+        if(c == '"') {
+            r += '"';
+        }
+        r += c;
+    }
+    r += '"';
+    return r;
+}
+void csv_stats(std::ostream& out, const std::string& type, const profiler::stats& s)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%llu,%.6f,%.6f,%.6f,%.6f,%.6f",
+        (unsigned long long)s.count, s.mean, s.p50, s.p95, s.p99, s.max);
+    out << csv_quote(type) << "," << csv_quote(s.name) << "," << buf << "\n";
+}
+}
+
+/* ============================================================================
+ * tfrt::profiler
+ * ========================================================================== */
+profiler::profiler(std::string name, int group_depth) :
+    m_name{name}, m_group_depth{group_depth},
+    m_next_layer{0}, m_run_started{false}, m_run_total_ns{0}, m_last_run_ms{0.0f}
+{
+}
+
+void profiler::reportLayerTime(const char* layer_name, float ms)
+{
+    // Fast path: layers reported in the same order at every run.
+    size_t idx = m_next_layer;
+    if(idx >= m_layers.size() || m_layers[idx].name != layer_name) {
+        idx = this->layer_index(layer_name);
+    }
+    // Already seen => new run.
+    if(m_run_seen[idx]) {
+        this->end_run();
+    }
+    const uint64_t ns = uint64_t(double(ms) * 1e6 + 0.5);
+    layer_entry& layer = m_layers[idx];
+    layer.hist.record(ns);
+    m_run_seen[idx] = true;
+    m_run_groups_ns[layer.group] += ns;
+    m_run_total_ns += ns;
+    m_run_started = true;
+    m_next_layer = idx + 1;
+}
+size_t profiler::layer_index(const char* layer_name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_layers_map.find(layer_name);
+    if(it != m_layers_map.end()) {
+        return it->second;
+    }
+    // New group?
+    const std::string gname = group_name(layer_name, m_group_depth);
+    auto git = m_groups_map.find(gname);
+    size_t gidx;
+    if(git == m_groups_map.end()) {
+        gidx = m_groups.size();
+        m_groups.emplace_back();
+        m_groups.back().name = gname;
+        m_groups_map[gname] = gidx;
+        m_run_groups_ns.push_back(0);
+    }
+    else {
+        gidx = git->second;
+    }
+    // New layer.
+    const size_t idx = m_layers.size();
+    m_layers.emplace_back();
+    m_layers.back().name = layer_name;
+    m_layers.back().group = gidx;
+    m_layers_map[layer_name] = idx;
+    m_run_seen.push_back(false);
+    return idx;
+}
+void profiler::end_run()
+{
+    if(!m_run_started) {
+        return;
+    }
+    for(size_t i = 0 ; i < m_groups.size() ; ++i) {
+        m_groups[i].hist.record(m_run_groups_ns[i]);
+        m_run_groups_ns[i] = 0;
+    }
+    m_total.record(m_run_total_ns);
+    m_last_run_ms = m_run_total_ns * 1e-6f;
+    m_run_total_ns = 0;
+    std::fill(m_run_seen.begin(), m_run_seen.end(), false);
+    m_run_started = false;
+    m_next_layer = 0;
+}
+void profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_layers.clear();
+    m_groups.clear();
+    m_layers_map.clear();
+    m_groups_map.clear();
+    m_run_seen.clear();
+    m_run_groups_ns.clear();
+    m_next_layer = 0;
+    m_run_started = false;
+    m_run_total_ns = 0;
+    m_last_run_ms = 0.0f;
+    m_total.reset();
+}
+
+std::string profiler::group_name(const std::string& layer_name, int depth)
+{
+    size_t pos = 0;
+    for(int i = 0 ; i < depth ; ++i) {
+        pos = layer_name.find('/', pos);
+        if(pos == std::string::npos) {
+            return layer_name;
+        }
+        pos++;
+    }
+    return layer_name.substr(0, pos - 1);
+}
+
+/* ============================================================================
+ * Statistics and export.
+ * ========================================================================== */
+profiler::stats profiler::hist_stats(const std::string& name, const histogram& hist)
+{
+    stats s;
+    s.name = name;
+    s.count = hist.count();
+    s.mean = hist.mean() * 1e-6;
+    s.p50 = hist.percentile(50.0) * 1e-6;
+    s.p95 = hist.percentile(95.0) * 1e-6;
+    s.p99 = hist.percentile(99.0) * 1e-6;
+    s.max = hist.max() * 1e-6;
+    return s;
+}
+std::vector<profiler::stats> profiler::layers_stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<stats> v;
+    for(auto&& l : m_layers) {
+        v.push_back(hist_stats(l.name, l.hist));
+    }
+    return v;
+}
+std::vector<profiler::stats> profiler::groups_stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<stats> v;
+    for(auto&& g : m_groups) {
+        v.push_back(hist_stats(g.name, g.hist));
+    }
+    return v;
+}
+profiler::stats profiler::total_stats() const
+{
+    return hist_stats("total", m_total);
+}
+
+void profiler::to_json(std::ostream& out) const
+{
+    out << "{\n  \"name\": \"" << json_escape(m_name) << "\",\n"
+        << "  \"unit\": \"ms\",\n"
+        << "  \"runs\": " << this->num_runs() << ",\n"
+        << "  \"total\": ";
+    json_stats(out, this->total_stats());
+    const char* sections[2] = {"layers", "groups"};
+    const std::vector<stats> vstats[2] = {this->layers_stats(), this->groups_stats()};
+    for(int k = 0 ; k < 2 ; ++k) {
+        out << ",\n  \"" << sections[k] << "\": [";
+        for(size_t i = 0 ; i < vstats[k].size() ; ++i) {
+            out << (i ? ",\n    " : "\n    ");
+            json_stats(out, vstats[k][i]);
+        }
+        out << "\n  ]";
+    }
+    out << "\n}\n";
+}
+void profiler::to_csv(std::ostream& out) const
+{
+    out << "type,name,count,mean_ms,p50_ms,p95_ms,p99_ms,max_ms\n";
+    csv_stats(out, "total", this->total_stats());
+    for(auto&& s : this->groups_stats()) {
+        csv_stats(out, "group", s);
+    }
+    for(auto&& s : this->layers_stats()) {
+        csv_stats(out, "layer", s);
+    }
+}
+void profiler::print(std::ostream& out) const
+{
+    char buf[512];
+    auto print_stats = [&](const stats& s) {
+        snprintf(buf, sizeof(buf), "%-80.80s %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+            s.name.c_str(), s.mean, s.p50, s.p95, s.p99, s.max);
+        out << buf;
+    };
+    snprintf(buf, sizeof(buf), "%-80.80s %8s %8s %8s %8s %8s\n",
+        ("Profiler " + m_name).c_str(), "mean", "p50", "p95", "p99", "max");
+    out << buf;
+    for(auto&& s : this->layers_stats()) {
+        print_stats(s);
+    }
+    out << "Groups (depth " << m_group_depth << "):\n";
+    for(auto&& s : this->groups_stats()) {
+        print_stats(s);
+    }
+    print_stats(this->total_stats());
+    out << "Number of runs: " << this->num_runs() << "\n";
+}
+bool profiler::save_json(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    if(!file) {
+        LOG(ERROR) << "Could not open profiler JSON file: " << filename;
+        return false;
+    }
+    this->to_json(file);
+    return bool(file);
+}
+bool profiler::save_csv(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    if(!file) {
+        LOG(ERROR) << "Could not open profiler CSV file: " << filename;
+        return false;
+    }
+    this->to_csv(file);
+    return bool(file);
+}
+
+}
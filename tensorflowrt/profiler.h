@@ -0,0 +1,143 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_PROFILER_H
+#define TFRT_PROFILER_H
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <unordered_map>
+
+#include <NvInfer.h>
+
+#include "misc/histogram.h"
+
+namespace tfrt
+{
+/* ============================================================================
+ * tfrt::profiler
+ * ========================================================================== */
+/** TensorRT layers profiler. Per-layer timings are aggregated into lock-free
+ * histograms (mean, p50, p95, p99, max), and grouped by scope prefix (e.g.
+ * 'inception2_base/Mixed_4b' with depth 2). Groups and total statistics are
+ * computed per inference run.
+ *
+ * Layers are reported by TensorRT in the same order at every run: the next
+ * expected layer is checked first, the name lookup being only a fallback. A new
+ * run starts when a layer is reported again.
+ * Statistics can be exported in JSON or CSV, e.g. to diff models in CI.
+ */
+class profiler : public nvinfer1::IProfiler
+{
+public:
+    /** Statistics of a layer or group, in milliseconds. */
+    struct stats
+    {
+        std::string  name;
+        uint64_t  count;
+        double  mean;
+        double  p50;
+        double  p95;
+        double  p99;
+        double  max;
+    };
+
+public:
+    /** Profiler with a scope depth used for grouping layers. */
+    profiler(std::string name="", int group_depth=2);
+
+    /** TensorRT interface: report the time of a layer. */
+    virtual void reportLayerTime(const char* layer_name, float ms);
+    /** Close the current run (groups and total statistics). Automatically
+     * called when a new run starts. */
+    void end_run();
+    /** Reset all statistics. */
+    void reset();
+
+public:
+    /** Number of complete runs. */
+    uint64_t num_runs() const {
+        return m_total.count();
+    }
+    /** Total time of the last run (ms). */
+    float last_run_time() const {
+        return m_last_run_ms;
+    }
+    /** Statistics of layers (in order of execution), groups and total. */
+    std::vector<stats> layers_stats() const;
+    std::vector<stats> groups_stats() const;
+    stats total_stats() const;
+
+    /** Group of a layer name: first 'depth' components of the scope. */
+    static std::string group_name(const std::string& layer_name, int depth);
+
+public:
+    /** Export in JSON: name, number of runs, total, layers and groups stats. */
+    void to_json(std::ostream& out) const;
+    /** Export in CSV: one line per layer / group / total. */
+    void to_csv(std::ostream& out) const;
+    /** Human readable table. */
+    void print(std::ostream& out) const;
+    /** Save JSON or CSV files. */
+    bool save_json(const std::string& filename) const;
+    bool save_csv(const std::string& filename) const;
+
+private:
+    /** Layer timings. */
+    struct layer_entry
+    {
+        std::string  name;
+        size_t  group;
+        histogram  hist;
+    };
+    /** Group of layers timings. */
+    struct group_entry
+    {
+        std::string  name;
+        histogram  hist;
+    };
+    /** Find or create a layer entry. */
+    size_t layer_index(const char* layer_name);
+    /** Convert a histogram to stats. */
+    static stats hist_stats(const std::string& name, const histogram& hist);
+
+private:
+    // Profiler name and grouping depth.
+    std::string  m_name;
+    int  m_group_depth;
+
+    // Layers and groups entries. Deques: stable addresses when growing.
+    mutable std::mutex  m_mutex;
+    std::deque<layer_entry>  m_layers;
+    std::deque<group_entry>  m_groups;
+    std::unordered_map<std::string, size_t>  m_layers_map;
+    std::unordered_map<std::string, size_t>  m_groups_map;
+
+    // Current run: next expected layer, accumulated times in ns.
+    size_t  m_next_layer;
+    bool  m_run_started;
+    std::vector<bool>  m_run_seen;
+    std::vector<uint64_t>  m_run_groups_ns;
+    uint64_t  m_run_total_ns;
+    float  m_last_run_ms;
+    // Total time per run.
+    histogram  m_total;
+};
+
+}
+
+#endif
@@ -12,10 +12,14 @@
 # is strictly forbidden unless prior written permission is obtained
 # from Robik AI Ltd.
 # =========================================================================== */
+#include <algorithm>
 #include <glog/logging.h>
 
 #include "seg_network.h"
+#include "tracer.h"
+#include "memory_tracker.h"
 #include "cuda/cudaSegmentation.h"
+#include "cpu/cpuSegmentation.h"
 
 namespace tfrt
 {
@@ -30,6 +34,7 @@ void seg_network::init_tensors_cached()
 {
     const tfrt::cuda_tensor& cuda_output = m_cuda_outputs[0];
     const auto& oshape = cuda_output.shape;
+    memory_owner owner{this->name()};
     if (!m_rclasses_cached.is_allocated() ) {
         m_rclasses_cached = tfrt::cuda_tensor_u8(
             "classes", {oshape.n(), 1, oshape.h(), oshape.w()});
@@ -43,42 +48,45 @@ void seg_network::init_tensors_cached()
 }
 void seg_network::post_processing()
 {
+    TFRT_TRACE_SCOPE("seg_network::post_processing");
     this->init_tensors_cached();
-    // For God sake, used a fucking CUDA kernel for that!
-    const auto& rtensor = m_cuda_outputs[0].tensor();
     const auto& oshape = m_cuda_outputs[0].shape;
     LOG(INFO) << "SEGNET: post-processing of output with shape: "
         << dims_str(m_cuda_outputs[0].shape);
     // CUDA(cudaDeviceSynchronize());
-    for (long n = 0 ; n < rtensor.dimension(0) ; ++n) {
-        for (long i = 0 ; i < rtensor.dimension(2) ; ++i) {
-            for (long j = 0 ; j < rtensor.dimension(3) ; ++j) {
-                uint8_t max_idx = 0;
-                float max_score = 0.0f;
-                // Channel loop.
-                for (long k = 0 ; k < rtensor.dimension(1) ; ++k) {
-                    float score = rtensor(n, k, i, j);
-                    if (score > max_score) {
-                        max_idx = uint8_t(k);
-                        max_score = score;
-                    }
-                    // Save to cached tensors.
-                    long idx = n * oshape.h() * oshape.w() + i * oshape.w() + j;
-                    if (max_score > m_detection_threshold) {
-                        m_rclasses_cached.cpu[idx] = max_idx + int(!m_empty_class);
-                        m_rscores_cached.cpu[idx] = max_score;
-                    }
-                    else {
-                        m_rclasses_cached.cpu[idx] = 0;
-                        m_rscores_cached.cpu[idx] = max_score;
-                    }
-                }
-            }
-        }
-    }
-    // CUDA(cudaDeviceSynchronize());
+    // Host argmax: vectorized over pixels and parallelized over rows.
+    bool r = cpu_seg_argmax(m_cuda_outputs[0].cpu,
+        m_rclasses_cached.cpu, m_rscores_cached.cpu,
+        oshape.n(), oshape.w(), oshape.h(), oshape.c(),
+        m_empty_class, m_detection_threshold);
+    CHECK(r) << "SEGNET: failed to post-process output with shape: " << dims_str(oshape);
     LOG(INFO) << "SEGNET: done with post-processing of output";
 }
+void seg_network::inference_tiled(const nvx_image_patch& image)
+{
+    TFRT_TRACE_SCOPE("seg_network::inference_tiled");
+    const tfrt::tile_grid& grid = this->inference_tiles(image);
+    const auto& oshape = m_cuda_outputs[0].shape;
+    // Stitched tensors, re-allocated with the map size.
+    const nvinfer1::DimsNCHW mshape{1, oshape.c(), grid.map_height, grid.map_width};
+    if(!m_tiled_prob.is_allocated() || m_tiled_prob.shape.c() != mshape.c() ||
+        m_tiled_prob.shape.h() != mshape.h() || m_tiled_prob.shape.w() != mshape.w()) {
+        memory_owner owner{this->name()};
+        m_tiled_prob = tfrt::cuda_tensor("tiled_prob", mshape);
+        m_tiled_prob.allocate();
+        m_tiled_classes = tfrt::cuda_tensor_u8("tiled_classes", {1, 1, mshape.h(), mshape.w()});
+        m_tiled_classes.allocate();
+        m_tiled_scores = tfrt::cuda_tensor("tiled_scores", {1, 1, mshape.h(), mshape.w()});
+        m_tiled_scores.allocate();
+    }
+    TFRT_TRACE_SCOPE("seg_network::post_processing");
+    bool r = cpu_seg_stitch_tiles(m_cuda_outputs[0].cpu, m_tiled_prob.cpu, grid,
+        oshape.w(), oshape.h(), oshape.c());
+    CHECK(r) << "SEGNET: failed to stitch tiles with output shape: " << dims_str(oshape);
+    r = cpu_seg_argmax(m_tiled_prob.cpu, m_tiled_classes.cpu, m_tiled_scores.cpu,
+        1, mshape.w(), mshape.h(), mshape.c(), m_empty_class, m_detection_threshold);
+    CHECK(r) << "SEGNET: failed to post-process stitched map: " << dims_str(mshape);
+}
 
 // void seg_network::inference(vx_image image)
 // {
@@ -140,6 +148,7 @@ seg_network_post::seg_network_post(nvinfer1::DimsCHW _seg_outshape,
 }
 void seg_network_post::apply(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx)
 {
+    TFRT_TRACE_SCOPE("seg_network_post::apply");
     // CUDA optimized implementation! Finally!
     cuda_seg_post_process(
         seg_output_raw.cuda_ptr(batch_idx), m_rclasses_cached.cuda, m_rscores_cached.cuda, 
@@ -148,6 +157,18 @@ void seg_network_post::apply(const tfrt::cuda_tensor& seg_output_raw, size_t bat
         m_empty_class, m_detection_threshold);
 }
 
+void seg_network_post::apply_cpu(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx)
+{
+    TFRT_TRACE_SCOPE("seg_network_post::apply_cpu");
+    bool r = cpu_seg_post_process(
+        seg_output_raw.cpu_ptr(batch_idx), m_rclasses_cached.cpu, m_rscores_cached.cpu,
+        m_transformation_matrix.cpu,
+        m_seg_outshape.w(), m_seg_outshape.h(), seg_output_raw.shape.c(),
+        m_empty_class, m_detection_threshold);
+    CHECK(r) << "SEGNET: failed to post-process output with shape: "
+        << dims_str(seg_output_raw.shape);
+}
+
 void seg_network_post::transformation_matrix(const tfrt::matrix_33f_rm& m)
 {
     // Just copy the memory!
@@ -161,4 +182,175 @@ tfrt::matrix_33f_rm seg_network_post::transformation_matrix() const
     return m;
 }
 
+// ========================================================================== //
+// Temporal fusion of segmentation.
+// ========================================================================== //
+seg_fusion::seg_fusion(nvinfer1::DimsCHW _seg_outshape, float _alpha, size_t _ring_size) :
+    m_seg_outshape{_seg_outshape},
+    m_alpha{_alpha},
+    m_head{0},
+    m_num_frames{0}
+{
+    CHECK_GE(_ring_size, 2) << "SEGNET: fusion ring needs at least 2 tensors.";
+    // Ring of fused probabilities, allocated once.
+    m_ring.reserve(_ring_size);
+    for(size_t i = 0 ; i < _ring_size ; ++i) {
+        m_ring.emplace_back("seg_fused_" + std::to_string(i), nvinfer1::DimsNCHW{
+            1, m_seg_outshape.c(), m_seg_outshape.h(), m_seg_outshape.w()});
+        m_ring.back().allocate();
+    }
+    m_transformation_matrix = tfrt::cuda_tensor("tr_matrix", {1, 1, 3, 3});
+    m_transformation_matrix.allocate();
+    this->transformation_matrix(tfrt::matrix_33f_rm::Identity());
+}
+void seg_fusion::reset()
+{
+    m_num_frames = 0;
+}
+const tfrt::cuda_tensor& seg_fusion::fused(size_t idx) const
+{
+    CHECK_LT(idx, this->size()) << "SEGNET: no fused probabilities that far back.";
+    return m_ring[(m_head + m_ring.size() - idx) % m_ring.size()];
+}
+std::pair<const tfrt::cuda_tensor*, tfrt::cuda_tensor*> seg_fusion::next_slot()
+{
+    const tfrt::cuda_tensor* prev = m_num_frames ? &m_ring[m_head] : nullptr;
+    m_head = (m_head + 1) % m_ring.size();
+    m_num_frames++;
+    return std::make_pair(prev, &m_ring[m_head]);
+}
+
+void seg_fusion::check_input(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx) const
+{
+    const auto& shape = seg_output_raw.shape;
+    CHECK(shape.c() == m_seg_outshape.c() && shape.h() == m_seg_outshape.h() &&
+        shape.w() == m_seg_outshape.w()) << "SEGNET: inconsistent fusion input shape: "
+        << dims_str(shape) << " vs " << dims_str(m_seg_outshape);
+    CHECK_LT(batch_idx, size_t(shape.n())) << "SEGNET: fusion input batch index out of range.";
+}
+const tfrt::cuda_tensor& seg_fusion::apply(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx)
+{
+    TFRT_TRACE_SCOPE("seg_fusion::apply");
+    this->check_input(seg_output_raw, batch_idx);
+    auto slots = this->next_slot();
+    if(!slots.first) {
+        // No history: raw probabilities.
+        CUDA(cudaMemcpy(slots.second->cuda, seg_output_raw.cuda_ptr(batch_idx),
+            slots.second->size, cudaMemcpyDeviceToDevice));
+    }
+    else {
+        CUDA(cuda_seg_fusion(
+            seg_output_raw.cuda_ptr(batch_idx), slots.first->cuda, slots.second->cuda,
+            m_transformation_matrix.cuda,
+            m_seg_outshape.w(), m_seg_outshape.h(), m_seg_outshape.c(), m_alpha));
+    }
+    return *slots.second;
+}
+const tfrt::cuda_tensor& seg_fusion::apply_cpu(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx)
+{
+    TFRT_TRACE_SCOPE("seg_fusion::apply_cpu");
+    this->check_input(seg_output_raw, batch_idx);
+    auto slots = this->next_slot();
+    if(!slots.first) {
+        memcpy(slots.second->cpu, seg_output_raw.cpu_ptr(batch_idx), slots.second->size);
+    }
+    else {
+        bool r = cpu_seg_fusion(
+            seg_output_raw.cpu_ptr(batch_idx), slots.first->cpu, slots.second->cpu,
+            m_transformation_matrix.cpu,
+            m_seg_outshape.w(), m_seg_outshape.h(), m_seg_outshape.c(), m_alpha);
+        CHECK(r) << "SEGNET: failed to fuse output with shape: " << dims_str(seg_output_raw.shape);
+    }
+    return *slots.second;
+}
+const tfrt::cuda_tensor& seg_fusion::predict()
+{
+    TFRT_TRACE_SCOPE("seg_fusion::predict");
+    CHECK(m_num_frames) << "SEGNET: no history for predicting segmentation.";
+    auto slots = this->next_slot();
+    CUDA(cuda_seg_fusion(
+        nullptr, slots.first->cuda, slots.second->cuda, m_transformation_matrix.cuda,
+        m_seg_outshape.w(), m_seg_outshape.h(), m_seg_outshape.c(), m_alpha));
+    return *slots.second;
+}
+const tfrt::cuda_tensor& seg_fusion::predict_cpu()
+{
+    TFRT_TRACE_SCOPE("seg_fusion::predict_cpu");
+    CHECK(m_num_frames) << "SEGNET: no history for predicting segmentation.";
+    auto slots = this->next_slot();
+    bool r = cpu_seg_fusion(
+        nullptr, slots.first->cpu, slots.second->cpu, m_transformation_matrix.cpu,
+        m_seg_outshape.w(), m_seg_outshape.h(), m_seg_outshape.c(), m_alpha);
+    CHECK(r) << "SEGNET: failed to predict segmentation.";
+    return *slots.second;
+}
+
+void seg_fusion::transformation_matrix(const tfrt::matrix_33f_rm& m)
+{
+    memcpy(m_transformation_matrix.cpu, m.data(), m_transformation_matrix.size);
+}
+tfrt::matrix_33f_rm seg_fusion::transformation_matrix() const
+{
+    tfrt::matrix_33f_rm m;
+    memcpy(m.data(), m_transformation_matrix.cpu, m_transformation_matrix.size);
+    return m;
+}
+
+// ========================================================================== //
+// Instances extraction from segmentation.
+// ========================================================================== //
+seg_instances::seg_instances(nvinfer1::DimsCHW _seg_outshape, const parameters& params) :
+    m_seg_outshape{_seg_outshape},
+    m_params{params},
+    m_labels(_seg_outshape.h() * _seg_outshape.w(), 0),
+    m_parents(_seg_outshape.h() * _seg_outshape.w() + 1, 0),
+    m_instances{params.max_instances}
+{
+    // At most one component per pixel.
+    m_order.reserve(_seg_outshape.h() * _seg_outshape.w());
+}
+const boxes2d::bboxes2d& seg_instances::apply(const seg_network_post& seg_post)
+{
+    return this->apply(seg_post.classes().cpu, seg_post.scores().cpu);
+}
+const boxes2d::bboxes2d& seg_instances::apply(const uint8_t* classes, const float* scores)
+{
+    TFRT_TRACE_SCOPE("seg_instances::apply");
+    const uint32_t width = m_seg_outshape.w();
+    const uint32_t height = m_seg_outshape.h();
+    bool r = cpu_connected_components(classes, scores, m_labels.data(), m_parents.data(),
+        width, height, m_params.connectivity8, m_params.num_strips, m_components);
+    CHECK(r) << "SEGNET: failed to extract connected components.";
+
+    // Components above minimal area, the largest first if too many.
+    m_order.clear();
+    for(size_t i = 0 ; i < m_components.size() ; ++i) {
+        if(m_components.areas[i] >= m_params.min_area) {
+            m_order.push_back(i);
+        }
+    }
+    const size_t num_instances = std::min(m_order.size(), m_params.max_instances);
+    if(num_instances < m_order.size()) {
+        const auto& areas = m_components.areas;
+        std::partial_sort(m_order.begin(), m_order.begin() + num_instances, m_order.end(),
+            [&areas](uint32_t i1, uint32_t i2) {
+                return areas[i1] > areas[i2] || (areas[i1] == areas[i2] && i1 < i2);
+            });
+    }
+    // Components => instances.
+    for(size_t idx = 0 ; idx < num_instances ; ++idx) {
+        const uint32_t i = m_order[idx];
+        const uint32_t area = m_components.areas[i];
+        m_instances.classes[idx] = m_components.classes[i];
+        m_instances.scores[idx] = scores ? float(m_components.scores_sum[i] / area) : 1.0f;
+        m_instances.boxes.row(idx) <<
+            float(m_components.ymin[i]) / height, float(m_components.xmin[i]) / width,
+            float(m_components.ymax[i] + 1) / height, float(m_components.xmax[i] + 1) / width;
+    }
+    m_instances.scores.tail(m_params.max_instances - num_instances).setZero();
+    m_instances.sort_by_score(true);
+    m_instances.time = boxes2d::bboxes2d::clock::now();
+    return m_instances;
+}
+
 }
\ No newline at end of file
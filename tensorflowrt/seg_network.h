@@ -17,10 +17,14 @@
 
 #include <tuple>
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include <NvInfer.h>
 
 #include "utils.h"
 #include "network.h"
+#include "boxes2d/boxes2d.h"
+#include "cpu/cpuComponents.h"
 
 namespace tfrt
 {
@@ -86,6 +90,24 @@ public:
         return m_cuda_outputs[0];
     }
 
+public:
+    /** Tiled inference on a high resolution RGBA uint8 frame (see
+     * network::tiling): the probabilities of the tiles are stitched in a
+     * frame map (linear blending of the overlaps), then classes and scores
+     * are computed on the map.
+     */
+    void inference_tiled(const nvx_image_patch& image);
+    // Tiled inference results, at the stitched map resolution.
+    const tfrt::cuda_tensor& tiled_probabilities() const {
+        return m_tiled_prob;
+    }
+    const tfrt::cuda_tensor_u8& tiled_classes() const {
+        return m_tiled_classes;
+    }
+    const tfrt::cuda_tensor& tiled_scores() const {
+        return m_tiled_scores;
+    }
+
 public:
     /** Set the segmentation CUDA output tensor. Careful with that!!!
      */
@@ -110,6 +132,10 @@ protected:
     // Cached result tensors.
     tfrt::cuda_tensor_u8  m_rclasses_cached;
     tfrt::cuda_tensor  m_rscores_cached;
+    // Stitched tiled inference results.
+    tfrt::cuda_tensor  m_tiled_prob;
+    tfrt::cuda_tensor_u8  m_tiled_classes;
+    tfrt::cuda_tensor  m_tiled_scores;
 };
 
 // ========================================================================== //
@@ -129,6 +155,9 @@ public:
 
     /** Apply the post-processing algorithm. */
     void apply(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx);
+    /** Apply the post-processing algorithm on the host (CPU). Same results
+     * as the CUDA implementation. */
+    void apply_cpu(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx);
 
 public:
     /** Empty class? */
@@ -172,6 +201,148 @@ private:
     tfrt::cuda_tensor  m_rscores_cached;
 };
 
+// ========================================================================== //
+// Temporal fusion of segmentation.
+// ========================================================================== //
+/** Temporal fusion of segmentation probabilities across stabilized frames.
+ * At every frame, the previous fused probabilities are warped with the
+ * stabilization homography, and blended with the new raw probabilities using
+ * an exponential moving average. Without new network output, the warped
+ * probabilities are used as prediction (e.g. net run every other frame).
+ *
+ * Fused probabilities are stored in a ring of tensors allocated once, the last
+ * one having the shape of a network output with batch size 1: it can be
+ * directly post-processed by seg_network_post.
+ * The homography maps current pixels to the previous frame, at the segmentation
+ * resolution, with the same convention as seg_network_post::transformation_matrix.
+ */
+class seg_fusion
+{
+public:
+    /** Build, with segmentation output shape, EMA weight of new probabilities
+     * and size of the ring of tensors (at least 2).
+     */
+    seg_fusion(nvinfer1::DimsCHW _seg_outshape, float _alpha=0.5f, size_t _ring_size=2);
+
+    /** Fuse new raw probabilities, CUDA implementation. */
+    const tfrt::cuda_tensor& apply(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx);
+    /** Fuse new raw probabilities, host (CPU) implementation. */
+    const tfrt::cuda_tensor& apply_cpu(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx);
+    /** Predict probabilities without network output: previous ones warped. */
+    const tfrt::cuda_tensor& predict();
+    const tfrt::cuda_tensor& predict_cpu();
+    /** Reset the history. */
+    void reset();
+
+public:
+    /** EMA weight of new probabilities. */
+    float alpha() const {
+        return m_alpha;
+    }
+    void alpha(float v) {
+        m_alpha = v;
+    }
+    /** Number of frames in the history (capped by the ring size). */
+    size_t size() const {
+        return std::min(m_num_frames, m_ring.size());
+    }
+    /** Fused probabilities, idx frames back in time (0: last one). */
+    const tfrt::cuda_tensor& fused(size_t idx=0) const;
+    /** Transformation matrix: current frame pixels => previous frame pixels. */
+    void transformation_matrix(const tfrt::matrix_33f_rm& m);
+    tfrt::matrix_33f_rm transformation_matrix() const;
+
+private:
+    /** Move to the next tensor in the ring. Return (previous, next) tensors. */
+    std::pair<const tfrt::cuda_tensor*, tfrt::cuda_tensor*> next_slot();
+    /** Check a raw output batch slot against the segmentation output shape. */
+    void check_input(const tfrt::cuda_tensor& seg_output_raw, size_t batch_idx) const;
+
+private:
+    /** Segmentation output shape. */
+    nvinfer1::DimsCHW  m_seg_outshape;
+    /** EMA weight. */
+    float  m_alpha;
+    /** Cached transformation matrix. */
+    tfrt::cuda_tensor  m_transformation_matrix;
+    // Ring of fused probabilities tensors.
+    std::vector<tfrt::cuda_tensor>  m_ring;
+    size_t  m_head;
+    size_t  m_num_frames;
+};
+
+// ========================================================================== //
+// Instances extraction from segmentation.
+// ========================================================================== //
+/** Extract object instances from a segmentation class map: connected
+ * components of pixels sharing the same class, with area, bounding box and
+ * centroid. Instances are output as 2D bounding boxes (normalized coordinates),
+ * with the mean pixel score as score, i.e. same type as SSD detections.
+ * All buffers allocated at construction.
+ */
+class seg_instances
+{
+public:
+    /** Instances extraction parameters. */
+    struct parameters
+    {
+        /** Maximum number of instances in the output collection. */
+        size_t  max_instances;
+        /** Minimum area of a component, in pixels. */
+        uint32_t  min_area;
+        /** 8-connectivity (or 4-connectivity)? */
+        bool  connectivity8;
+        /** Number of parallel strips (0: one per thread). */
+        uint32_t  num_strips;
+
+        parameters() :
+            max_instances{256}, min_area{16}, connectivity8{true}, num_strips{0} {}
+    };
+
+public:
+    /** Build for a segmentation output shape. */
+    seg_instances(nvinfer1::DimsCHW _seg_outshape, const parameters& params=parameters());
+
+    /** Extract instances from classes and (optional) scores maps, in host
+     * memory. Above max_instances components, the largest ones are kept.
+     * Instances sorted by decreasing score, null scores at the end.
+     */
+    const boxes2d::bboxes2d& apply(const uint8_t* classes, const float* scores);
+    /** Extract instances from seg_network_post outputs. */
+    const boxes2d::bboxes2d& apply(const seg_network_post& seg_post);
+
+public:
+    /** Components labels (0: background). */
+    const std::vector<int32_t>& labels() const {
+        return m_labels;
+    }
+    /** All components statistics (before area filtering). */
+    const cpu_components& components() const {
+        return m_components;
+    }
+    /** Last instances output. */
+    const boxes2d::bboxes2d& instances() const {
+        return m_instances;
+    }
+    /** Parameters. */
+    const parameters& params() const {
+        return m_params;
+    }
+
+private:
+    /** Segmentation output shape. */
+    nvinfer1::DimsCHW  m_seg_outshape;
+    /** Parameters. */
+    parameters  m_params;
+    // Labels and union-find workspace.
+    std::vector<int32_t>  m_labels;
+    std::vector<int32_t>  m_parents;
+    // Components statistics, indexes above min area and output instances.
+    cpu_components  m_components;
+    std::vector<uint32_t>  m_order;
+    boxes2d::bboxes2d  m_instances;
+};
+
 }
 
 #endif
@@ -40,7 +40,7 @@ public:
      * a channelwise and then an elementwise.
      */
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
-        LOG(INFO) << "LAYER SSD boxes2d decode '" << this->m_scope.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER SSD boxes2d decode '" << this->m_scope.name() << "'. "
             << "Input shape: " << dims_str(net->getDimensions());
         // Channel and elementwise scalings.
         net = tfrt::scale(m_scope, "scale_channel").mode(nvinfer1::ScaleMode::kCHANNEL)(net);
@@ -93,7 +93,7 @@ public:
     virtual nvinfer1::ITensor* operator()(nvinfer1::ITensor* net) {
         typedef tfrt::convolution2d<tfrt::ActivationType::NONE, tfrt::PaddingType::SAME, false>  conv2d;
         auto& sc = this->m_scope;
-        LOG(INFO) << "LAYER SSD boxes2d block '" << sc.name() << "'. "
+        TFRT_LAYER_LOG << "LAYER SSD boxes2d block '" << sc.name() << "'. "
                 << "Input shape: " << dims_str(net->getDimensions());
         // Classification + boxes regression convolutions.
         auto net_cls = conv2d(sc, "conv_cls")
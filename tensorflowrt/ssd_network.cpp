@@ -16,6 +16,9 @@
 
 #include "utils.h"
 #include "ssd_network.h"
+#include "boxes2d/ssd.h"
+#include "boxes2d/operations.h"
+#include "tracer.h"
 
 #include "cuda/cudaImageNet.h"
 #include "cuda/cudaOverlay.h"
@@ -107,34 +110,39 @@ const std::vector<ssd_feature>& ssd_network::features() const
 bool ssd_network::load_weights(const std::string& filename)
 {
     // Free everything!
-    m_cached_features.empty();
+    m_cached_features.clear();
 
     LOG(INFO) << "Loading SSD network parameters and weights from: " << filename;
-    bool r = parse_protobuf(filename, m_pb_ssd_network.get());
-    // Hacky swaping!
-    m_pb_network.reset(m_pb_ssd_network->release_network());
-    return r;
+    return this->parse_weights(filename, m_pb_ssd_network.get(), [this]() {
+        // Hacky swaping!
+        m_pb_network.reset(m_pb_ssd_network->release_network());
+    });
 }
 
 
 tfrt::boxes2d::bboxes2d ssd_network::raw_detect2d(
         float* rgba, uint32_t height, uint32_t width, float threshold, size_t max_detections)
 {
+    TFRT_TRACE_SCOPE("ssd_network::raw_detect2d");
     CHECK(rgba) << "Invalid image buffer.";
     CHECK(height) << "Invalid image height.";
     CHECK(width) << "Invalid image width.";
     // Downsample and convert to RGB.
-    cudaError_t r = cudaPreImageNet((float4*)rgba, width, height,
-        m_cuda_input.cuda, m_cuda_input.shape.w(), m_cuda_input.shape.h());
+    cudaError_t r = this->preprocess(rgba, height, width);
     CHECK_EQ(r, cudaSuccess) << "Failed to resize image to ImageNet network input shape."
         << "CUDA error: " << r;
 
     // Execute TensorRT network (batch size = 1) TODO.
     DLOG(INFO) << "Raw 2D detections from SSD network.";
     size_t num_batches = 1;
-    m_nv_context->execute(num_batches, (void**)m_cached_bindings.data());
+    {
+        TFRT_TRACE_SCOPE("network::execute");
+        m_nv_context->execute(num_batches, (void**)m_cached_bindings.data());
+        this->outputs_to_float(num_batches);
+    }
 
     // Post-processing of outputs of every feature layer.
+    TFRT_TRACE_SCOPE("ssd_network::post_processing");
     DLOG(INFO) << "Post-processing of SSD raw outputs, selecting 2D boxes. "
         << "Max detections: " << max_detections << " Threshold: " << threshold;
     const auto& features = this->features();
@@ -153,80 +161,100 @@ tfrt::boxes2d::bboxes2d ssd_network::raw_detect2d(
     // Sort by decreasing score.
     DLOG(INFO) << "Sort SSD raw 2D boxes by decreasing score.";
     bboxes2d.sort_by_score(true);
+    // Letterboxed input: boxes back to normalized coordinates of the source image.
+    const auto inshape = this->input_shape();
+    const tfrt::letterbox& lb = this->input_letterbox(0);
+    if(!tfrt::is_stretch(lb, inshape.w(), inshape.h())) {
+        tfrt::boxes2d::unletterbox(bboxes2d, lb, inshape.w(), inshape.h());
+    }
     // Simple post-processing of outputs of every feature layer.
     return bboxes2d;
 }
 
+tfrt::boxes2d::bboxes2d ssd_network::detect2d_tiled(const nvx_image_patch& image,
+    float threshold, size_t max_detections, float nms_threshold)
+{
+    TFRT_TRACE_SCOPE("ssd_network::detect2d_tiled");
+    const tfrt::tile_grid& grid = this->inference_tiles(image);
+
+    TFRT_TRACE_SCOPE("ssd_network::post_processing");
+    std::vector<tfrt::boxes2d::ssd_raw_outputs> outputs;
+    for(auto& f : this->features()) {
+        // NCHW outputs, read in place as NACHW (see ssd_feature::predictions2d).
+        const tfrt::cuda_tensor& pred2d = *f.outputs.predictions2d;
+        const tfrt::cuda_tensor& boxes2d = *f.outputs.boxes2d;
+        const size_t num_anchors = f.num_anchors2d_total();
+        outputs.push_back(tfrt::boxes2d::ssd_raw_outputs{pred2d.cpu, boxes2d.cpu,
+            num_anchors, size_t(pred2d.shape.c()) / num_anchors,
+            size_t(pred2d.shape.h()), size_t(pred2d.shape.w())});
+    }
+    return tfrt::boxes2d::ssd_select_tiles(outputs, grid, threshold, max_detections,
+        nms_threshold);
+}
+
 void ssd_network::fill_bboxes_2d(
     const tfrt::nachw<float>::tensor& predictions2d,
     const tfrt::nachw<float>::tensor& boxesd2d,
     float threshold, size_t max_detections, size_t batch,
     size_t& bboxes2d_idx, tfrt::boxes2d::bboxes2d& bboxes2d) const
 {
-    // No silver bullet here! Have to go the hard loop-way!
-    // size_t idx{bboxes2d_idx};
-    float y, x, h, w;
-    // Loop on  height, width and anchors dimensions.
-    for(long i = 0 ; i < predictions2d.dimension(3) ; ++i) {
-        for(long j = 0 ; j < predictions2d.dimension(4) ; ++j) {
-            for(long k = 0 ; k < predictions2d.dimension(1) ; ++k) {
-                // Check index did not reach bounds...
-                if(bboxes2d_idx >= max_detections-1) {
-                    return;
-                }
-                // Initialize with no-object class.
-                size_t max_idx = 0;
-                float max_pred = predictions2d(batch, k, 0, i, j);
-                // Loop over the classes!
-                for(long l = 1 ; l < predictions2d.dimension(2) ; ++l) {
-                    if(predictions2d(batch, k, l, i, j) > max_pred) {
-                        max_idx = l;
-                        max_pred = predictions2d(batch, k, l, i, j);
-                    }
-                }
-                // Assign bounding box.
-                if(max_idx > 0 && max_pred > threshold) {
-                    bboxes2d.classes(bboxes2d_idx) = max_idx;
-                    bboxes2d.scores(bboxes2d_idx) = max_pred;
-                    // Recall: raw output in y, x, h, w format.
-                    y = boxesd2d(batch, k, 0, i, j);
-                    x = boxesd2d(batch, k, 1, i, j);
-                    h = boxesd2d(batch, k, 2, i, j);
-                    w = boxesd2d(batch, k, 3, i, j);
-                    // Convert to ymin, xmin, ymax, xmax.
-                    bboxes2d.boxes(bboxes2d_idx, 0) = y - h / 2.;
-                    bboxes2d.boxes(bboxes2d_idx, 1) = x - w / 2.;
-                    bboxes2d.boxes(bboxes2d_idx, 2) = y + h / 2.;
-                    bboxes2d.boxes(bboxes2d_idx, 3) = x + w / 2.;
-                    bboxes2d_idx++;
-                }
-            }
-        }
-    }
+    // Host selection on the batch element (NACHW layout).
+    const long num_anchors = predictions2d.dimension(1);
+    const long num_classes = predictions2d.dimension(2);
+    const long height = predictions2d.dimension(3);
+    const long width = predictions2d.dimension(4);
+    const long hw = height * width;
+    tfrt::boxes2d::ssd_select_raw(
+        predictions2d.data() + batch * num_anchors * num_classes * hw,
+        boxesd2d.data() + batch * num_anchors * 4 * hw,
+        num_anchors, num_classes, height, width,
+        threshold, max_detections, bboxes2d_idx, bboxes2d);
 }
 
 void ssd_network::draw_bboxes_2d(float* input, float* output,
     uint32_t height, uint32_t width, const tfrt::boxes2d::bboxes2d& bboxes2d) const
 {
     CHECK_NOTNULL(input);
+    CHECK_NOTNULL(output);
     CHECK(bool(width) && bool(height)) << "Provide an image with positive dimensions.";
-    // TODO: Optimize this crap!
-    for(size_t i = 0 ; i < bboxes2d.size_notnull() ; ++i) {
-        DLOG(INFO) << "Drawing 2D bounding box #" << i;
-        int n = bboxes2d.classes[i];
-        // color and bbox CUDA float4.
-        const float4 color = make_float4(m_cuda_colors_2d.cpu[n*4+0],
-                                         m_cuda_colors_2d.cpu[n*4+1],
-                                         m_cuda_colors_2d.cpu[n*4+2],
-                                         m_cuda_colors_2d.cpu[n*4+3]);
-        float4 box2d = make_float4(bboxes2d.boxes(i, 0),
-                                  bboxes2d.boxes(i, 1),
-                                  bboxes2d.boxes(i, 2),
-                                  bboxes2d.boxes(i, 3));
-        // CUDA box2d printing.
-        bool r = CUDA_FAILED(cuda2DBoxOutlineOverlay((float4*)input, (float4*)output,
-            width, height, box2d, color));
-        CHECK(r) << "CUDA failing to draw the 2D box overlay";
+    // Class colours (default one if not generated).
+    tfrt::overlay_lut lut;
+    for(int n = 0 ; n < 256 ; ++n) {
+        tfrt::overlay_color c{0, 255, 175, 100};
+        if(m_cuda_colors_2d.is_allocated() && n < m_cuda_colors_2d.shape.n()) {
+            const float* rgba = m_cuda_colors_2d.cpu + n*4;
+            c = tfrt::overlay_color{uint8_t(std::min(std::max(rgba[0], 0.0f), 255.0f)),
+                uint8_t(std::min(std::max(rgba[1], 0.0f), 255.0f)),
+                uint8_t(std::min(std::max(rgba[2], 0.0f), 255.0f)),
+                uint8_t(std::min(std::max(rgba[3], 0.0f), 255.0f))};
+        }
+        lut.set(n, c);
+    }
+    const int thickness = std::max(2, int(std::min(width, height)) / 200);
+    tfrt::boxes2d::overlay(bboxes2d, width, height, lut, thickness, m_overlay_spans);
+    // Previous draw may still read the mapped buffers.
+    CUDA(cudaStreamSynchronize(0));
+    const auto& offsets = m_overlay_spans.offsets();
+    const auto& spans = m_overlay_spans.spans();
+    if(m_cuda_overlay_offsets.shape.n() < int(offsets.size())) {
+        m_cuda_overlay_offsets.reshape({int(offsets.size()), 1, 1, 1});
+        CHECK(m_cuda_overlay_offsets.allocate());
+    }
+    if(m_cuda_overlay_spans.shape.n() < int(spans.size())) {
+        m_cuda_overlay_spans.reshape({int(spans.size()) * 2, 1, 1, 1});
+        CHECK(m_cuda_overlay_spans.allocate());
+    }
+    std::copy(offsets.begin(), offsets.end(), m_cuda_overlay_offsets.cpu);
+    std::copy(spans.begin(), spans.end(), m_cuda_overlay_spans.cpu);
+    // Output copy, then single in-place overlay launch.
+    if(input != output) {
+        CUDA(cudaMemcpyAsync(output, input, size_t(width) * height * sizeof(float4),
+            cudaMemcpyDeviceToDevice));
+    }
+    if(!spans.empty()) {
+        bool r = CUDA_FAILED(cuda_overlay_spans((float4*)output, width, height,
+            m_cuda_overlay_offsets.cuda, m_cuda_overlay_spans.cuda));
+        CHECK(!r) << "CUDA failing to draw the 2D boxes overlay";
     }
 }
 
@@ -23,6 +23,7 @@
 #include "network.h"
 #include "ssd_network.pb.h"
 #include "boxes2d/boxes2d.h"
+#include "misc/overlay.h"
 
 namespace tfrt
 {
@@ -96,7 +97,10 @@ public:
         m_cuda_colors_2d{"colors_2d", {0,4,1,1}},
         m_cuda_colors_3d{"colors_3d", {0,4,1,1}},
         m_cuda_colors_seg{"colors_seg", {0,4,1,1}},
-        m_cached_features{} {
+        m_cached_features{},
+        m_overlay_spans{},
+        m_cuda_overlay_offsets{"overlay_offsets", {0,1,1,1}},
+        m_cuda_overlay_spans{"overlay_spans", {0,1,1,1}} {
     }
     virtual ~ssd_network();
     /** Clear cached variables.  */
@@ -123,6 +127,15 @@ public:
     tfrt::boxes2d::bboxes2d raw_detect2d(
         float* rgba, uint32_t height, uint32_t width,
         float threshold, size_t max_detections);
+    /** Tiled detection of 2D objects on a high resolution RGBA uint8 frame
+     * (see network::tiling): the boxes of every tile are mapped to normalized
+     * frame coordinates, then sorted and merged by per-class non-maximum
+     * suppression (see boxes2d::ssd_select_tiles). Every tile has its own
+     * budget of max_detections raw boxes; the merged result is truncated to
+     * max_detections.
+     */
+    tfrt::boxes2d::bboxes2d detect2d_tiled(const nvx_image_patch& image,
+        float threshold, size_t max_detections, float nms_threshold=0.45f);
 
 protected:
     /** Fill 2D bounding boxes collection from raw output tensors.
@@ -134,7 +147,9 @@ protected:
         size_t& bboxes2d_idx, tfrt::boxes2d::bboxes2d& bboxes2d) const;
 
 public:
-    /** Draw 2D boxes on some CUDA image.
+    /** Draw 2D boxes on some CUDA float RGBA image: outlines and score tags
+     * (see boxes2d::overlay), coloured by class. The spans of all boxes are
+     * built on the host and blended in a single CUDA launch.
      */
     void draw_bboxes_2d(float* input, float* output, uint32_t height, uint32_t width,
         const tfrt::boxes2d::bboxes2d& bboxes2d) const;
@@ -160,6 +175,10 @@ protected:
 
     // Cached parameters.
     mutable std::vector<ssd_feature>  m_cached_features;
+    // Boxes overlay spans, and mapped copy (grown on demand).
+    mutable tfrt::overlay_spans  m_overlay_spans;
+    mutable tfrt::cuda_tensor_i32  m_cuda_overlay_offsets;
+    mutable tfrt::cuda_tensor_t<tfrt::overlay_span>  m_cuda_overlay_spans;
 };
 
 }
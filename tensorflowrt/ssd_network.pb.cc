@@ -0,0 +1,1995 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ssd_network.proto
+
+#include "ssd_network.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace tfrt_pb {
+PROTOBUF_CONSTEXPR box_scaling::box_scaling(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.y_)*/1
+  , /*decltype(_impl_.x_)*/1
+  , /*decltype(_impl_.h_)*/1
+  , /*decltype(_impl_.w_)*/1} {}
+struct box_scalingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR box_scalingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~box_scalingDefaultTypeInternal() {}
+  union {
+    box_scaling _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 box_scalingDefaultTypeInternal _box_scaling_default_instance_;
+PROTOBUF_CONSTEXPR ssd_anchor2d::ssd_anchor2d(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scales_)*/{}
+  , /*decltype(_impl_.size_)*/0} {}
+struct ssd_anchor2dDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ssd_anchor2dDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ssd_anchor2dDefaultTypeInternal() {}
+  union {
+    ssd_anchor2d _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ssd_anchor2dDefaultTypeInternal _ssd_anchor2d_default_instance_;
+PROTOBUF_CONSTEXPR ssd_feature_outputs_name::ssd_feature_outputs_name(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.predictions2d_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.boxes2d_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.predictions3d_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.boxes3d_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ssd_feature_outputs_nameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ssd_feature_outputs_nameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ssd_feature_outputs_nameDefaultTypeInternal() {}
+  union {
+    ssd_feature_outputs_name _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ssd_feature_outputs_nameDefaultTypeInternal _ssd_feature_outputs_name_default_instance_;
+PROTOBUF_CONSTEXPR ssd_feature::ssd_feature(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.anchors2d_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.fullname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shape_)*/nullptr
+  , /*decltype(_impl_.prior_scaling_)*/nullptr
+  , /*decltype(_impl_.outputs_)*/nullptr} {}
+struct ssd_featureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ssd_featureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ssd_featureDefaultTypeInternal() {}
+  union {
+    ssd_feature _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ssd_featureDefaultTypeInternal _ssd_feature_default_instance_;
+PROTOBUF_CONSTEXPR ssd_network::ssd_network(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.features_)*/{}
+  , /*decltype(_impl_.network_)*/nullptr
+  , /*decltype(_impl_.num_classes_2d_)*/0
+  , /*decltype(_impl_.num_classes_3d_)*/0
+  , /*decltype(_impl_.num_classes_seg_)*/0} {}
+struct ssd_networkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ssd_networkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ssd_networkDefaultTypeInternal() {}
+  union {
+    ssd_network _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ssd_networkDefaultTypeInternal _ssd_network_default_instance_;
+}  // namespace tfrt_pb
+static ::_pb::Metadata file_level_metadata_ssd_5fnetwork_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ssd_5fnetwork_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ssd_5fnetwork_2eproto = nullptr;
+
+const uint32_t TableStruct_ssd_5fnetwork_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::box_scaling, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::box_scaling, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::box_scaling, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::box_scaling, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::box_scaling, _impl_.h_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::box_scaling, _impl_.w_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_anchor2d, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_anchor2d, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_anchor2d, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_anchor2d, _impl_.scales_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature_outputs_name, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature_outputs_name, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature_outputs_name, _impl_.predictions2d_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature_outputs_name, _impl_.boxes2d_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature_outputs_name, _impl_.predictions3d_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature_outputs_name, _impl_.boxes3d_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_.fullname_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_.anchors2d_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_.prior_scaling_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_feature, _impl_.outputs_),
+  0,
+  1,
+  2,
+  ~0u,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _impl_.network_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _impl_.features_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _impl_.num_classes_2d_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _impl_.num_classes_3d_),
+  PROTOBUF_FIELD_OFFSET(::tfrt_pb::ssd_network, _impl_.num_classes_seg_),
+  0,
+  ~0u,
+  1,
+  2,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::tfrt_pb::box_scaling)},
+  { 14, 22, -1, sizeof(::tfrt_pb::ssd_anchor2d)},
+  { 24, 34, -1, sizeof(::tfrt_pb::ssd_feature_outputs_name)},
+  { 38, 50, -1, sizeof(::tfrt_pb::ssd_feature)},
+  { 56, 67, -1, sizeof(::tfrt_pb::ssd_network)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::tfrt_pb::_box_scaling_default_instance_._instance,
+  &::tfrt_pb::_ssd_anchor2d_default_instance_._instance,
+  &::tfrt_pb::_ssd_feature_outputs_name_default_instance_._instance,
+  &::tfrt_pb::_ssd_feature_default_instance_._instance,
+  &::tfrt_pb::_ssd_network_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ssd_5fnetwork_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021ssd_network.proto\022\007tfrt_pb\032\rnetwork.pr"
+  "oto\"E\n\013box_scaling\022\014\n\001y\030\001 \001(\002:\0011\022\014\n\001x\030\002 "
+  "\001(\002:\0011\022\014\n\001h\030\003 \001(\002:\0011\022\014\n\001w\030\004 \001(\002:\0011\"/\n\014ss"
+  "d_anchor2d\022\017\n\004size\030\001 \001(\002:\0010\022\016\n\006scales\030\002 "
+  "\003(\002\"\271\002\n\013ssd_feature\022\014\n\004name\030\001 \001(\t\022\020\n\010ful"
+  "lname\030\002 \001(\t\022\037\n\005shape\030\003 \001(\0132\020.tfrt_pb.dim"
+  "sCHW\022(\n\tanchors2d\030\004 \003(\0132\025.tfrt_pb.ssd_an"
+  "chor2d\022+\n\rprior_scaling\030\005 \001(\0132\024.tfrt_pb."
+  "box_scaling\0222\n\007outputs\030\006 \001(\0132!.tfrt_pb.s"
+  "sd_feature.outputs_name\032^\n\014outputs_name\022"
+  "\025\n\rpredictions2d\030\001 \001(\t\022\017\n\007boxes2d\030\002 \001(\t\022"
+  "\025\n\rpredictions3d\030\003 \001(\t\022\017\n\007boxes3d\030\004 \001(\t\""
+  "\252\001\n\013ssd_network\022!\n\007network\030\001 \001(\0132\020.tfrt_"
+  "pb.network\022&\n\010features\030\002 \003(\0132\024.tfrt_pb.s"
+  "sd_feature\022\031\n\016num_classes_2d\030\003 \001(\005:\0010\022\031\n"
+  "\016num_classes_3d\030\004 \001(\005:\0010\022\032\n\017num_classes_"
+  "seg\030\005 \001(\005:\0010"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ssd_5fnetwork_2eproto_deps[1] = {
+  &::descriptor_table_network_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ssd_5fnetwork_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ssd_5fnetwork_2eproto = {
+    false, false, 652, descriptor_table_protodef_ssd_5fnetwork_2eproto,
+    "ssd_network.proto",
+    &descriptor_table_ssd_5fnetwork_2eproto_once, descriptor_table_ssd_5fnetwork_2eproto_deps, 1, 5,
+    schemas, file_default_instances, TableStruct_ssd_5fnetwork_2eproto::offsets,
+    file_level_metadata_ssd_5fnetwork_2eproto, file_level_enum_descriptors_ssd_5fnetwork_2eproto,
+    file_level_service_descriptors_ssd_5fnetwork_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ssd_5fnetwork_2eproto_getter() {
+  return &descriptor_table_ssd_5fnetwork_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ssd_5fnetwork_2eproto(&descriptor_table_ssd_5fnetwork_2eproto);
+namespace tfrt_pb {
+
+// ===================================================================
+
+class box_scaling::_Internal {
+ public:
+  using HasBits = decltype(std::declval<box_scaling>()._impl_._has_bits_);
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+box_scaling::box_scaling(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.box_scaling)
+}
+box_scaling::box_scaling(const box_scaling& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  box_scaling* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.h_){}
+    , decltype(_impl_.w_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.y_, &from._impl_.y_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.w_) -
+    reinterpret_cast<char*>(&_impl_.y_)) + sizeof(_impl_.w_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.box_scaling)
+}
+
+inline void box_scaling::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.y_){1}
+    , decltype(_impl_.x_){1}
+    , decltype(_impl_.h_){1}
+    , decltype(_impl_.w_){1}
+  };
+}
+
+box_scaling::~box_scaling() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.box_scaling)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void box_scaling::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void box_scaling::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void box_scaling::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.box_scaling)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    _impl_.y_ = 1;
+    _impl_.x_ = 1;
+    _impl_.h_ = 1;
+    _impl_.w_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* box_scaling::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float y = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float x = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float h = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_h(&has_bits);
+          _impl_.h_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float w = 4 [default = 1];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_w(&has_bits);
+          _impl_.w_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* box_scaling::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.box_scaling)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float y = 1 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_y(), target);
+  }
+
+  // optional float x = 2 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_x(), target);
+  }
+
+  // optional float h = 3 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_h(), target);
+  }
+
+  // optional float w = 4 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_w(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.box_scaling)
+  return target;
+}
+
+size_t box_scaling::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.box_scaling)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional float y = 1 [default = 1];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float x = 2 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float h = 3 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float w = 4 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData box_scaling::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    box_scaling::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*box_scaling::GetClassData() const { return &_class_data_; }
+
+
+void box_scaling::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<box_scaling*>(&to_msg);
+  auto& from = static_cast<const box_scaling&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.box_scaling)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.h_ = from._impl_.h_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.w_ = from._impl_.w_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void box_scaling::CopyFrom(const box_scaling& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.box_scaling)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool box_scaling::IsInitialized() const {
+  return true;
+}
+
+void box_scaling::InternalSwap(box_scaling* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.y_, other->_impl_.y_);
+  swap(_impl_.x_, other->_impl_.x_);
+  swap(_impl_.h_, other->_impl_.h_);
+  swap(_impl_.w_, other->_impl_.w_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata box_scaling::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ssd_5fnetwork_2eproto_getter, &descriptor_table_ssd_5fnetwork_2eproto_once,
+      file_level_metadata_ssd_5fnetwork_2eproto[0]);
+}
+
+// ===================================================================
+
+class ssd_anchor2d::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ssd_anchor2d>()._impl_._has_bits_);
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ssd_anchor2d::ssd_anchor2d(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.ssd_anchor2d)
+}
+ssd_anchor2d::ssd_anchor2d(const ssd_anchor2d& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ssd_anchor2d* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scales_){from._impl_.scales_}
+    , decltype(_impl_.size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.size_ = from._impl_.size_;
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.ssd_anchor2d)
+}
+
+inline void ssd_anchor2d::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scales_){arena}
+    , decltype(_impl_.size_){0}
+  };
+}
+
+ssd_anchor2d::~ssd_anchor2d() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.ssd_anchor2d)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ssd_anchor2d::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.scales_.~RepeatedField();
+}
+
+void ssd_anchor2d::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ssd_anchor2d::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.ssd_anchor2d)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.scales_.Clear();
+  _impl_.size_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ssd_anchor2d::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float size = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float scales = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_scales(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<21>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_scales(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ssd_anchor2d::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.ssd_anchor2d)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float size = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_size(), target);
+  }
+
+  // repeated float scales = 2;
+  for (int i = 0, n = this->_internal_scales_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_scales(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.ssd_anchor2d)
+  return target;
+}
+
+size_t ssd_anchor2d::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.ssd_anchor2d)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float scales = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_scales_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_scales_size());
+    total_size += data_size;
+  }
+
+  // optional float size = 1 [default = 0];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ssd_anchor2d::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ssd_anchor2d::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ssd_anchor2d::GetClassData() const { return &_class_data_; }
+
+
+void ssd_anchor2d::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ssd_anchor2d*>(&to_msg);
+  auto& from = static_cast<const ssd_anchor2d&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.ssd_anchor2d)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.scales_.MergeFrom(from._impl_.scales_);
+  if (from._internal_has_size()) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ssd_anchor2d::CopyFrom(const ssd_anchor2d& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.ssd_anchor2d)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ssd_anchor2d::IsInitialized() const {
+  return true;
+}
+
+void ssd_anchor2d::InternalSwap(ssd_anchor2d* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.scales_.InternalSwap(&other->_impl_.scales_);
+  swap(_impl_.size_, other->_impl_.size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ssd_anchor2d::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ssd_5fnetwork_2eproto_getter, &descriptor_table_ssd_5fnetwork_2eproto_once,
+      file_level_metadata_ssd_5fnetwork_2eproto[1]);
+}
+
+// ===================================================================
+
+class ssd_feature_outputs_name::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ssd_feature_outputs_name>()._impl_._has_bits_);
+  static void set_has_predictions2d(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_boxes2d(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_predictions3d(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_boxes3d(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+ssd_feature_outputs_name::ssd_feature_outputs_name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.ssd_feature.outputs_name)
+}
+ssd_feature_outputs_name::ssd_feature_outputs_name(const ssd_feature_outputs_name& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ssd_feature_outputs_name* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.predictions2d_){}
+    , decltype(_impl_.boxes2d_){}
+    , decltype(_impl_.predictions3d_){}
+    , decltype(_impl_.boxes3d_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.predictions2d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.predictions2d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_predictions2d()) {
+    _this->_impl_.predictions2d_.Set(from._internal_predictions2d(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.boxes2d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.boxes2d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_boxes2d()) {
+    _this->_impl_.boxes2d_.Set(from._internal_boxes2d(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.predictions3d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.predictions3d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_predictions3d()) {
+    _this->_impl_.predictions3d_.Set(from._internal_predictions3d(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.boxes3d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.boxes3d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_boxes3d()) {
+    _this->_impl_.boxes3d_.Set(from._internal_boxes3d(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.ssd_feature.outputs_name)
+}
+
+inline void ssd_feature_outputs_name::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.predictions2d_){}
+    , decltype(_impl_.boxes2d_){}
+    , decltype(_impl_.predictions3d_){}
+    , decltype(_impl_.boxes3d_){}
+  };
+  _impl_.predictions2d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.predictions2d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.boxes2d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.boxes2d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.predictions3d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.predictions3d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.boxes3d_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.boxes3d_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ssd_feature_outputs_name::~ssd_feature_outputs_name() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.ssd_feature.outputs_name)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ssd_feature_outputs_name::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.predictions2d_.Destroy();
+  _impl_.boxes2d_.Destroy();
+  _impl_.predictions3d_.Destroy();
+  _impl_.boxes3d_.Destroy();
+}
+
+void ssd_feature_outputs_name::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ssd_feature_outputs_name::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.ssd_feature.outputs_name)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.predictions2d_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.boxes2d_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.predictions3d_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.boxes3d_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ssd_feature_outputs_name::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string predictions2d = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_predictions2d();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.ssd_feature.outputs_name.predictions2d");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string boxes2d = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_boxes2d();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.ssd_feature.outputs_name.boxes2d");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string predictions3d = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_predictions3d();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.ssd_feature.outputs_name.predictions3d");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string boxes3d = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_boxes3d();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.ssd_feature.outputs_name.boxes3d");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ssd_feature_outputs_name::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.ssd_feature.outputs_name)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string predictions2d = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_predictions2d().data(), static_cast<int>(this->_internal_predictions2d().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.ssd_feature.outputs_name.predictions2d");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_predictions2d(), target);
+  }
+
+  // optional string boxes2d = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_boxes2d().data(), static_cast<int>(this->_internal_boxes2d().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.ssd_feature.outputs_name.boxes2d");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_boxes2d(), target);
+  }
+
+  // optional string predictions3d = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_predictions3d().data(), static_cast<int>(this->_internal_predictions3d().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.ssd_feature.outputs_name.predictions3d");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_predictions3d(), target);
+  }
+
+  // optional string boxes3d = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_boxes3d().data(), static_cast<int>(this->_internal_boxes3d().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.ssd_feature.outputs_name.boxes3d");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_boxes3d(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.ssd_feature.outputs_name)
+  return target;
+}
+
+size_t ssd_feature_outputs_name::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.ssd_feature.outputs_name)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string predictions2d = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_predictions2d());
+    }
+
+    // optional string boxes2d = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_boxes2d());
+    }
+
+    // optional string predictions3d = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_predictions3d());
+    }
+
+    // optional string boxes3d = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_boxes3d());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ssd_feature_outputs_name::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ssd_feature_outputs_name::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ssd_feature_outputs_name::GetClassData() const { return &_class_data_; }
+
+
+void ssd_feature_outputs_name::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ssd_feature_outputs_name*>(&to_msg);
+  auto& from = static_cast<const ssd_feature_outputs_name&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.ssd_feature.outputs_name)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_predictions2d(from._internal_predictions2d());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_boxes2d(from._internal_boxes2d());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_predictions3d(from._internal_predictions3d());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_boxes3d(from._internal_boxes3d());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ssd_feature_outputs_name::CopyFrom(const ssd_feature_outputs_name& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.ssd_feature.outputs_name)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ssd_feature_outputs_name::IsInitialized() const {
+  return true;
+}
+
+void ssd_feature_outputs_name::InternalSwap(ssd_feature_outputs_name* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.predictions2d_, lhs_arena,
+      &other->_impl_.predictions2d_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.boxes2d_, lhs_arena,
+      &other->_impl_.boxes2d_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.predictions3d_, lhs_arena,
+      &other->_impl_.predictions3d_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.boxes3d_, lhs_arena,
+      &other->_impl_.boxes3d_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ssd_feature_outputs_name::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ssd_5fnetwork_2eproto_getter, &descriptor_table_ssd_5fnetwork_2eproto_once,
+      file_level_metadata_ssd_5fnetwork_2eproto[2]);
+}
+
+// ===================================================================
+
+class ssd_feature::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ssd_feature>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_fullname(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::tfrt_pb::dimsCHW& shape(const ssd_feature* msg);
+  static void set_has_shape(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::tfrt_pb::box_scaling& prior_scaling(const ssd_feature* msg);
+  static void set_has_prior_scaling(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::tfrt_pb::ssd_feature_outputs_name& outputs(const ssd_feature* msg);
+  static void set_has_outputs(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::tfrt_pb::dimsCHW&
+ssd_feature::_Internal::shape(const ssd_feature* msg) {
+  return *msg->_impl_.shape_;
+}
+const ::tfrt_pb::box_scaling&
+ssd_feature::_Internal::prior_scaling(const ssd_feature* msg) {
+  return *msg->_impl_.prior_scaling_;
+}
+const ::tfrt_pb::ssd_feature_outputs_name&
+ssd_feature::_Internal::outputs(const ssd_feature* msg) {
+  return *msg->_impl_.outputs_;
+}
+void ssd_feature::clear_shape() {
+  if (_impl_.shape_ != nullptr) _impl_.shape_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+ssd_feature::ssd_feature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.ssd_feature)
+}
+ssd_feature::ssd_feature(const ssd_feature& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ssd_feature* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.anchors2d_){from._impl_.anchors2d_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.fullname_){}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.prior_scaling_){nullptr}
+    , decltype(_impl_.outputs_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.fullname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.fullname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_fullname()) {
+    _this->_impl_.fullname_.Set(from._internal_fullname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_shape()) {
+    _this->_impl_.shape_ = new ::tfrt_pb::dimsCHW(*from._impl_.shape_);
+  }
+  if (from._internal_has_prior_scaling()) {
+    _this->_impl_.prior_scaling_ = new ::tfrt_pb::box_scaling(*from._impl_.prior_scaling_);
+  }
+  if (from._internal_has_outputs()) {
+    _this->_impl_.outputs_ = new ::tfrt_pb::ssd_feature_outputs_name(*from._impl_.outputs_);
+  }
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.ssd_feature)
+}
+
+inline void ssd_feature::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.anchors2d_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.fullname_){}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.prior_scaling_){nullptr}
+    , decltype(_impl_.outputs_){nullptr}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.fullname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.fullname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ssd_feature::~ssd_feature() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.ssd_feature)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ssd_feature::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.anchors2d_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.fullname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.shape_;
+  if (this != internal_default_instance()) delete _impl_.prior_scaling_;
+  if (this != internal_default_instance()) delete _impl_.outputs_;
+}
+
+void ssd_feature::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ssd_feature::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.ssd_feature)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.anchors2d_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.fullname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.shape_ != nullptr);
+      _impl_.shape_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.prior_scaling_ != nullptr);
+      _impl_.prior_scaling_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.outputs_ != nullptr);
+      _impl_.outputs_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ssd_feature::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.ssd_feature.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string fullname = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_fullname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "tfrt_pb.ssd_feature.fullname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.dimsCHW shape = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tfrt_pb.ssd_anchor2d anchors2d = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_anchors2d(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.box_scaling prior_scaling = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prior_scaling(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tfrt_pb.ssd_feature.outputs_name outputs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_outputs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ssd_feature::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.ssd_feature)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.ssd_feature.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string fullname = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_fullname().data(), static_cast<int>(this->_internal_fullname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "tfrt_pb.ssd_feature.fullname");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_fullname(), target);
+  }
+
+  // optional .tfrt_pb.dimsCHW shape = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::shape(this),
+        _Internal::shape(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .tfrt_pb.ssd_anchor2d anchors2d = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_anchors2d_size()); i < n; i++) {
+    const auto& repfield = this->_internal_anchors2d(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .tfrt_pb.box_scaling prior_scaling = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::prior_scaling(this),
+        _Internal::prior_scaling(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .tfrt_pb.ssd_feature.outputs_name outputs = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::outputs(this),
+        _Internal::outputs(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.ssd_feature)
+  return target;
+}
+
+size_t ssd_feature::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.ssd_feature)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tfrt_pb.ssd_anchor2d anchors2d = 4;
+  total_size += 1UL * this->_internal_anchors2d_size();
+  for (const auto& msg : this->_impl_.anchors2d_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string fullname = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_fullname());
+    }
+
+    // optional .tfrt_pb.dimsCHW shape = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.shape_);
+    }
+
+    // optional .tfrt_pb.box_scaling prior_scaling = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.prior_scaling_);
+    }
+
+    // optional .tfrt_pb.ssd_feature.outputs_name outputs = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.outputs_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ssd_feature::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ssd_feature::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ssd_feature::GetClassData() const { return &_class_data_; }
+
+
+void ssd_feature::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ssd_feature*>(&to_msg);
+  auto& from = static_cast<const ssd_feature&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.ssd_feature)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.anchors2d_.MergeFrom(from._impl_.anchors2d_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_fullname(from._internal_fullname());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_shape()->::tfrt_pb::dimsCHW::MergeFrom(
+          from._internal_shape());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_prior_scaling()->::tfrt_pb::box_scaling::MergeFrom(
+          from._internal_prior_scaling());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_outputs()->::tfrt_pb::ssd_feature_outputs_name::MergeFrom(
+          from._internal_outputs());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ssd_feature::CopyFrom(const ssd_feature& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.ssd_feature)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ssd_feature::IsInitialized() const {
+  return true;
+}
+
+void ssd_feature::InternalSwap(ssd_feature* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.anchors2d_.InternalSwap(&other->_impl_.anchors2d_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.fullname_, lhs_arena,
+      &other->_impl_.fullname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ssd_feature, _impl_.outputs_)
+      + sizeof(ssd_feature::_impl_.outputs_)
+      - PROTOBUF_FIELD_OFFSET(ssd_feature, _impl_.shape_)>(
+          reinterpret_cast<char*>(&_impl_.shape_),
+          reinterpret_cast<char*>(&other->_impl_.shape_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ssd_feature::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ssd_5fnetwork_2eproto_getter, &descriptor_table_ssd_5fnetwork_2eproto_once,
+      file_level_metadata_ssd_5fnetwork_2eproto[3]);
+}
+
+// ===================================================================
+
+class ssd_network::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ssd_network>()._impl_._has_bits_);
+  static const ::tfrt_pb::network& network(const ssd_network* msg);
+  static void set_has_network(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_classes_2d(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_classes_3d(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_num_classes_seg(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::tfrt_pb::network&
+ssd_network::_Internal::network(const ssd_network* msg) {
+  return *msg->_impl_.network_;
+}
+void ssd_network::clear_network() {
+  if (_impl_.network_ != nullptr) _impl_.network_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+ssd_network::ssd_network(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tfrt_pb.ssd_network)
+}
+ssd_network::ssd_network(const ssd_network& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ssd_network* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.network_){nullptr}
+    , decltype(_impl_.num_classes_2d_){}
+    , decltype(_impl_.num_classes_3d_){}
+    , decltype(_impl_.num_classes_seg_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_network()) {
+    _this->_impl_.network_ = new ::tfrt_pb::network(*from._impl_.network_);
+  }
+  ::memcpy(&_impl_.num_classes_2d_, &from._impl_.num_classes_2d_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_classes_seg_) -
+    reinterpret_cast<char*>(&_impl_.num_classes_2d_)) + sizeof(_impl_.num_classes_seg_));
+  // @@protoc_insertion_point(copy_constructor:tfrt_pb.ssd_network)
+}
+
+inline void ssd_network::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.features_){arena}
+    , decltype(_impl_.network_){nullptr}
+    , decltype(_impl_.num_classes_2d_){0}
+    , decltype(_impl_.num_classes_3d_){0}
+    , decltype(_impl_.num_classes_seg_){0}
+  };
+}
+
+ssd_network::~ssd_network() {
+  // @@protoc_insertion_point(destructor:tfrt_pb.ssd_network)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ssd_network::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.features_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.network_;
+}
+
+void ssd_network::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ssd_network::Clear() {
+// @@protoc_insertion_point(message_clear_start:tfrt_pb.ssd_network)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.features_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.network_ != nullptr);
+    _impl_.network_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.num_classes_2d_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_classes_seg_) -
+        reinterpret_cast<char*>(&_impl_.num_classes_2d_)) + sizeof(_impl_.num_classes_seg_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ssd_network::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .tfrt_pb.network network = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_network(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tfrt_pb.ssd_feature features = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_features(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_classes_2d = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_classes_2d(&has_bits);
+          _impl_.num_classes_2d_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_classes_3d = 4 [default = 0];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_num_classes_3d(&has_bits);
+          _impl_.num_classes_3d_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_classes_seg = 5 [default = 0];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_num_classes_seg(&has_bits);
+          _impl_.num_classes_seg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ssd_network::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tfrt_pb.ssd_network)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .tfrt_pb.network network = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::network(this),
+        _Internal::network(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .tfrt_pb.ssd_feature features = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_features_size()); i < n; i++) {
+    const auto& repfield = this->_internal_features(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional int32 num_classes_2d = 3 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_num_classes_2d(), target);
+  }
+
+  // optional int32 num_classes_3d = 4 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_num_classes_3d(), target);
+  }
+
+  // optional int32 num_classes_seg = 5 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_num_classes_seg(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tfrt_pb.ssd_network)
+  return target;
+}
+
+size_t ssd_network::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tfrt_pb.ssd_network)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tfrt_pb.ssd_feature features = 2;
+  total_size += 1UL * this->_internal_features_size();
+  for (const auto& msg : this->_impl_.features_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .tfrt_pb.network network = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.network_);
+    }
+
+    // optional int32 num_classes_2d = 3 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_classes_2d());
+    }
+
+    // optional int32 num_classes_3d = 4 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_classes_3d());
+    }
+
+    // optional int32 num_classes_seg = 5 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_classes_seg());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ssd_network::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ssd_network::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ssd_network::GetClassData() const { return &_class_data_; }
+
+
+void ssd_network::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ssd_network*>(&to_msg);
+  auto& from = static_cast<const ssd_network&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tfrt_pb.ssd_network)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.features_.MergeFrom(from._impl_.features_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_network()->::tfrt_pb::network::MergeFrom(
+          from._internal_network());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_classes_2d_ = from._impl_.num_classes_2d_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_classes_3d_ = from._impl_.num_classes_3d_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.num_classes_seg_ = from._impl_.num_classes_seg_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ssd_network::CopyFrom(const ssd_network& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tfrt_pb.ssd_network)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ssd_network::IsInitialized() const {
+  return true;
+}
+
+void ssd_network::InternalSwap(ssd_network* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.features_.InternalSwap(&other->_impl_.features_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ssd_network, _impl_.num_classes_seg_)
+      + sizeof(ssd_network::_impl_.num_classes_seg_)
+      - PROTOBUF_FIELD_OFFSET(ssd_network, _impl_.network_)>(
+          reinterpret_cast<char*>(&_impl_.network_),
+          reinterpret_cast<char*>(&other->_impl_.network_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ssd_network::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ssd_5fnetwork_2eproto_getter, &descriptor_table_ssd_5fnetwork_2eproto_once,
+      file_level_metadata_ssd_5fnetwork_2eproto[4]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace tfrt_pb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tfrt_pb::box_scaling*
+Arena::CreateMaybeMessage< ::tfrt_pb::box_scaling >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::box_scaling >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::ssd_anchor2d*
+Arena::CreateMaybeMessage< ::tfrt_pb::ssd_anchor2d >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::ssd_anchor2d >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::ssd_feature_outputs_name*
+Arena::CreateMaybeMessage< ::tfrt_pb::ssd_feature_outputs_name >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::ssd_feature_outputs_name >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::ssd_feature*
+Arena::CreateMaybeMessage< ::tfrt_pb::ssd_feature >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::ssd_feature >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tfrt_pb::ssd_network*
+Arena::CreateMaybeMessage< ::tfrt_pb::ssd_network >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tfrt_pb::ssd_network >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2344 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ssd_network.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ssd_5fnetwork_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ssd_5fnetwork_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "network.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ssd_5fnetwork_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ssd_5fnetwork_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ssd_5fnetwork_2eproto;
+namespace tfrt_pb {
+class box_scaling;
+struct box_scalingDefaultTypeInternal;
+extern box_scalingDefaultTypeInternal _box_scaling_default_instance_;
+class ssd_anchor2d;
+struct ssd_anchor2dDefaultTypeInternal;
+extern ssd_anchor2dDefaultTypeInternal _ssd_anchor2d_default_instance_;
+class ssd_feature;
+struct ssd_featureDefaultTypeInternal;
+extern ssd_featureDefaultTypeInternal _ssd_feature_default_instance_;
+class ssd_feature_outputs_name;
+struct ssd_feature_outputs_nameDefaultTypeInternal;
+extern ssd_feature_outputs_nameDefaultTypeInternal _ssd_feature_outputs_name_default_instance_;
+class ssd_network;
+struct ssd_networkDefaultTypeInternal;
+extern ssd_networkDefaultTypeInternal _ssd_network_default_instance_;
+}  // namespace tfrt_pb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::tfrt_pb::box_scaling* Arena::CreateMaybeMessage<::tfrt_pb::box_scaling>(Arena*);
+template<> ::tfrt_pb::ssd_anchor2d* Arena::CreateMaybeMessage<::tfrt_pb::ssd_anchor2d>(Arena*);
+template<> ::tfrt_pb::ssd_feature* Arena::CreateMaybeMessage<::tfrt_pb::ssd_feature>(Arena*);
+template<> ::tfrt_pb::ssd_feature_outputs_name* Arena::CreateMaybeMessage<::tfrt_pb::ssd_feature_outputs_name>(Arena*);
+template<> ::tfrt_pb::ssd_network* Arena::CreateMaybeMessage<::tfrt_pb::ssd_network>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace tfrt_pb {
+
+// ===================================================================
+
+class box_scaling final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.box_scaling) */ {
+ public:
+  inline box_scaling() : box_scaling(nullptr) {}
+  ~box_scaling() override;
+  explicit PROTOBUF_CONSTEXPR box_scaling(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  box_scaling(const box_scaling& from);
+  box_scaling(box_scaling&& from) noexcept
+    : box_scaling() {
+    *this = ::std::move(from);
+  }
+
+  inline box_scaling& operator=(const box_scaling& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline box_scaling& operator=(box_scaling&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const box_scaling& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const box_scaling* internal_default_instance() {
+    return reinterpret_cast<const box_scaling*>(
+               &_box_scaling_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(box_scaling& a, box_scaling& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(box_scaling* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(box_scaling* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  box_scaling* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<box_scaling>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const box_scaling& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const box_scaling& from) {
+    box_scaling::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(box_scaling* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.box_scaling";
+  }
+  protected:
+  explicit box_scaling(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kYFieldNumber = 1,
+    kXFieldNumber = 2,
+    kHFieldNumber = 3,
+    kWFieldNumber = 4,
+  };
+  // optional float y = 1 [default = 1];
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  float y() const;
+  void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
+
+  // optional float x = 2 [default = 1];
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  float x() const;
+  void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
+
+  // optional float h = 3 [default = 1];
+  bool has_h() const;
+  private:
+  bool _internal_has_h() const;
+  public:
+  void clear_h();
+  float h() const;
+  void set_h(float value);
+  private:
+  float _internal_h() const;
+  void _internal_set_h(float value);
+  public:
+
+  // optional float w = 4 [default = 1];
+  bool has_w() const;
+  private:
+  bool _internal_has_w() const;
+  public:
+  void clear_w();
+  float w() const;
+  void set_w(float value);
+  private:
+  float _internal_w() const;
+  void _internal_set_w(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.box_scaling)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float y_;
+    float x_;
+    float h_;
+    float w_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ssd_5fnetwork_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ssd_anchor2d final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.ssd_anchor2d) */ {
+ public:
+  inline ssd_anchor2d() : ssd_anchor2d(nullptr) {}
+  ~ssd_anchor2d() override;
+  explicit PROTOBUF_CONSTEXPR ssd_anchor2d(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ssd_anchor2d(const ssd_anchor2d& from);
+  ssd_anchor2d(ssd_anchor2d&& from) noexcept
+    : ssd_anchor2d() {
+    *this = ::std::move(from);
+  }
+
+  inline ssd_anchor2d& operator=(const ssd_anchor2d& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ssd_anchor2d& operator=(ssd_anchor2d&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ssd_anchor2d& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ssd_anchor2d* internal_default_instance() {
+    return reinterpret_cast<const ssd_anchor2d*>(
+               &_ssd_anchor2d_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ssd_anchor2d& a, ssd_anchor2d& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ssd_anchor2d* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ssd_anchor2d* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ssd_anchor2d* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ssd_anchor2d>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ssd_anchor2d& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ssd_anchor2d& from) {
+    ssd_anchor2d::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ssd_anchor2d* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.ssd_anchor2d";
+  }
+  protected:
+  explicit ssd_anchor2d(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScalesFieldNumber = 2,
+    kSizeFieldNumber = 1,
+  };
+  // repeated float scales = 2;
+  int scales_size() const;
+  private:
+  int _internal_scales_size() const;
+  public:
+  void clear_scales();
+  private:
+  float _internal_scales(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_scales() const;
+  void _internal_add_scales(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_scales();
+  public:
+  float scales(int index) const;
+  void set_scales(int index, float value);
+  void add_scales(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      scales() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_scales();
+
+  // optional float size = 1 [default = 0];
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  float size() const;
+  void set_size(float value);
+  private:
+  float _internal_size() const;
+  void _internal_set_size(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.ssd_anchor2d)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > scales_;
+    float size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ssd_5fnetwork_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ssd_feature_outputs_name final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.ssd_feature.outputs_name) */ {
+ public:
+  inline ssd_feature_outputs_name() : ssd_feature_outputs_name(nullptr) {}
+  ~ssd_feature_outputs_name() override;
+  explicit PROTOBUF_CONSTEXPR ssd_feature_outputs_name(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ssd_feature_outputs_name(const ssd_feature_outputs_name& from);
+  ssd_feature_outputs_name(ssd_feature_outputs_name&& from) noexcept
+    : ssd_feature_outputs_name() {
+    *this = ::std::move(from);
+  }
+
+  inline ssd_feature_outputs_name& operator=(const ssd_feature_outputs_name& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ssd_feature_outputs_name& operator=(ssd_feature_outputs_name&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ssd_feature_outputs_name& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ssd_feature_outputs_name* internal_default_instance() {
+    return reinterpret_cast<const ssd_feature_outputs_name*>(
+               &_ssd_feature_outputs_name_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ssd_feature_outputs_name& a, ssd_feature_outputs_name& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ssd_feature_outputs_name* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ssd_feature_outputs_name* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ssd_feature_outputs_name* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ssd_feature_outputs_name>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ssd_feature_outputs_name& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ssd_feature_outputs_name& from) {
+    ssd_feature_outputs_name::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ssd_feature_outputs_name* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.ssd_feature.outputs_name";
+  }
+  protected:
+  explicit ssd_feature_outputs_name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPredictions2DFieldNumber = 1,
+    kBoxes2DFieldNumber = 2,
+    kPredictions3DFieldNumber = 3,
+    kBoxes3DFieldNumber = 4,
+  };
+  // optional string predictions2d = 1;
+  bool has_predictions2d() const;
+  private:
+  bool _internal_has_predictions2d() const;
+  public:
+  void clear_predictions2d();
+  const std::string& predictions2d() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_predictions2d(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_predictions2d();
+  PROTOBUF_NODISCARD std::string* release_predictions2d();
+  void set_allocated_predictions2d(std::string* predictions2d);
+  private:
+  const std::string& _internal_predictions2d() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_predictions2d(const std::string& value);
+  std::string* _internal_mutable_predictions2d();
+  public:
+
+  // optional string boxes2d = 2;
+  bool has_boxes2d() const;
+  private:
+  bool _internal_has_boxes2d() const;
+  public:
+  void clear_boxes2d();
+  const std::string& boxes2d() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_boxes2d(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_boxes2d();
+  PROTOBUF_NODISCARD std::string* release_boxes2d();
+  void set_allocated_boxes2d(std::string* boxes2d);
+  private:
+  const std::string& _internal_boxes2d() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_boxes2d(const std::string& value);
+  std::string* _internal_mutable_boxes2d();
+  public:
+
+  // optional string predictions3d = 3;
+  bool has_predictions3d() const;
+  private:
+  bool _internal_has_predictions3d() const;
+  public:
+  void clear_predictions3d();
+  const std::string& predictions3d() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_predictions3d(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_predictions3d();
+  PROTOBUF_NODISCARD std::string* release_predictions3d();
+  void set_allocated_predictions3d(std::string* predictions3d);
+  private:
+  const std::string& _internal_predictions3d() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_predictions3d(const std::string& value);
+  std::string* _internal_mutable_predictions3d();
+  public:
+
+  // optional string boxes3d = 4;
+  bool has_boxes3d() const;
+  private:
+  bool _internal_has_boxes3d() const;
+  public:
+  void clear_boxes3d();
+  const std::string& boxes3d() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_boxes3d(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_boxes3d();
+  PROTOBUF_NODISCARD std::string* release_boxes3d();
+  void set_allocated_boxes3d(std::string* boxes3d);
+  private:
+  const std::string& _internal_boxes3d() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_boxes3d(const std::string& value);
+  std::string* _internal_mutable_boxes3d();
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.ssd_feature.outputs_name)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr predictions2d_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr boxes2d_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr predictions3d_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr boxes3d_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ssd_5fnetwork_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ssd_feature final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.ssd_feature) */ {
+ public:
+  inline ssd_feature() : ssd_feature(nullptr) {}
+  ~ssd_feature() override;
+  explicit PROTOBUF_CONSTEXPR ssd_feature(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ssd_feature(const ssd_feature& from);
+  ssd_feature(ssd_feature&& from) noexcept
+    : ssd_feature() {
+    *this = ::std::move(from);
+  }
+
+  inline ssd_feature& operator=(const ssd_feature& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ssd_feature& operator=(ssd_feature&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ssd_feature& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ssd_feature* internal_default_instance() {
+    return reinterpret_cast<const ssd_feature*>(
+               &_ssd_feature_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ssd_feature& a, ssd_feature& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ssd_feature* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ssd_feature* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ssd_feature* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ssd_feature>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ssd_feature& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ssd_feature& from) {
+    ssd_feature::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ssd_feature* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.ssd_feature";
+  }
+  protected:
+  explicit ssd_feature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ssd_feature_outputs_name outputs_name;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnchors2DFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kFullnameFieldNumber = 2,
+    kShapeFieldNumber = 3,
+    kPriorScalingFieldNumber = 5,
+    kOutputsFieldNumber = 6,
+  };
+  // repeated .tfrt_pb.ssd_anchor2d anchors2d = 4;
+  int anchors2d_size() const;
+  private:
+  int _internal_anchors2d_size() const;
+  public:
+  void clear_anchors2d();
+  ::tfrt_pb::ssd_anchor2d* mutable_anchors2d(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_anchor2d >*
+      mutable_anchors2d();
+  private:
+  const ::tfrt_pb::ssd_anchor2d& _internal_anchors2d(int index) const;
+  ::tfrt_pb::ssd_anchor2d* _internal_add_anchors2d();
+  public:
+  const ::tfrt_pb::ssd_anchor2d& anchors2d(int index) const;
+  ::tfrt_pb::ssd_anchor2d* add_anchors2d();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_anchor2d >&
+      anchors2d() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string fullname = 2;
+  bool has_fullname() const;
+  private:
+  bool _internal_has_fullname() const;
+  public:
+  void clear_fullname();
+  const std::string& fullname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_fullname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_fullname();
+  PROTOBUF_NODISCARD std::string* release_fullname();
+  void set_allocated_fullname(std::string* fullname);
+  private:
+  const std::string& _internal_fullname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_fullname(const std::string& value);
+  std::string* _internal_mutable_fullname();
+  public:
+
+  // optional .tfrt_pb.dimsCHW shape = 3;
+  bool has_shape() const;
+  private:
+  bool _internal_has_shape() const;
+  public:
+  void clear_shape();
+  const ::tfrt_pb::dimsCHW& shape() const;
+  PROTOBUF_NODISCARD ::tfrt_pb::dimsCHW* release_shape();
+  ::tfrt_pb::dimsCHW* mutable_shape();
+  void set_allocated_shape(::tfrt_pb::dimsCHW* shape);
+  private:
+  const ::tfrt_pb::dimsCHW& _internal_shape() const;
+  ::tfrt_pb::dimsCHW* _internal_mutable_shape();
+  public:
+  void unsafe_arena_set_allocated_shape(
+      ::tfrt_pb::dimsCHW* shape);
+  ::tfrt_pb::dimsCHW* unsafe_arena_release_shape();
+
+  // optional .tfrt_pb.box_scaling prior_scaling = 5;
+  bool has_prior_scaling() const;
+  private:
+  bool _internal_has_prior_scaling() const;
+  public:
+  void clear_prior_scaling();
+  const ::tfrt_pb::box_scaling& prior_scaling() const;
+  PROTOBUF_NODISCARD ::tfrt_pb::box_scaling* release_prior_scaling();
+  ::tfrt_pb::box_scaling* mutable_prior_scaling();
+  void set_allocated_prior_scaling(::tfrt_pb::box_scaling* prior_scaling);
+  private:
+  const ::tfrt_pb::box_scaling& _internal_prior_scaling() const;
+  ::tfrt_pb::box_scaling* _internal_mutable_prior_scaling();
+  public:
+  void unsafe_arena_set_allocated_prior_scaling(
+      ::tfrt_pb::box_scaling* prior_scaling);
+  ::tfrt_pb::box_scaling* unsafe_arena_release_prior_scaling();
+
+  // optional .tfrt_pb.ssd_feature.outputs_name outputs = 6;
+  bool has_outputs() const;
+  private:
+  bool _internal_has_outputs() const;
+  public:
+  void clear_outputs();
+  const ::tfrt_pb::ssd_feature_outputs_name& outputs() const;
+  PROTOBUF_NODISCARD ::tfrt_pb::ssd_feature_outputs_name* release_outputs();
+  ::tfrt_pb::ssd_feature_outputs_name* mutable_outputs();
+  void set_allocated_outputs(::tfrt_pb::ssd_feature_outputs_name* outputs);
+  private:
+  const ::tfrt_pb::ssd_feature_outputs_name& _internal_outputs() const;
+  ::tfrt_pb::ssd_feature_outputs_name* _internal_mutable_outputs();
+  public:
+  void unsafe_arena_set_allocated_outputs(
+      ::tfrt_pb::ssd_feature_outputs_name* outputs);
+  ::tfrt_pb::ssd_feature_outputs_name* unsafe_arena_release_outputs();
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.ssd_feature)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_anchor2d > anchors2d_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr fullname_;
+    ::tfrt_pb::dimsCHW* shape_;
+    ::tfrt_pb::box_scaling* prior_scaling_;
+    ::tfrt_pb::ssd_feature_outputs_name* outputs_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ssd_5fnetwork_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ssd_network final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tfrt_pb.ssd_network) */ {
+ public:
+  inline ssd_network() : ssd_network(nullptr) {}
+  ~ssd_network() override;
+  explicit PROTOBUF_CONSTEXPR ssd_network(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ssd_network(const ssd_network& from);
+  ssd_network(ssd_network&& from) noexcept
+    : ssd_network() {
+    *this = ::std::move(from);
+  }
+
+  inline ssd_network& operator=(const ssd_network& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ssd_network& operator=(ssd_network&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ssd_network& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ssd_network* internal_default_instance() {
+    return reinterpret_cast<const ssd_network*>(
+               &_ssd_network_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ssd_network& a, ssd_network& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ssd_network* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ssd_network* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ssd_network* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ssd_network>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ssd_network& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ssd_network& from) {
+    ssd_network::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ssd_network* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tfrt_pb.ssd_network";
+  }
+  protected:
+  explicit ssd_network(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFeaturesFieldNumber = 2,
+    kNetworkFieldNumber = 1,
+    kNumClasses2DFieldNumber = 3,
+    kNumClasses3DFieldNumber = 4,
+    kNumClassesSegFieldNumber = 5,
+  };
+  // repeated .tfrt_pb.ssd_feature features = 2;
+  int features_size() const;
+  private:
+  int _internal_features_size() const;
+  public:
+  void clear_features();
+  ::tfrt_pb::ssd_feature* mutable_features(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_feature >*
+      mutable_features();
+  private:
+  const ::tfrt_pb::ssd_feature& _internal_features(int index) const;
+  ::tfrt_pb::ssd_feature* _internal_add_features();
+  public:
+  const ::tfrt_pb::ssd_feature& features(int index) const;
+  ::tfrt_pb::ssd_feature* add_features();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_feature >&
+      features() const;
+
+  // optional .tfrt_pb.network network = 1;
+  bool has_network() const;
+  private:
+  bool _internal_has_network() const;
+  public:
+  void clear_network();
+  const ::tfrt_pb::network& network() const;
+  PROTOBUF_NODISCARD ::tfrt_pb::network* release_network();
+  ::tfrt_pb::network* mutable_network();
+  void set_allocated_network(::tfrt_pb::network* network);
+  private:
+  const ::tfrt_pb::network& _internal_network() const;
+  ::tfrt_pb::network* _internal_mutable_network();
+  public:
+  void unsafe_arena_set_allocated_network(
+      ::tfrt_pb::network* network);
+  ::tfrt_pb::network* unsafe_arena_release_network();
+
+  // optional int32 num_classes_2d = 3 [default = 0];
+  bool has_num_classes_2d() const;
+  private:
+  bool _internal_has_num_classes_2d() const;
+  public:
+  void clear_num_classes_2d();
+  int32_t num_classes_2d() const;
+  void set_num_classes_2d(int32_t value);
+  private:
+  int32_t _internal_num_classes_2d() const;
+  void _internal_set_num_classes_2d(int32_t value);
+  public:
+
+  // optional int32 num_classes_3d = 4 [default = 0];
+  bool has_num_classes_3d() const;
+  private:
+  bool _internal_has_num_classes_3d() const;
+  public:
+  void clear_num_classes_3d();
+  int32_t num_classes_3d() const;
+  void set_num_classes_3d(int32_t value);
+  private:
+  int32_t _internal_num_classes_3d() const;
+  void _internal_set_num_classes_3d(int32_t value);
+  public:
+
+  // optional int32 num_classes_seg = 5 [default = 0];
+  bool has_num_classes_seg() const;
+  private:
+  bool _internal_has_num_classes_seg() const;
+  public:
+  void clear_num_classes_seg();
+  int32_t num_classes_seg() const;
+  void set_num_classes_seg(int32_t value);
+  private:
+  int32_t _internal_num_classes_seg() const;
+  void _internal_set_num_classes_seg(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tfrt_pb.ssd_network)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_feature > features_;
+    ::tfrt_pb::network* network_;
+    int32_t num_classes_2d_;
+    int32_t num_classes_3d_;
+    int32_t num_classes_seg_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ssd_5fnetwork_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// box_scaling
+
+// optional float y = 1 [default = 1];
+inline bool box_scaling::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool box_scaling::has_y() const {
+  return _internal_has_y();
+}
+inline void box_scaling::clear_y() {
+  _impl_.y_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float box_scaling::_internal_y() const {
+  return _impl_.y_;
+}
+inline float box_scaling::y() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.box_scaling.y)
+  return _internal_y();
+}
+inline void box_scaling::_internal_set_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.y_ = value;
+}
+inline void box_scaling::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.box_scaling.y)
+}
+
+// optional float x = 2 [default = 1];
+inline bool box_scaling::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool box_scaling::has_x() const {
+  return _internal_has_x();
+}
+inline void box_scaling::clear_x() {
+  _impl_.x_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float box_scaling::_internal_x() const {
+  return _impl_.x_;
+}
+inline float box_scaling::x() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.box_scaling.x)
+  return _internal_x();
+}
+inline void box_scaling::_internal_set_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.x_ = value;
+}
+inline void box_scaling::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.box_scaling.x)
+}
+
+// optional float h = 3 [default = 1];
+inline bool box_scaling::_internal_has_h() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool box_scaling::has_h() const {
+  return _internal_has_h();
+}
+inline void box_scaling::clear_h() {
+  _impl_.h_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float box_scaling::_internal_h() const {
+  return _impl_.h_;
+}
+inline float box_scaling::h() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.box_scaling.h)
+  return _internal_h();
+}
+inline void box_scaling::_internal_set_h(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.h_ = value;
+}
+inline void box_scaling::set_h(float value) {
+  _internal_set_h(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.box_scaling.h)
+}
+
+// optional float w = 4 [default = 1];
+inline bool box_scaling::_internal_has_w() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool box_scaling::has_w() const {
+  return _internal_has_w();
+}
+inline void box_scaling::clear_w() {
+  _impl_.w_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float box_scaling::_internal_w() const {
+  return _impl_.w_;
+}
+inline float box_scaling::w() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.box_scaling.w)
+  return _internal_w();
+}
+inline void box_scaling::_internal_set_w(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.w_ = value;
+}
+inline void box_scaling::set_w(float value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.box_scaling.w)
+}
+
+// -------------------------------------------------------------------
+
+// ssd_anchor2d
+
+// optional float size = 1 [default = 0];
+inline bool ssd_anchor2d::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ssd_anchor2d::has_size() const {
+  return _internal_has_size();
+}
+inline void ssd_anchor2d::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float ssd_anchor2d::_internal_size() const {
+  return _impl_.size_;
+}
+inline float ssd_anchor2d::size() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_anchor2d.size)
+  return _internal_size();
+}
+inline void ssd_anchor2d::_internal_set_size(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.size_ = value;
+}
+inline void ssd_anchor2d::set_size(float value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_anchor2d.size)
+}
+
+// repeated float scales = 2;
+inline int ssd_anchor2d::_internal_scales_size() const {
+  return _impl_.scales_.size();
+}
+inline int ssd_anchor2d::scales_size() const {
+  return _internal_scales_size();
+}
+inline void ssd_anchor2d::clear_scales() {
+  _impl_.scales_.Clear();
+}
+inline float ssd_anchor2d::_internal_scales(int index) const {
+  return _impl_.scales_.Get(index);
+}
+inline float ssd_anchor2d::scales(int index) const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_anchor2d.scales)
+  return _internal_scales(index);
+}
+inline void ssd_anchor2d::set_scales(int index, float value) {
+  _impl_.scales_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_anchor2d.scales)
+}
+inline void ssd_anchor2d::_internal_add_scales(float value) {
+  _impl_.scales_.Add(value);
+}
+inline void ssd_anchor2d::add_scales(float value) {
+  _internal_add_scales(value);
+  // @@protoc_insertion_point(field_add:tfrt_pb.ssd_anchor2d.scales)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ssd_anchor2d::_internal_scales() const {
+  return _impl_.scales_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ssd_anchor2d::scales() const {
+  // @@protoc_insertion_point(field_list:tfrt_pb.ssd_anchor2d.scales)
+  return _internal_scales();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ssd_anchor2d::_internal_mutable_scales() {
+  return &_impl_.scales_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ssd_anchor2d::mutable_scales() {
+  // @@protoc_insertion_point(field_mutable_list:tfrt_pb.ssd_anchor2d.scales)
+  return _internal_mutable_scales();
+}
+
+// -------------------------------------------------------------------
+
+// ssd_feature_outputs_name
+
+// optional string predictions2d = 1;
+inline bool ssd_feature_outputs_name::_internal_has_predictions2d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ssd_feature_outputs_name::has_predictions2d() const {
+  return _internal_has_predictions2d();
+}
+inline void ssd_feature_outputs_name::clear_predictions2d() {
+  _impl_.predictions2d_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ssd_feature_outputs_name::predictions2d() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.outputs_name.predictions2d)
+  return _internal_predictions2d();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ssd_feature_outputs_name::set_predictions2d(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.predictions2d_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_feature.outputs_name.predictions2d)
+}
+inline std::string* ssd_feature_outputs_name::mutable_predictions2d() {
+  std::string* _s = _internal_mutable_predictions2d();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.outputs_name.predictions2d)
+  return _s;
+}
+inline const std::string& ssd_feature_outputs_name::_internal_predictions2d() const {
+  return _impl_.predictions2d_.Get();
+}
+inline void ssd_feature_outputs_name::_internal_set_predictions2d(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.predictions2d_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::_internal_mutable_predictions2d() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.predictions2d_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::release_predictions2d() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.outputs_name.predictions2d)
+  if (!_internal_has_predictions2d()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.predictions2d_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.predictions2d_.IsDefault()) {
+    _impl_.predictions2d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ssd_feature_outputs_name::set_allocated_predictions2d(std::string* predictions2d) {
+  if (predictions2d != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.predictions2d_.SetAllocated(predictions2d, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.predictions2d_.IsDefault()) {
+    _impl_.predictions2d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.outputs_name.predictions2d)
+}
+
+// optional string boxes2d = 2;
+inline bool ssd_feature_outputs_name::_internal_has_boxes2d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ssd_feature_outputs_name::has_boxes2d() const {
+  return _internal_has_boxes2d();
+}
+inline void ssd_feature_outputs_name::clear_boxes2d() {
+  _impl_.boxes2d_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ssd_feature_outputs_name::boxes2d() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.outputs_name.boxes2d)
+  return _internal_boxes2d();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ssd_feature_outputs_name::set_boxes2d(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.boxes2d_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_feature.outputs_name.boxes2d)
+}
+inline std::string* ssd_feature_outputs_name::mutable_boxes2d() {
+  std::string* _s = _internal_mutable_boxes2d();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.outputs_name.boxes2d)
+  return _s;
+}
+inline const std::string& ssd_feature_outputs_name::_internal_boxes2d() const {
+  return _impl_.boxes2d_.Get();
+}
+inline void ssd_feature_outputs_name::_internal_set_boxes2d(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.boxes2d_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::_internal_mutable_boxes2d() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.boxes2d_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::release_boxes2d() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.outputs_name.boxes2d)
+  if (!_internal_has_boxes2d()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.boxes2d_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.boxes2d_.IsDefault()) {
+    _impl_.boxes2d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ssd_feature_outputs_name::set_allocated_boxes2d(std::string* boxes2d) {
+  if (boxes2d != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.boxes2d_.SetAllocated(boxes2d, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.boxes2d_.IsDefault()) {
+    _impl_.boxes2d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.outputs_name.boxes2d)
+}
+
+// optional string predictions3d = 3;
+inline bool ssd_feature_outputs_name::_internal_has_predictions3d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ssd_feature_outputs_name::has_predictions3d() const {
+  return _internal_has_predictions3d();
+}
+inline void ssd_feature_outputs_name::clear_predictions3d() {
+  _impl_.predictions3d_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ssd_feature_outputs_name::predictions3d() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.outputs_name.predictions3d)
+  return _internal_predictions3d();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ssd_feature_outputs_name::set_predictions3d(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.predictions3d_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_feature.outputs_name.predictions3d)
+}
+inline std::string* ssd_feature_outputs_name::mutable_predictions3d() {
+  std::string* _s = _internal_mutable_predictions3d();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.outputs_name.predictions3d)
+  return _s;
+}
+inline const std::string& ssd_feature_outputs_name::_internal_predictions3d() const {
+  return _impl_.predictions3d_.Get();
+}
+inline void ssd_feature_outputs_name::_internal_set_predictions3d(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.predictions3d_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::_internal_mutable_predictions3d() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.predictions3d_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::release_predictions3d() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.outputs_name.predictions3d)
+  if (!_internal_has_predictions3d()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.predictions3d_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.predictions3d_.IsDefault()) {
+    _impl_.predictions3d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ssd_feature_outputs_name::set_allocated_predictions3d(std::string* predictions3d) {
+  if (predictions3d != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.predictions3d_.SetAllocated(predictions3d, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.predictions3d_.IsDefault()) {
+    _impl_.predictions3d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.outputs_name.predictions3d)
+}
+
+// optional string boxes3d = 4;
+inline bool ssd_feature_outputs_name::_internal_has_boxes3d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ssd_feature_outputs_name::has_boxes3d() const {
+  return _internal_has_boxes3d();
+}
+inline void ssd_feature_outputs_name::clear_boxes3d() {
+  _impl_.boxes3d_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& ssd_feature_outputs_name::boxes3d() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.outputs_name.boxes3d)
+  return _internal_boxes3d();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ssd_feature_outputs_name::set_boxes3d(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.boxes3d_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_feature.outputs_name.boxes3d)
+}
+inline std::string* ssd_feature_outputs_name::mutable_boxes3d() {
+  std::string* _s = _internal_mutable_boxes3d();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.outputs_name.boxes3d)
+  return _s;
+}
+inline const std::string& ssd_feature_outputs_name::_internal_boxes3d() const {
+  return _impl_.boxes3d_.Get();
+}
+inline void ssd_feature_outputs_name::_internal_set_boxes3d(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.boxes3d_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::_internal_mutable_boxes3d() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.boxes3d_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ssd_feature_outputs_name::release_boxes3d() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.outputs_name.boxes3d)
+  if (!_internal_has_boxes3d()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.boxes3d_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.boxes3d_.IsDefault()) {
+    _impl_.boxes3d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ssd_feature_outputs_name::set_allocated_boxes3d(std::string* boxes3d) {
+  if (boxes3d != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.boxes3d_.SetAllocated(boxes3d, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.boxes3d_.IsDefault()) {
+    _impl_.boxes3d_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.outputs_name.boxes3d)
+}
+
+// -------------------------------------------------------------------
+
+// ssd_feature
+
+// optional string name = 1;
+inline bool ssd_feature::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ssd_feature::has_name() const {
+  return _internal_has_name();
+}
+inline void ssd_feature::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ssd_feature::name() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ssd_feature::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_feature.name)
+}
+inline std::string* ssd_feature::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.name)
+  return _s;
+}
+inline const std::string& ssd_feature::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ssd_feature::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ssd_feature::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ssd_feature::release_name() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ssd_feature::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.name)
+}
+
+// optional string fullname = 2;
+inline bool ssd_feature::_internal_has_fullname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ssd_feature::has_fullname() const {
+  return _internal_has_fullname();
+}
+inline void ssd_feature::clear_fullname() {
+  _impl_.fullname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ssd_feature::fullname() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.fullname)
+  return _internal_fullname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ssd_feature::set_fullname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.fullname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_feature.fullname)
+}
+inline std::string* ssd_feature::mutable_fullname() {
+  std::string* _s = _internal_mutable_fullname();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.fullname)
+  return _s;
+}
+inline const std::string& ssd_feature::_internal_fullname() const {
+  return _impl_.fullname_.Get();
+}
+inline void ssd_feature::_internal_set_fullname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.fullname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ssd_feature::_internal_mutable_fullname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.fullname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ssd_feature::release_fullname() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.fullname)
+  if (!_internal_has_fullname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.fullname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fullname_.IsDefault()) {
+    _impl_.fullname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ssd_feature::set_allocated_fullname(std::string* fullname) {
+  if (fullname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.fullname_.SetAllocated(fullname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fullname_.IsDefault()) {
+    _impl_.fullname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.fullname)
+}
+
+// optional .tfrt_pb.dimsCHW shape = 3;
+inline bool ssd_feature::_internal_has_shape() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.shape_ != nullptr);
+  return value;
+}
+inline bool ssd_feature::has_shape() const {
+  return _internal_has_shape();
+}
+inline const ::tfrt_pb::dimsCHW& ssd_feature::_internal_shape() const {
+  const ::tfrt_pb::dimsCHW* p = _impl_.shape_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tfrt_pb::dimsCHW&>(
+      ::tfrt_pb::_dimsCHW_default_instance_);
+}
+inline const ::tfrt_pb::dimsCHW& ssd_feature::shape() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.shape)
+  return _internal_shape();
+}
+inline void ssd_feature::unsafe_arena_set_allocated_shape(
+    ::tfrt_pb::dimsCHW* shape) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shape_);
+  }
+  _impl_.shape_ = shape;
+  if (shape) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tfrt_pb.ssd_feature.shape)
+}
+inline ::tfrt_pb::dimsCHW* ssd_feature::release_shape() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::tfrt_pb::dimsCHW* temp = _impl_.shape_;
+  _impl_.shape_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tfrt_pb::dimsCHW* ssd_feature::unsafe_arena_release_shape() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.shape)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::tfrt_pb::dimsCHW* temp = _impl_.shape_;
+  _impl_.shape_ = nullptr;
+  return temp;
+}
+inline ::tfrt_pb::dimsCHW* ssd_feature::_internal_mutable_shape() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.shape_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tfrt_pb::dimsCHW>(GetArenaForAllocation());
+    _impl_.shape_ = p;
+  }
+  return _impl_.shape_;
+}
+inline ::tfrt_pb::dimsCHW* ssd_feature::mutable_shape() {
+  ::tfrt_pb::dimsCHW* _msg = _internal_mutable_shape();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.shape)
+  return _msg;
+}
+inline void ssd_feature::set_allocated_shape(::tfrt_pb::dimsCHW* shape) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shape_);
+  }
+  if (shape) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(shape));
+    if (message_arena != submessage_arena) {
+      shape = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shape, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.shape_ = shape;
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.shape)
+}
+
+// repeated .tfrt_pb.ssd_anchor2d anchors2d = 4;
+inline int ssd_feature::_internal_anchors2d_size() const {
+  return _impl_.anchors2d_.size();
+}
+inline int ssd_feature::anchors2d_size() const {
+  return _internal_anchors2d_size();
+}
+inline void ssd_feature::clear_anchors2d() {
+  _impl_.anchors2d_.Clear();
+}
+inline ::tfrt_pb::ssd_anchor2d* ssd_feature::mutable_anchors2d(int index) {
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.anchors2d)
+  return _impl_.anchors2d_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_anchor2d >*
+ssd_feature::mutable_anchors2d() {
+  // @@protoc_insertion_point(field_mutable_list:tfrt_pb.ssd_feature.anchors2d)
+  return &_impl_.anchors2d_;
+}
+inline const ::tfrt_pb::ssd_anchor2d& ssd_feature::_internal_anchors2d(int index) const {
+  return _impl_.anchors2d_.Get(index);
+}
+inline const ::tfrt_pb::ssd_anchor2d& ssd_feature::anchors2d(int index) const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.anchors2d)
+  return _internal_anchors2d(index);
+}
+inline ::tfrt_pb::ssd_anchor2d* ssd_feature::_internal_add_anchors2d() {
+  return _impl_.anchors2d_.Add();
+}
+inline ::tfrt_pb::ssd_anchor2d* ssd_feature::add_anchors2d() {
+  ::tfrt_pb::ssd_anchor2d* _add = _internal_add_anchors2d();
+  // @@protoc_insertion_point(field_add:tfrt_pb.ssd_feature.anchors2d)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_anchor2d >&
+ssd_feature::anchors2d() const {
+  // @@protoc_insertion_point(field_list:tfrt_pb.ssd_feature.anchors2d)
+  return _impl_.anchors2d_;
+}
+
+// optional .tfrt_pb.box_scaling prior_scaling = 5;
+inline bool ssd_feature::_internal_has_prior_scaling() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.prior_scaling_ != nullptr);
+  return value;
+}
+inline bool ssd_feature::has_prior_scaling() const {
+  return _internal_has_prior_scaling();
+}
+inline void ssd_feature::clear_prior_scaling() {
+  if (_impl_.prior_scaling_ != nullptr) _impl_.prior_scaling_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::tfrt_pb::box_scaling& ssd_feature::_internal_prior_scaling() const {
+  const ::tfrt_pb::box_scaling* p = _impl_.prior_scaling_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tfrt_pb::box_scaling&>(
+      ::tfrt_pb::_box_scaling_default_instance_);
+}
+inline const ::tfrt_pb::box_scaling& ssd_feature::prior_scaling() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.prior_scaling)
+  return _internal_prior_scaling();
+}
+inline void ssd_feature::unsafe_arena_set_allocated_prior_scaling(
+    ::tfrt_pb::box_scaling* prior_scaling) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.prior_scaling_);
+  }
+  _impl_.prior_scaling_ = prior_scaling;
+  if (prior_scaling) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tfrt_pb.ssd_feature.prior_scaling)
+}
+inline ::tfrt_pb::box_scaling* ssd_feature::release_prior_scaling() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::tfrt_pb::box_scaling* temp = _impl_.prior_scaling_;
+  _impl_.prior_scaling_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tfrt_pb::box_scaling* ssd_feature::unsafe_arena_release_prior_scaling() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.prior_scaling)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::tfrt_pb::box_scaling* temp = _impl_.prior_scaling_;
+  _impl_.prior_scaling_ = nullptr;
+  return temp;
+}
+inline ::tfrt_pb::box_scaling* ssd_feature::_internal_mutable_prior_scaling() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.prior_scaling_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tfrt_pb::box_scaling>(GetArenaForAllocation());
+    _impl_.prior_scaling_ = p;
+  }
+  return _impl_.prior_scaling_;
+}
+inline ::tfrt_pb::box_scaling* ssd_feature::mutable_prior_scaling() {
+  ::tfrt_pb::box_scaling* _msg = _internal_mutable_prior_scaling();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.prior_scaling)
+  return _msg;
+}
+inline void ssd_feature::set_allocated_prior_scaling(::tfrt_pb::box_scaling* prior_scaling) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.prior_scaling_;
+  }
+  if (prior_scaling) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prior_scaling);
+    if (message_arena != submessage_arena) {
+      prior_scaling = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prior_scaling, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.prior_scaling_ = prior_scaling;
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.prior_scaling)
+}
+
+// optional .tfrt_pb.ssd_feature.outputs_name outputs = 6;
+inline bool ssd_feature::_internal_has_outputs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.outputs_ != nullptr);
+  return value;
+}
+inline bool ssd_feature::has_outputs() const {
+  return _internal_has_outputs();
+}
+inline void ssd_feature::clear_outputs() {
+  if (_impl_.outputs_ != nullptr) _impl_.outputs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::tfrt_pb::ssd_feature_outputs_name& ssd_feature::_internal_outputs() const {
+  const ::tfrt_pb::ssd_feature_outputs_name* p = _impl_.outputs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tfrt_pb::ssd_feature_outputs_name&>(
+      ::tfrt_pb::_ssd_feature_outputs_name_default_instance_);
+}
+inline const ::tfrt_pb::ssd_feature_outputs_name& ssd_feature::outputs() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_feature.outputs)
+  return _internal_outputs();
+}
+inline void ssd_feature::unsafe_arena_set_allocated_outputs(
+    ::tfrt_pb::ssd_feature_outputs_name* outputs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.outputs_);
+  }
+  _impl_.outputs_ = outputs;
+  if (outputs) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tfrt_pb.ssd_feature.outputs)
+}
+inline ::tfrt_pb::ssd_feature_outputs_name* ssd_feature::release_outputs() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::tfrt_pb::ssd_feature_outputs_name* temp = _impl_.outputs_;
+  _impl_.outputs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tfrt_pb::ssd_feature_outputs_name* ssd_feature::unsafe_arena_release_outputs() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_feature.outputs)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::tfrt_pb::ssd_feature_outputs_name* temp = _impl_.outputs_;
+  _impl_.outputs_ = nullptr;
+  return temp;
+}
+inline ::tfrt_pb::ssd_feature_outputs_name* ssd_feature::_internal_mutable_outputs() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.outputs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tfrt_pb::ssd_feature_outputs_name>(GetArenaForAllocation());
+    _impl_.outputs_ = p;
+  }
+  return _impl_.outputs_;
+}
+inline ::tfrt_pb::ssd_feature_outputs_name* ssd_feature::mutable_outputs() {
+  ::tfrt_pb::ssd_feature_outputs_name* _msg = _internal_mutable_outputs();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_feature.outputs)
+  return _msg;
+}
+inline void ssd_feature::set_allocated_outputs(::tfrt_pb::ssd_feature_outputs_name* outputs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.outputs_;
+  }
+  if (outputs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(outputs);
+    if (message_arena != submessage_arena) {
+      outputs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, outputs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.outputs_ = outputs;
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_feature.outputs)
+}
+
+// -------------------------------------------------------------------
+
+// ssd_network
+
+// optional .tfrt_pb.network network = 1;
+inline bool ssd_network::_internal_has_network() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.network_ != nullptr);
+  return value;
+}
+inline bool ssd_network::has_network() const {
+  return _internal_has_network();
+}
+inline const ::tfrt_pb::network& ssd_network::_internal_network() const {
+  const ::tfrt_pb::network* p = _impl_.network_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tfrt_pb::network&>(
+      ::tfrt_pb::_network_default_instance_);
+}
+inline const ::tfrt_pb::network& ssd_network::network() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_network.network)
+  return _internal_network();
+}
+inline void ssd_network::unsafe_arena_set_allocated_network(
+    ::tfrt_pb::network* network) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.network_);
+  }
+  _impl_.network_ = network;
+  if (network) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tfrt_pb.ssd_network.network)
+}
+inline ::tfrt_pb::network* ssd_network::release_network() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::tfrt_pb::network* temp = _impl_.network_;
+  _impl_.network_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tfrt_pb::network* ssd_network::unsafe_arena_release_network() {
+  // @@protoc_insertion_point(field_release:tfrt_pb.ssd_network.network)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::tfrt_pb::network* temp = _impl_.network_;
+  _impl_.network_ = nullptr;
+  return temp;
+}
+inline ::tfrt_pb::network* ssd_network::_internal_mutable_network() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.network_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tfrt_pb::network>(GetArenaForAllocation());
+    _impl_.network_ = p;
+  }
+  return _impl_.network_;
+}
+inline ::tfrt_pb::network* ssd_network::mutable_network() {
+  ::tfrt_pb::network* _msg = _internal_mutable_network();
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_network.network)
+  return _msg;
+}
+inline void ssd_network::set_allocated_network(::tfrt_pb::network* network) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.network_);
+  }
+  if (network) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(network));
+    if (message_arena != submessage_arena) {
+      network = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, network, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.network_ = network;
+  // @@protoc_insertion_point(field_set_allocated:tfrt_pb.ssd_network.network)
+}
+
+// repeated .tfrt_pb.ssd_feature features = 2;
+inline int ssd_network::_internal_features_size() const {
+  return _impl_.features_.size();
+}
+inline int ssd_network::features_size() const {
+  return _internal_features_size();
+}
+inline void ssd_network::clear_features() {
+  _impl_.features_.Clear();
+}
+inline ::tfrt_pb::ssd_feature* ssd_network::mutable_features(int index) {
+  // @@protoc_insertion_point(field_mutable:tfrt_pb.ssd_network.features)
+  return _impl_.features_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_feature >*
+ssd_network::mutable_features() {
+  // @@protoc_insertion_point(field_mutable_list:tfrt_pb.ssd_network.features)
+  return &_impl_.features_;
+}
+inline const ::tfrt_pb::ssd_feature& ssd_network::_internal_features(int index) const {
+  return _impl_.features_.Get(index);
+}
+inline const ::tfrt_pb::ssd_feature& ssd_network::features(int index) const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_network.features)
+  return _internal_features(index);
+}
+inline ::tfrt_pb::ssd_feature* ssd_network::_internal_add_features() {
+  return _impl_.features_.Add();
+}
+inline ::tfrt_pb::ssd_feature* ssd_network::add_features() {
+  ::tfrt_pb::ssd_feature* _add = _internal_add_features();
+  // @@protoc_insertion_point(field_add:tfrt_pb.ssd_network.features)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tfrt_pb::ssd_feature >&
+ssd_network::features() const {
+  // @@protoc_insertion_point(field_list:tfrt_pb.ssd_network.features)
+  return _impl_.features_;
+}
+
+// optional int32 num_classes_2d = 3 [default = 0];
+inline bool ssd_network::_internal_has_num_classes_2d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ssd_network::has_num_classes_2d() const {
+  return _internal_has_num_classes_2d();
+}
+inline void ssd_network::clear_num_classes_2d() {
+  _impl_.num_classes_2d_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t ssd_network::_internal_num_classes_2d() const {
+  return _impl_.num_classes_2d_;
+}
+inline int32_t ssd_network::num_classes_2d() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_network.num_classes_2d)
+  return _internal_num_classes_2d();
+}
+inline void ssd_network::_internal_set_num_classes_2d(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_classes_2d_ = value;
+}
+inline void ssd_network::set_num_classes_2d(int32_t value) {
+  _internal_set_num_classes_2d(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_network.num_classes_2d)
+}
+
+// optional int32 num_classes_3d = 4 [default = 0];
+inline bool ssd_network::_internal_has_num_classes_3d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ssd_network::has_num_classes_3d() const {
+  return _internal_has_num_classes_3d();
+}
+inline void ssd_network::clear_num_classes_3d() {
+  _impl_.num_classes_3d_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t ssd_network::_internal_num_classes_3d() const {
+  return _impl_.num_classes_3d_;
+}
+inline int32_t ssd_network::num_classes_3d() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_network.num_classes_3d)
+  return _internal_num_classes_3d();
+}
+inline void ssd_network::_internal_set_num_classes_3d(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_classes_3d_ = value;
+}
+inline void ssd_network::set_num_classes_3d(int32_t value) {
+  _internal_set_num_classes_3d(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_network.num_classes_3d)
+}
+
+// optional int32 num_classes_seg = 5 [default = 0];
+inline bool ssd_network::_internal_has_num_classes_seg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ssd_network::has_num_classes_seg() const {
+  return _internal_has_num_classes_seg();
+}
+inline void ssd_network::clear_num_classes_seg() {
+  _impl_.num_classes_seg_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t ssd_network::_internal_num_classes_seg() const {
+  return _impl_.num_classes_seg_;
+}
+inline int32_t ssd_network::num_classes_seg() const {
+  // @@protoc_insertion_point(field_get:tfrt_pb.ssd_network.num_classes_seg)
+  return _internal_num_classes_seg();
+}
+inline void ssd_network::_internal_set_num_classes_seg(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.num_classes_seg_ = value;
+}
+inline void ssd_network::set_num_classes_seg(int32_t value) {
+  _internal_set_num_classes_seg(value);
+  // @@protoc_insertion_point(field_set:tfrt_pb.ssd_network.num_classes_seg)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace tfrt_pb
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ssd_5fnetwork_2eproto
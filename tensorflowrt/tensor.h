@@ -43,6 +43,7 @@
 #include "std_msgs/Float64MultiArray.h"
 
 #include "cuda/cudaMappedMemory.h"
+#include "memory_tracker.h"
 #include "types.h"
 #include "tfrt_jetson.h"
 #include "network.pb.h"
@@ -70,14 +71,16 @@ public:
         name{_name}, shape{_shape},
         size{_shape.n() * _shape.c() * _shape.h() * _shape.w() * sizeof(T)},
         cpu{nullptr}, cuda{nullptr}, binding_index{0}, m_own_memory{false} {}
-    /** Move constructor and assignement. */
-    cuda_tensor_t(cuda_tensor_t<T>&& t)  :
+    /** Move constructor and assignement. noexcept: moved (not copied) when
+     * a std::vector grows, keeping the memory ownership.
+     */
+    cuda_tensor_t(cuda_tensor_t<T>&& t) noexcept :
         name{}, shape{}, size{0}, cpu{nullptr}, cuda{nullptr}, binding_index{0}, 
         m_own_memory{false}
     {
         this->operator=(std::move(t));
     }
-    cuda_tensor_t& operator=(cuda_tensor_t<T>&& t)
+    cuda_tensor_t& operator=(cuda_tensor_t<T>&& t) noexcept
     {
         // Free allocated memory...
         free();
@@ -156,13 +159,16 @@ public:
                 LOG(FATAL) << "Failed to allocate CUDA mapped memory for tensor: " << name;
                 return false;
             }
-        }   
+            m_own_memory = true;
+            memory_tracker::global().allocate(cpu, size, memory_tracker::kTensor, name);
+        }
         return true;
     }
     /** Free allocated memory and reset pointers. */
     void free()
     {
         if(cpu && m_own_memory) {
+            memory_tracker::global().release(cpu);
             CUDA(cudaFreeHost(cpu));
         }
         cpu = nullptr;
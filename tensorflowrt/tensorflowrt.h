@@ -27,11 +27,16 @@
 
 #include "tfrt_jetson.h"
 #include "network.h"
+#include "profiler.h"
+#include "tracer.h"
+#include "metrics.h"
+#include "memory_tracker.h"
 #include "scope.h"
 #include "layers.h"
 #include "ssd_layers.h"
 
 #include "boxes2d/boxes2d.h"
+#include "boxes2d/tracker.h"
 
 #include "imagenet_network.h"
 #include "seg_network.h"
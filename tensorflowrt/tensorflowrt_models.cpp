@@ -14,6 +14,8 @@
 # =========================================================================== */
 // #include <fcntl.h>
 // #include <unistd.h>
+#include <functional>
+#include <map>
 #include <memory>
 
 #include "utils.h"
@@ -21,29 +23,31 @@
 
 namespace tfrt
 {
-/** TODO: fix this messy implementation. */
-std::unique_ptr<tfrt::network>&& nets_factory(const std::string& name)
+std::unique_ptr<tfrt::network> nets_factory(const std::string& name)
 {
-    static std::map<std::string, std::unique_ptr<tfrt::network> > nets;
-    // Fill the map at first call!
-    if (nets.empty()) {
+    typedef std::function<tfrt::network*()> creator;
+    static const std::map<std::string, creator> nets = {
         // ImageNet classification.
-        nets["inception1"] = std::make_unique<inception1::net>();
-        nets["inception2"] = std::make_unique<inception2::net>();
+        {"inception1", [] { return new inception1::net(); }},
+        {"inception2", [] { return new inception2::net(); }},
 
-        nets["resnet_v1_50"] = std::make_unique<resnet_v1_50::net>();
-        nets["resnet_v1_101"] = std::make_unique<resnet_v1_101::net>();
-        nets["resnet_v1_152"] = std::make_unique<resnet_v1_152::net>();
+        {"resnet_v1_50", [] { return new resnet_v1_50::net(); }},
+        {"resnet_v1_101", [] { return new resnet_v1_101::net(); }},
+        {"resnet_v1_152", [] { return new resnet_v1_152::net(); }},
 
-        nets["resnext_50"] = std::make_unique<resnext_50::net>();
+        {"resnext_50", [] { return new resnext_50::net(); }},
 
         // Segmentation networks.
-        nets["ssd_inception2_v0"] = std::make_unique<ssd_inception2_v0::net>();
-        nets["seg_inception2_v1"] = std::make_unique<seg_inception2_v1::net>();
-        nets["seg_inception2_v1_5x5"] = std::make_unique<seg_inception2_v1_5x5::net>();
-        nets["seg_inception2_logits_v1"] = std::make_unique<seg_inception2_logits_v1::net>();
-        nets["seg_inception2_2x2"] = std::make_unique<seg_inception2_2x2::net>();
+        {"ssd_inception2_v0", [] { return new ssd_inception2_v0::net(); }},
+        {"seg_inception2_v1", [] { return new seg_inception2_v1::net(); }},
+        {"seg_inception2_v1_5x5", [] { return new seg_inception2_v1_5x5::net(); }},
+        {"seg_inception2_logits_v1", [] { return new seg_inception2_logits_v1::net(); }},
+        {"seg_inception2_2x2", [] { return new seg_inception2_2x2::net(); }},
+    };
+    auto it = nets.find(name);
+    if (it == nets.end()) {
+        return nullptr;
     }
-    return std::move(nets.at(name));
+    return std::unique_ptr<tfrt::network>(it->second());
 }
 }
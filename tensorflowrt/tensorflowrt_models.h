@@ -42,8 +42,10 @@
 
 namespace tfrt
 {
-/** Neural Nets factory. */
-std::unique_ptr<tfrt::network>&& nets_factory(const std::string& name);
+/** Neural Nets factory: new instance of a network, by name.
+ * Null pointer if the name is unknown.
+ */
+std::unique_ptr<tfrt::network> nets_factory(const std::string& name);
 
 }
 
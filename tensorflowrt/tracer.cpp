@@ -0,0 +1,153 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "tracer.h"
+
+namespace tfrt
+{
+namespace trace
+{
+namespace detail
+{
+std::atomic<bool>  g_enabled{false};
+}
+
+namespace
+{
+/** Ring of spans of a thread. Single producer: the owner thread. */
+struct ring
+{
+    int  tid;
+    std::atomic<uint64_t>  head;
+    std::vector<span>  spans;
+
+    ring(int _tid) : tid{_tid}, head{0}, spans(kRingSize) {}
+};
+/** Registry of all rings. Rings outlive their thread, for dumping. */
+struct registry
+{
+    std::mutex  mutex;
+    std::vector<std::shared_ptr<ring> >  rings;
+};
+registry& get_registry()
+{
+    static registry reg;
+    return reg;
+}
+/** Thread local ring, registered at first use. */
+ring& thread_ring()
+{
+    thread_local ring* t_ring = nullptr;
+    if(!t_ring) {
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.rings.push_back(std::make_shared<ring>(int(reg.rings.size()) + 1));
+        t_ring = reg.rings.back().get();
+    }
+    return *t_ring;
+}
+thread_local int64_t  t_frame = -1;
+}
+
+void enable(bool v)
+{
+    detail::g_enabled.store(v, std::memory_order_relaxed);
+}
+void frame(int64_t id)
+{
+    t_frame = id;
+}
+int64_t frame()
+{
+    return t_frame;
+}
+
+void record(const char* name, const char* category, uint64_t begin_ns, uint64_t end_ns,
+    int64_t frame)
+{
+    ring& r = thread_ring();
+    const uint64_t h = r.head.load(std::memory_order_relaxed);
+    span& s = r.spans[h % kRingSize];
+    s.name = name;
+    s.category = category;
+    s.begin_ns = begin_ns;
+    s.end_ns = end_ns;
+    s.frame = frame;
+    r.head.store(h + 1, std::memory_order_release);
+}
+
+void to_chrome_json(std::ostream& out)
+{
+    registry& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    // Timestamps relative to the first span.
+    uint64_t t0 = UINT64_MAX;
+    for(auto&& r : reg.rings) {
+        const uint64_t head = r->head.load(std::memory_order_acquire);
+        const uint64_t first = head > kRingSize ? head - kRingSize : 0;
+        for(uint64_t i = first ; i < head ; ++i) {
+            t0 = std::min(t0, r->spans[i % kRingSize].begin_ns);
+        }
+    }
+    char buf[512];
+    bool first_event = true;
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    for(auto&& r : reg.rings) {
+        const uint64_t head = r->head.load(std::memory_order_acquire);
+        const uint64_t first = head > kRingSize ? head - kRingSize : 0;
+        for(uint64_t i = first ; i < head ; ++i) {
+            const span& s = r->spans[i % kRingSize];
+            snprintf(buf, sizeof(buf),
+                "{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, "
+                "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"frame\": %lld}}",
+                s.name, s.category, r->tid,
+                (s.begin_ns - t0) * 1e-3, (s.end_ns - s.begin_ns) * 1e-3, (long long)s.frame);
+            out << (first_event ? "\n" : ",\n") << buf;
+            first_event = false;
+        }
+    }
+    out << "\n]}\n";
+}
+bool save_chrome_json(const std::string& filename)
+{
+    std::ofstream file(filename);
+    if(!file) {
+        LOG(ERROR) << "Could not open trace file: " << filename;
+        return false;
+    }
+    to_chrome_json(file);
+    LOG(INFO) << "Pipeline trace saved in: " << filename;
+    return bool(file);
+}
+void clear()
+{
+    registry& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for(auto&& r : reg.rings) {
+        r->head.store(0, std::memory_order_release);
+    }
+}
+
+}
+}
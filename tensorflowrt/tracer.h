@@ -0,0 +1,132 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_TRACER_H
+#define TFRT_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace tfrt
+{
+namespace trace
+{
+/* ============================================================================
+ * Pipeline latency tracer.
+ * ========================================================================== */
+/** Low-overhead tracing of the pipeline stages: every thread records spans
+ * (name, begin, end, frame id) in its own ring buffer, with a monotonic clock.
+ * No lock on the recording path; oldest spans are overwritten when a ring is
+ * full. Spans are dumped in the Chrome trace format (chrome://tracing).
+ *
+ * Names and categories are NOT copied: they must be static strings.
+ * Note: spans around asynchronous CUDA calls only measure the CPU side.
+ */
+struct span
+{
+    const char*  name;
+    const char*  category;
+    uint64_t  begin_ns;
+    uint64_t  end_ns;
+    int64_t  frame;
+};
+
+/** Number of spans kept per thread. */
+static const size_t kRingSize = 1 << 14;
+
+/** Enable / disable tracing (disabled by default). */
+void enable(bool v);
+inline bool enabled();
+/** Current frame id of the calling thread (-1: none). */
+void frame(int64_t id);
+int64_t frame();
+
+/** Monotonic clock, in nanoseconds. */
+inline uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+/** Record a span in the calling thread ring. */
+void record(const char* name, const char* category, uint64_t begin_ns, uint64_t end_ns,
+    int64_t frame);
+
+/** Dump all threads spans in Chrome trace JSON format. Spans recorded during
+ * the dump may be missing or torn: dump preferably when the pipeline is idle.
+ */
+void to_chrome_json(std::ostream& out);
+bool save_chrome_json(const std::string& filename);
+/** Clear all rings. */
+void clear();
+
+/** Scoped span: recorded at destruction, with the frame id of the thread at
+ * construction (or an explicit one).
+ */
+class scope
+{
+public:
+    scope(const char* name, const char* category="tfrt") :
+        m_name{name}, m_category{category}, m_frame{0}, m_begin_ns{0}
+    {
+        if(enabled()) {
+            m_frame = trace::frame();
+            m_begin_ns = now_ns();
+        }
+    }
+    scope(const char* name, const char* category, int64_t frame_id) :
+        m_name{name}, m_category{category}, m_frame{frame_id}, m_begin_ns{0}
+    {
+        if(enabled()) {
+            m_begin_ns = now_ns();
+        }
+    }
+    ~scope()
+    {
+        if(m_begin_ns) {
+            record(m_name, m_category, m_begin_ns, now_ns(), m_frame);
+        }
+    }
+
+private:
+    scope(const scope&) = delete;
+    scope& operator=(const scope&) = delete;
+
+private:
+    const char*  m_name;
+    const char*  m_category;
+    int64_t  m_frame;
+    uint64_t  m_begin_ns;
+};
+
+// Inline implementation: single relaxed load.
+namespace detail
+{
+extern std::atomic<bool>  g_enabled;
+}
+inline bool enabled() {
+    return detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+}
+}
+
+#define TFRT_TRACE_CONCAT_IMPL(a, b) a##b
+#define TFRT_TRACE_CONCAT(a, b) TFRT_TRACE_CONCAT_IMPL(a, b)
+/** Trace the enclosing scope. Arguments: name [, category [, frame id]]. */
+#define TFRT_TRACE_SCOPE(...) \
+    tfrt::trace::scope TFRT_TRACE_CONCAT(_tfrt_trace_scope_, __LINE__){__VA_ARGS__}
+
+#endif
@@ -15,6 +15,7 @@
 #ifndef TFRT_UTILS_H
 #define TFRT_UTILS_H
 
+#include <atomic>
 #include <glog/logging.h>
 
 #include <VX/vx.h>
@@ -31,6 +32,28 @@
 
 namespace tfrt
 {
+/* ============================================================================
+ * Layers logging.
+ * ========================================================================== */
+/** Per-layer construction logs (enabled by default). Disabled, log messages
+ * are not even formatted: measurable on ARM cold starts.
+ */
+inline std::atomic<bool>& layers_logging_flag()
+{
+    static std::atomic<bool> flag{true};
+    return flag;
+}
+inline void layers_logging(bool v)
+{
+    layers_logging_flag().store(v, std::memory_order_relaxed);
+}
+inline bool layers_logging()
+{
+    return layers_logging_flag().load(std::memory_order_relaxed);
+}
+/** Layer construction log, silenced by tfrt::layers_logging(false). */
+#define TFRT_LAYER_LOG LOG_IF(INFO, tfrt::layers_logging())
+
 /* ============================================================================
  * Dim utils.
  * ========================================================================== */
@@ -17,12 +17,15 @@
 
 #include <map>
 #include <string>
+#include <chrono>
 #include <iomanip>
+#include <iostream>
 
 // TensorFlowRT headers
 #include <tensorflowrt.h>
 #include <tensorflowrt_util.h>
 #include <tensorflowrt_nets.h>
+#include <cpu/cpuImageLoader.h>
 
 #define IMGNET "<imagenet-console> "
 // FLAGS...
@@ -34,6 +37,8 @@ DEFINE_string(imagenet_info, "../data/networks/ilsvrc12_synset_words.txt",
 DEFINE_string(image, "../data/images/orange_0.jpg",
     "Image to classify.");
 DEFINE_bool(image_save, false, "Save the result in some new image.");
+DEFINE_string(images, "", "Directory of images to classify (batch job, replaces --image).");
+DEFINE_int32(decode_threads, 0, "Number of image decoding threads (0: all cores).");
 
 
 /** Map-method containing the list of available ImageNet networks.
@@ -50,6 +55,42 @@ std::unique_ptr<tfrt::imagenet_network>&& networks_map(const std::string& key)
 }
 
 
+/** Classify all the images of a directory. Images are decoded by a threads
+ * pool ahead of the network, in re-used buffers.
+ */
+void classify_directory(tfrt::imagenet_network* network, const std::string& dirname)
+{
+    std::vector<std::string> filenames;
+    CHECK(cpu_list_images(dirname, filenames)) << IMGNET << "Invalid directory: " << dirname;
+    cpu_image_loader loader(filenames, FLAGS_decode_threads);
+    cpu_image image;
+    tfrt::cuda_tensor img("image", {1, 4, 0, 0});
+    size_t img_capacity = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    while(loader.next(image)) {
+        if(!image.valid()) {
+            LOG(WARNING) << IMGNET << "Failed to read image file: " << image.filename;
+            continue;
+        }
+        const nvinfer1::DimsNCHW shape{1, 4, int(image.height), int(image.width)};
+        if(size_t(image.width) * image.height > img_capacity) {
+            img.reshape(shape);
+            CHECK(img.allocate()) << IMGNET << "Failed to allocate image: " << image.filename;
+            img_capacity = size_t(image.width) * image.height;
+        }
+        img.shape = shape;
+        cpu_image_to_rgba_float(image, img.cpu);
+        auto imgclass = network->classify(img.cuda, img.shape.h(), img.shape.w());
+        std::cout << image.filename << ": "
+            << (imgclass.first >= 0 ? network->description(imgclass.first) : "none")
+            << " (" << std::setprecision(4) << imgclass.second << ")" << std::endl;
+    }
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - t0).count();
+    LOG(INFO) << IMGNET << "Classified " << loader.size() << " images in " << seconds
+        << " s (" << loader.num_threads() << " decoding threads).";
+}
+
 int main(int argc, char** argv)
 {
     google::InitGoogleLogging(argv[0]);
@@ -62,6 +103,10 @@ int main(int argc, char** argv)
     // network->EnableProfiler();
     network->load(FLAGS_network_pb);
     network->load_info(FLAGS_imagenet_info);
+    if(!FLAGS_images.empty()) {
+        classify_directory(network.get(), FLAGS_images);
+        return 0;
+    }
 
     // Load image from file on disk.
     LOG(INFO) << IMGNET << "Opening image: " << FLAGS_image;
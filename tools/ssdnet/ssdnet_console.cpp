@@ -35,6 +35,7 @@ DEFINE_string(image, "../data/images/peds-001.jpg",
 DEFINE_bool(image_save, false, "Save the result in some new image.");
 DEFINE_int32(max_detections, 200, "Maximum number of raw detections.");
 DEFINE_double(threshold, 0.5, "Detection threshold.");
+DEFINE_bool(letterbox, false, "Aspect-preserving (letterbox) resize of the input image.");
 
 // uint64_t current_timestamp() {
 //     struct timeval te;
@@ -74,6 +75,7 @@ int main( int argc, char** argv )
     auto network = networks_map(FLAGS_network);
     // network->EnableProfiler();
     network->load(FLAGS_network_pb);
+    network->letterbox_resize(FLAGS_letterbox);
 
     // Load image from file on disk.
     LOG(INFO) << SSDNET << "Opening image: " << FLAGS_image;
@@ -0,0 +1,333 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boxes2d/boxes2d.h>
+#include <boxes2d/ssd.h>
+#include <cpu/cpuCHWImage.h>
+#include <cpu/cpuHalfPrecision.h>
+#include <cpu/cpuSegmentation.h>
+#include <cpu/cpuYUV.h>
+#include <misc/pb_tensors.h>
+#include <stabilization/vstab_math.hpp>
+
+/* ============================================================================
+ * Host hot paths micro-benchmarks, with synthetic inputs shaped as the
+ * bundled models outputs. No CUDA / TensorRT required.
+ * ========================================================================== */
+namespace
+{
+/** SSD inception2 feature layers at 300x300: height, width, anchors. */
+const int kSSDFeatures[6][3] = {
+    {19, 19, 3}, {10, 10, 6}, {5, 5, 6}, {3, 3, 6}, {2, 2, 6}, {1, 1, 6}};
+const int kSSDNumClasses = 91;
+/** Segmentation inception2 output: 225x385, 18 classes, batch 2. */
+const int kSegHeight = 225;
+const int kSegWidth = 385;
+const int kSegNumClasses = 18;
+const int kSegBatchSize = 2;
+
+/** Random softmax-like predictions: background dominant, ~1% of objects. */
+std::vector<float> random_predictions(size_t num_anchors, size_t num_classes, size_t hw,
+    std::mt19937& gen)
+{
+    std::uniform_real_distribution<float> unif(0.0f, 1.0f);
+    std::vector<float> pred(num_anchors * num_classes * hw);
+    for (size_t k = 0; k < num_anchors; ++k) {
+        for (size_t p = 0; p < hw; ++p) {
+            const bool object = unif(gen) < 0.01f;
+            const size_t cls = object ? 1 + gen() % (num_classes - 1) : 0;
+            for (size_t l = 0; l < num_classes; ++l) {
+                const float v = (l == cls) ? 0.6f + 0.4f * unif(gen) : 0.4f * unif(gen) / num_classes;
+                pred[(k * num_classes + l) * hw + p] = v;
+            }
+        }
+    }
+    return pred;
+}
+/** Random homography close to identity (camera shake). */
+Matrix3x3f_rm random_homography(std::mt19937& gen)
+{
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    const float angle = 0.01f * noise(gen);
+    Matrix3x3f_rm m;
+    m << std::cos(angle), -std::sin(angle), 5.0f * noise(gen),
+         std::sin(angle), std::cos(angle), 5.0f * noise(gen),
+         1e-6f * noise(gen), 1e-6f * noise(gen), 1.0f;
+    return m;
+}
+}
+
+/* ============================================================================
+ * SSD post-processing: ssd_network::fill_bboxes_2d + sort_by_score.
+ * ========================================================================== */
+static void BM_ssd_select_raw(benchmark::State& state)
+{
+    std::mt19937 gen(42);
+    std::vector<std::vector<float> > preds, boxes;
+    for (auto&& f : kSSDFeatures) {
+        const size_t hw = f[0] * f[1];
+        preds.push_back(random_predictions(f[2], kSSDNumClasses, hw, gen));
+        boxes.push_back(std::vector<float>(f[2] * 4 * hw, 0.1f));
+    }
+    const size_t max_detections = state.range(0);
+    tfrt::boxes2d::bboxes2d bboxes{max_detections};
+    for (auto _ : state) {
+        size_t idx = 0;
+        for (size_t i = 0; i < preds.size(); ++i) {
+            const int* f = kSSDFeatures[i];
+            tfrt::boxes2d::ssd_select_raw(preds[i].data(), boxes[i].data(),
+                f[2], kSSDNumClasses, f[0], f[1], 0.5f, max_detections, idx, bboxes);
+        }
+        benchmark::DoNotOptimize(idx);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ssd_select_raw)->Arg(200)->Unit(benchmark::kMicrosecond);
+
+static void BM_bboxes2d_sort_by_score(benchmark::State& state)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> unif(0.0f, 1.0f);
+    const size_t size = state.range(0);
+    // Half of the boxes detected (non-zero scores), rest empty.
+    tfrt::boxes2d::bboxes2d ref{size};
+    for (size_t i = 0; i < size / 2; ++i) {
+        ref.classes(i) = 1 + gen() % (kSSDNumClasses - 1);
+        ref.scores(i) = 0.5f + 0.5f * unif(gen);
+        ref.boxes.row(i) << unif(gen), unif(gen), unif(gen), unif(gen);
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        tfrt::boxes2d::bboxes2d bboxes = ref;
+        state.ResumeTiming();
+        bboxes.sort_by_score(true);
+        benchmark::DoNotOptimize(bboxes.scores.data());
+    }
+}
+BENCHMARK(BM_bboxes2d_sort_by_score)->Arg(200)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+/* ============================================================================
+ * Segmentation post-processing: seg_network::post_processing.
+ * ========================================================================== */
+static void BM_seg_argmax(benchmark::State& state)
+{
+    std::mt19937 gen(42);
+    const size_t hw = kSegHeight * kSegWidth;
+    std::vector<float> raw_prob;
+    for (int n = 0; n < kSegBatchSize; ++n) {
+        auto p = random_predictions(1, kSegNumClasses, hw, gen);
+        raw_prob.insert(raw_prob.end(), p.begin(), p.end());
+    }
+    std::vector<uint8_t> classes(kSegBatchSize * hw);
+    std::vector<float> scores(kSegBatchSize * hw);
+    for (auto _ : state) {
+        cpu_seg_argmax(raw_prob.data(), classes.data(), scores.data(),
+            kSegBatchSize, kSegWidth, kSegHeight, kSegNumClasses, false, 0.5f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kSegBatchSize * hw);
+}
+BENCHMARK(BM_seg_argmax)->Unit(benchmark::kMicrosecond);
+
+/* ============================================================================
+ * Input preprocessing: 1280x720 RGBX frame => normalized 3x300x300 input.
+ * ========================================================================== */
+static void BM_rgba_to_chw_normalize(benchmark::State& state)
+{
+    const int inwidth = 1280;
+    const int inheight = 720;
+    const int outsize = 300;
+    const bool half_output = state.range(0);
+    const tfrt::resize_mode mode = tfrt::resize_mode(state.range(1));
+    std::mt19937 gen(42);
+    std::vector<uint8_t> frame(inwidth * inheight * 4);
+    for (auto& v : frame) {
+        v = gen() & 0xff;
+    }
+    const float scale[3] = {2.0f / 255.0f, 2.0f / 255.0f, 2.0f / 255.0f};
+    const float shift[3] = {-1.0f, -1.0f, -1.0f};
+    std::vector<float> output(3 * outsize * outsize);
+    for (auto _ : state) {
+        cpu_rgba_to_chw_normalize(frame.data(), output.data(), inwidth, inheight,
+            4, inwidth * 4, outsize, outsize, mode, scale, shift, half_output);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * outsize * outsize);
+}
+// Arguments: half output, resize mode (nearest, bilinear, area).
+BENCHMARK(BM_rgba_to_chw_normalize)->Args({0, 0})->Args({1, 0})->Args({0, 1})->Args({0, 2})
+    ->Unit(benchmark::kMicrosecond);
+
+/* ============================================================================
+ * Camera frames: 640x480 YUYV => RGBA, and => normalized 3x300x300 input.
+ * ========================================================================== */
+static void BM_yuyv_to_rgba(benchmark::State& state)
+{
+    const int width = 640;
+    const int height = 480;
+    std::mt19937 gen(42);
+    std::vector<uint8_t> frame(width * height * 2);
+    for (auto& v : frame) {
+        v = gen() & 0xff;
+    }
+    std::vector<uint8_t> rgba(width * height * 4);
+    for (auto _ : state) {
+        cpu_yuyv_to_rgba(frame.data(), width * 2, rgba.data(), width * 4, width, height);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_yuyv_to_rgba)->Unit(benchmark::kMicrosecond);
+
+static void BM_yuyv_to_chw_normalize(benchmark::State& state)
+{
+    const int width = 640;
+    const int height = 480;
+    const int outsize = 300;
+    std::mt19937 gen(42);
+    std::vector<uint8_t> frame(width * height * 2);
+    for (auto& v : frame) {
+        v = gen() & 0xff;
+    }
+    const float scale[3] = {2.0f / 255.0f, 2.0f / 255.0f, 2.0f / 255.0f};
+    const float shift[3] = {-1.0f, -1.0f, -1.0f};
+    std::vector<float> output(3 * outsize * outsize);
+    for (auto _ : state) {
+        cpu_yuv_to_chw_normalize(tfrt::yuv_format::yuyv, frame.data(), width * 2,
+            width, height, output.data(), outsize, outsize, scale, shift, false);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * outsize * outsize);
+}
+BENCHMARK(BM_yuyv_to_chw_normalize)->Unit(benchmark::kMicrosecond);
+
+/** fp16 to float conversion, on a segmentation output sized array. */
+static void BM_half2float_array(benchmark::State& state)
+{
+    const size_t size = size_t(kSegBatchSize) * kSegNumClasses * kSegHeight * kSegWidth;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> values(size);
+    for (auto& v : values) {
+        v = dist(gen);
+    }
+    std::vector<uint16_t> input(size);
+    cpu_float2half_array(values.data(), input.data(), size);
+    for (auto _ : state) {
+        cpu_half2float_array(input.data(), values.data(), size);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * size * sizeof(uint16_t));
+}
+BENCHMARK(BM_half2float_array)->Unit(benchmark::kMicrosecond);
+
+/** NV12 720p frame => 3x300x300 input: direct (arg 0) or through a RGBA
+ * intermediate image (arg 1). Bytes: frame + intermediate traffic.
+ */
+static void BM_nv12_to_chw_normalize(benchmark::State& state)
+{
+    const int width = 1280;
+    const int height = 720;
+    const int outsize = 300;
+    const bool two_steps = state.range(0);
+    std::mt19937 gen(42);
+    std::vector<uint8_t> frame(width * height * 3 / 2);
+    for (auto& v : frame) {
+        v = gen() & 0xff;
+    }
+    const float scale[3] = {2.0f / 255.0f, 2.0f / 255.0f, 2.0f / 255.0f};
+    const float shift[3] = {-1.0f, -1.0f, -1.0f};
+    std::vector<uint8_t> rgba(width * height * 4);
+    std::vector<float> output(3 * outsize * outsize);
+    for (auto _ : state) {
+        if(two_steps) {
+            cpu_nv12_to_rgba(frame.data(), width, rgba.data(), width * 4, width, height);
+            cpu_rgba_to_chw_normalize(rgba.data(), output.data(), width, height, 4, width * 4,
+                outsize, outsize, tfrt::resize_mode::nearest, scale, shift, false);
+        }
+        else {
+            cpu_yuv_to_chw_normalize(tfrt::yuv_format::nv12, frame.data(), width,
+                width, height, output.data(), outsize, outsize, scale, shift, false);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() *
+        (frame.size() + (two_steps ? 2 * rgba.size() : 0)));
+}
+BENCHMARK(BM_nv12_to_chw_normalize)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+/* ============================================================================
+ * Stabilization: matrix smoother and homography filter nodes.
+ * ========================================================================== */
+static void BM_compensating_transformation(benchmark::State& state)
+{
+    std::mt19937 gen(42);
+    const int smoothing_window = state.range(0);
+    std::vector<Matrix3x3f_rm> mats;
+    for (int i = 0; i < 2 * smoothing_window + 1; ++i) {
+        mats.push_back(random_homography(gen));
+    }
+    for (auto _ : state) {
+        Matrix3x3f_rm m = getCompensatingTransformation(mats, smoothing_window, smoothing_window);
+        benchmark::DoNotOptimize(m.data());
+    }
+}
+BENCHMARK(BM_compensating_transformation)->Arg(5)->Arg(15);
+
+static void BM_homography_valid(benchmark::State& state)
+{
+    std::mt19937 gen(42);
+    const Matrix3x3f_rm m = random_homography(gen);
+    for (auto _ : state) {
+        bool valid = isHomographyValid(m, 1280, 720, 2000, 1500);
+        benchmark::DoNotOptimize(valid);
+    }
+}
+BENCHMARK(BM_homography_valid);
+
+/* ============================================================================
+ * Weights lookup: network::tensor_by_name, called for every layer.
+ * ========================================================================== */
+static void BM_find_tensor(benchmark::State& state)
+{
+    // Inception-like scoped names: weights + batch norm parameters per conv.
+    const int num_convs = state.range(0);
+    const char* params[] = {"weights", "BatchNorm/beta", "BatchNorm/moving_mean", "BatchNorm/moving_variance"};
+    tfrt_pb::network pb_network;
+    std::vector<std::string> names;
+    for (int i = 0; i < num_convs; ++i) {
+        for (auto p : params) {
+            names.push_back("inception2/Mixed_" + std::to_string(i / 8) + "/Branch_" +
+                std::to_string(i % 8) + "/Conv2d_0a_3x3/" + p);
+            pb_network.add_weights()->set_name(names.back());
+        }
+    }
+    // Lookup of all tensors, as when building the network.
+    for (auto _ : state) {
+        for (auto&& name : names) {
+            benchmark::DoNotOptimize(tfrt::find_tensor(pb_network, name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_find_tensor)->Arg(70)->Arg(150)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
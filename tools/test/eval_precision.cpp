@@ -0,0 +1,372 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <cpu/cpuEval.h>
+#include <cpu/cpuImageLoader.h>
+#include <misc/histogram.h>
+
+#ifndef TFRT_CPU_ONLY
+#include <cuda_runtime_api.h>
+
+#include <tensorflowrt.h>
+#include <tensorflowrt_util.h>
+#include <tensorflowrt_models.h>
+#include <cpu/cpuSegmentation.h>
+#endif
+
+// FLAGS...
+DEFINE_string(network, "inception2", "Network to evaluate (nets_factory name).");
+DEFINE_string(network_pb32, "", "FP32 network protobuf file (.tfrt32).");
+DEFINE_string(network_pb16, "", "FP16 network protobuf file (.tfrt16).");
+DEFINE_string(images, "../data/images", "Directory of evaluation images.");
+DEFINE_int32(max_images, 0, "Maximum number of images (0: all).");
+DEFINE_int32(warmup, 2, "Warmup runs per image, excluded from timings.");
+DEFINE_int32(iterations, 5, "Timed runs per image.");
+DEFINE_double(threshold, 0.5, "SSD detection threshold.");
+DEFINE_int32(max_detections, 200, "SSD maximum number of detections.");
+DEFINE_string(dump_dir, "", "Save the outputs of every image in dump_dir/{fp32,fp16}.");
+DEFINE_string(compare_dir, "",
+    "Host only: compare the outputs saved in compare_dir/{fp32,fp16}, no GPU needed.");
+DEFINE_string(results_json, "", "Export evaluation results in JSON file.");
+DEFINE_bool(half_bindings, false, "fp16 input and outputs bindings of the fp16 network.");
+
+namespace
+{
+const char* kPrecisions[2] = {"fp32", "fp16"};
+
+/** Sorted files of a directory with one of the extensions (lower case). */
+std::vector<std::string> list_files(const std::string& dirname,
+    const std::vector<std::string>& extensions)
+{
+    std::vector<std::string> files;
+    DIR* dir = opendir(dirname.c_str());
+    CHECK(dir) << "Could not open directory: " << dirname;
+    while(struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        std::string lname = name;
+        std::transform(lname.begin(), lname.end(), lname.begin(), ::tolower);
+        for(auto&& ext : extensions) {
+            if(lname.size() > ext.size() &&
+                    lname.compare(lname.size() - ext.size(), ext.size(), ext) == 0) {
+                files.push_back(name);
+                break;
+            }
+        }
+    }
+    closedir(dir);
+    std::sort(files.begin(), files.end());
+    if(FLAGS_max_images > 0 && files.size() > size_t(FLAGS_max_images)) {
+        files.resize(FLAGS_max_images);
+    }
+    return files;
+}
+
+/** Evaluation results: latencies per precision and divergence per output. */
+struct eval_results
+{
+    size_t  num_images{0};
+    tfrt::histogram  latency[2];
+    std::vector<cpu_eval_stats>  stats;
+};
+const char* kind_name(uint32_t kind)
+{
+    static const char* names[] = {"raw", "scores", "boxes", "mask"};
+    return kind < 4 ? names[kind] : "unknown";
+}
+
+void print_results(std::ostream& out, const eval_results& res)
+{
+    char buf[512];
+    out << "Evaluation of network " << FLAGS_network << " on "
+        << res.num_images << " images (fp16 vs fp32 reference)." << std::endl;
+    snprintf(buf, sizeof(buf), "%-8s %10s %10s %10s %10s\n", "latency", "mean", "p50", "p99", "max");
+    out << buf;
+    for(int p = 0 ; p < 2 ; ++p) {
+        const tfrt::histogram& h = res.latency[p];
+        snprintf(buf, sizeof(buf), "%-8s %10.3f %10.3f %10.3f %10.3f\n", kPrecisions[p],
+            h.mean() * 1e-6, h.percentile(50.0) * 1e-6, h.percentile(99.0) * 1e-6, h.max() * 1e-6);
+        out << buf;
+    }
+    if(res.latency[1].mean() > 0.0) {
+        out << "Speedup fp16: " << res.latency[0].mean() / res.latency[1].mean() << "x" << std::endl;
+    }
+    snprintf(buf, sizeof(buf), "%-40s %-7s %12s %12s %8s %8s %8s\n",
+        "output", "kind", "max_abs_err", "mean_abs_err", "top1", "box_iou", "miou");
+    out << buf;
+    // Metrics not applicable to the kind of output are not printed.
+    auto metric = [](bool valid, double v, const char* fmt) {
+        char s[32];
+        snprintf(s, sizeof(s), valid ? fmt : "-", v);
+        return std::string(s);
+    };
+    for(auto&& s : res.stats) {
+        const bool boxes = (s.kind == cpu_eval_tensor::kBoxes);
+        snprintf(buf, sizeof(buf), "%-40.40s %-7s %12s %12s %8s %8s %8s\n",
+            s.name.c_str(), kind_name(s.kind),
+            metric(!boxes, s.max_abs_error, "%.4g").c_str(),
+            metric(!boxes, s.mean_abs_error(), "%.4g").c_str(),
+            metric(s.kind == cpu_eval_tensor::kScores, s.top1_agreement(), "%.4f").c_str(),
+            metric(boxes, s.mean_box_iou(), "%.4f").c_str(),
+            metric(s.kind == cpu_eval_tensor::kMask, s.mean_miou(), "%.4f").c_str());
+        out << buf;
+    }
+}
+bool save_results_json(const std::string& filename, const eval_results& res)
+{
+    std::ofstream out(filename);
+    if(!out) {
+        LOG(ERROR) << "Could not open results JSON file: " << filename;
+        return false;
+    }
+    char buf[512];
+    out << "{\n  \"network\": \"" << FLAGS_network << "\",\n"
+        << "  \"num_images\": " << res.num_images << ",\n  \"latency\": [";
+    for(int p = 0 ; p < 2 ; ++p) {
+        const tfrt::histogram& h = res.latency[p];
+        snprintf(buf, sizeof(buf),
+            "{\"precision\": \"%s\", \"count\": %llu, \"mean\": %.6f, \"p50\": %.6f, "
+            "\"p99\": %.6f, \"max\": %.6f}", kPrecisions[p], (unsigned long long)h.count(),
+            h.mean() * 1e-6, h.percentile(50.0) * 1e-6, h.percentile(99.0) * 1e-6, h.max() * 1e-6);
+        out << (p ? ",\n    " : "\n    ") << buf;
+    }
+    out << "\n  ],\n  \"outputs\": [";
+    for(size_t i = 0 ; i < res.stats.size() ; ++i) {
+        const cpu_eval_stats& s = res.stats[i];
+        out << (i ? ",\n    " : "\n    ") << "{\"name\": \"" << s.name
+            << "\", \"kind\": \"" << kind_name(s.kind) << "\"";
+        if(s.kind == cpu_eval_tensor::kBoxes) {
+            snprintf(buf, sizeof(buf), ", \"box_iou\": %.6f", s.mean_box_iou());
+        }
+        else {
+            snprintf(buf, sizeof(buf), ", \"max_abs_error\": %.9g, \"mean_abs_error\": %.9g",
+                s.max_abs_error, s.mean_abs_error());
+        }
+        out << buf;
+        if(s.kind == cpu_eval_tensor::kScores) {
+            snprintf(buf, sizeof(buf), ", \"top1_agreement\": %.6f", s.top1_agreement());
+            out << buf;
+        }
+        else if(s.kind == cpu_eval_tensor::kMask) {
+            snprintf(buf, sizeof(buf), ", \"miou\": %.6f", s.mean_miou());
+            out << buf;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+    return bool(out);
+}
+
+/** Host only comparison of saved outputs: CPU reference path, no GPU needed. */
+void compare_saved(const std::string& dirname, eval_results& res)
+{
+    const auto files = list_files(dirname + "/fp32", {".eval"});
+    CHECK(!files.empty()) << "No saved outputs in: " << dirname << "/fp32";
+    std::vector<cpu_eval_tensor> outputs[2];
+    for(auto&& f : files) {
+        for(int p = 0 ; p < 2 ; ++p) {
+            const std::string filename = dirname + "/" + kPrecisions[p] + "/" + f;
+            uint64_t latency_ns = 0;
+            CHECK(cpu_eval_load(filename, outputs[p], &latency_ns))
+                << "Could not load saved outputs: " << filename;
+            res.latency[p].record(latency_ns);
+        }
+        CHECK(cpu_eval_compare(outputs[0], outputs[1], 256, res.stats))
+            << "Could not compare outputs of: " << f;
+        res.num_images++;
+    }
+}
+
+#ifndef TFRT_CPU_ONLY
+std::string basename_noext(const std::string& filename)
+{
+    return filename.substr(0, filename.rfind('.'));
+}
+
+/** Timed runs of a network on an image, and host copy of its outputs. */
+uint64_t run_network(tfrt::network* net, tfrt::cuda_tensor& img,
+    std::vector<cpu_eval_tensor>& outputs)
+{
+    auto imagenet = dynamic_cast<tfrt::imagenet_network*>(net);
+    auto ssd = dynamic_cast<tfrt::ssd_network*>(net);
+    auto seg = dynamic_cast<tfrt::seg_network*>(net);
+    tfrt::boxes2d::bboxes2d bboxes2d;
+    uint64_t sum_ns = 0;
+    for(int i = 0 ; i < FLAGS_warmup + FLAGS_iterations ; ++i) {
+        const uint64_t start = tfrt::trace::now_ns();
+        if(imagenet) {
+            imagenet->classify(img.cuda, img.shape.h(), img.shape.w());
+        }
+        else if(ssd) {
+            bboxes2d = ssd->raw_detect2d(img.cuda, img.shape.h(), img.shape.w(),
+                FLAGS_threshold, FLAGS_max_detections);
+        }
+        else {
+            net->inference(img.cuda, img.shape.h(), img.shape.w());
+        }
+        CUDA(cudaDeviceSynchronize());
+        if(i >= FLAGS_warmup) {
+            sum_ns += tfrt::trace::now_ns() - start;
+        }
+    }
+    outputs.clear();
+    for(size_t i = 0 ; i < net->m_cuda_outputs.size() ; ++i) {
+        const tfrt::cuda_tensor& t = net->m_cuda_outputs[i];
+        const uint32_t kind = (imagenet && i == 0) ?
+            cpu_eval_tensor::kScores : cpu_eval_tensor::kRaw;
+        outputs.emplace_back(t.name, kind, t.shape.n(), t.shape.c(), t.shape.h(), t.shape.w(), t.cpu);
+    }
+    if(ssd) {
+        const size_t num = bboxes2d.size();
+        cpu_eval_tensor det{"detections", cpu_eval_tensor::kBoxes, 1, 6, uint32_t(num), 1};
+        for(size_t i = 0 ; i < num ; ++i) {
+            float* row = det.data.data() + i * 6;
+            row[0] = bboxes2d.classes[i];
+            row[1] = bboxes2d.scores[i];
+            for(int k = 0 ; k < 4 ; ++k) {
+                row[2 + k] = bboxes2d.boxes(i, k);
+            }
+        }
+        outputs.push_back(std::move(det));
+    }
+    if(seg) {
+        // Segmentation masks: host argmax of the raw probabilities.
+        const auto& shape = seg->raw_probabilities().shape;
+        const size_t size = size_t(shape.n()) * shape.h() * shape.w();
+        std::vector<uint8_t> classes(size);
+        std::vector<float> scores(size);
+        CHECK(cpu_seg_argmax(seg->raw_probabilities().cpu, classes.data(), scores.data(),
+            shape.n(), shape.w(), shape.h(), shape.c(), seg->empty_class(),
+            seg->detection_threshold())) << "Failed to compute segmentation masks.";
+        cpu_eval_tensor mask{"classes", cpu_eval_tensor::kMask,
+            uint32_t(shape.n()), 1, uint32_t(shape.h()), uint32_t(shape.w())};
+        std::copy(classes.begin(), classes.end(), mask.data.begin());
+        outputs.push_back(std::move(mask));
+    }
+    return sum_ns / std::max(FLAGS_iterations, 1);
+}
+
+/** Run the fp32 and fp16 networks side by side on every image. */
+void evaluate(eval_results& res)
+{
+    const std::string pb_files[2] = {FLAGS_network_pb32, FLAGS_network_pb16};
+    std::unique_ptr<tfrt::network> nets[2];
+    for(int p = 0 ; p < 2 ; ++p) {
+        CHECK(!pb_files[p].empty()) << "Missing " << kPrecisions[p] << " network protobuf file.";
+        nets[p] = tfrt::nets_factory(FLAGS_network);
+        CHECK(nets[p]) << "Unknown network: " << FLAGS_network;
+        nets[p]->half_bindings(FLAGS_half_bindings);
+        CHECK(nets[p]->load(pb_files[p])) << "Could not load network: " << pb_files[p];
+    }
+    uint32_t num_classes = 256;
+    if(auto seg = dynamic_cast<tfrt::seg_network*>(nets[0].get())) {
+        num_classes = seg->num_classes();
+    }
+    const auto files = list_files(FLAGS_images, {".jpg", ".jpeg", ".png"});
+    CHECK(!files.empty()) << "No images in: " << FLAGS_images;
+    if(!FLAGS_dump_dir.empty()) {
+        mkdir(FLAGS_dump_dir.c_str(), 0755);
+        for(int p = 0 ; p < 2 ; ++p) {
+            mkdir((FLAGS_dump_dir + "/" + kPrecisions[p]).c_str(), 0755);
+        }
+    }
+    // Images decoded by a threads pool, ahead of the networks. RGBA float
+    // input re-allocated only for larger images.
+    std::vector<std::string> filenames;
+    for(auto&& f : files) {
+        filenames.push_back(FLAGS_images + "/" + f);
+    }
+    cpu_image_loader loader(filenames);
+    cpu_image image;
+    tfrt::cuda_tensor img("image", {1, 4, 0, 0});
+    size_t img_capacity = 0;
+    std::vector<cpu_eval_tensor> outputs[2];
+    for(auto&& f : files) {
+        CHECK(loader.next(image));
+        CHECK(image.valid()) << "Failed to read image file: " << image.filename;
+        const nvinfer1::DimsNCHW shape{1, 4, int(image.height), int(image.width)};
+        if(size_t(image.width) * image.height > img_capacity) {
+            img.reshape(shape);
+            CHECK(img.allocate()) << "Failed to allocate image: " << image.filename;
+            img_capacity = size_t(image.width) * image.height;
+        }
+        img.shape = shape;
+        CHECK(cpu_image_to_rgba_float(image, img.cpu));
+        for(int p = 0 ; p < 2 ; ++p) {
+            const uint64_t latency_ns = run_network(nets[p].get(), img, outputs[p]);
+            res.latency[p].record(latency_ns);
+            if(!FLAGS_dump_dir.empty()) {
+                const std::string dname = FLAGS_dump_dir + "/" + kPrecisions[p] + "/" +
+                    basename_noext(f) + ".eval";
+                CHECK(cpu_eval_save(dname, outputs[p], latency_ns))
+                    << "Could not save outputs: " << dname;
+            }
+        }
+        CHECK(cpu_eval_compare(outputs[0], outputs[1], num_classes, res.stats))
+            << "Could not compare outputs on image: " << image.filename;
+        res.num_images++;
+        LOG(INFO) << "Evaluated image " << res.num_images << "/" << files.size() << ": " << f;
+    }
+}
+#endif
+}
+
+/** Accuracy vs speed of the fp16 variant of a network, against fp32: latency,
+ * max / mean absolute errors of the outputs, top-1 agreement (ImageNet), mean
+ * matched box IoU (SSD) and mIoU of segmentation masks.
+ * The outputs can be saved (--dump_dir) and compared later on host only
+ * (--compare_dir), e.g. on a machine without GPU.
+ */
+int main(int argc, char* argv[])
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    CHECK_GT(FLAGS_iterations, 0) << "Invalid number of iterations.";
+
+    eval_results res;
+    bool use_gpu = FLAGS_compare_dir.empty();
+#ifdef TFRT_CPU_ONLY
+    CHECK(!use_gpu) << "Host only build: use --compare_dir with saved outputs.";
+#else
+    int num_devices = 0;
+    if(use_gpu && (cudaGetDeviceCount(&num_devices) != cudaSuccess || num_devices == 0)) {
+        LOG(FATAL) << "No CUDA device: use --compare_dir with saved outputs.";
+    }
+    if(use_gpu) {
+        evaluate(res);
+    }
+#endif
+    if(!use_gpu) {
+        compare_saved(FLAGS_compare_dir, res);
+    }
+    print_results(std::cout, res);
+    if(FLAGS_results_json.length()) {
+        save_results_json(FLAGS_results_json, res);
+    }
+    return 0;
+}
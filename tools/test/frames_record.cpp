@@ -0,0 +1,87 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <iostream>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <NVX/nvx.h>
+#include <OVX/FrameSourceOVX.hpp>
+#include <OVX/UtilityOVX.hpp>
+
+#include <camera/frameRecord.h>
+#include <camera/replayFrameSource.h>
+
+DEFINE_string(source, "device:///v4l2?index=0", "Source URI: camera, video file or replay:///file.");
+DEFINE_int32(source_width, 1280, "Source width. Only for camera.");
+DEFINE_int32(source_height, 720, "Source height. Only for camera.");
+DEFINE_int32(source_fps, 30, "Source fps. Only for camera.");
+DEFINE_string(output, "frames.rec", "Output record file.");
+DEFINE_int32(num_frames, 300, "Number of frames to record.");
+DEFINE_bool(info, false, "Only print the index of the record file given by --output.");
+
+/** Record frames from a source (camera, video, ...) for deterministic replays
+ * (replay:///file source), or print the content of a record.
+ */
+int main(int argc, char* argv[])
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (FLAGS_info) {
+        tfrt::frame_replay replay;
+        CHECK(replay.open(FLAGS_output)) << "Invalid record file: " << FLAGS_output;
+        const size_t n = replay.num_frames();
+        for (size_t i = 0; i < n; ++i) {
+            const tfrt::frame_info& f = replay.info(i);
+            std::cout << "Frame " << i << ": " << f.width << "x" << f.height
+                << " | format " << std::string((const char*)&f.format, 4)
+                << " | planes " << f.num_planes << " | stride " << f.strides[0]
+                << " | " << f.size << " bytes | t = "
+                << (f.timestamp_ns - replay.info(0).timestamp_ns) * 1e-6 << " ms" << std::endl;
+        }
+        return 0;
+    }
+
+    ovxio::ContextGuard context;
+    auto source = tfrt::create_frame_source(context, FLAGS_source, FLAGS_output);
+    CHECK(source) << "Can not create frame source: " << FLAGS_source;
+    if (source->getSourceType() == ovxio::FrameSource::CAMERA_SOURCE) {
+        auto params = source->getConfiguration();
+        params.frameWidth = FLAGS_source_width;
+        params.frameHeight = FLAGS_source_height;
+        params.fps = FLAGS_source_fps;
+        params.format = VX_DF_IMAGE_RGBX;
+        source->setConfiguration(params);
+    }
+    CHECK(source->open()) << "Can not open frame source: " << FLAGS_source;
+    const auto params = source->getConfiguration();
+    vx_image frame = vxCreateImage(context, params.frameWidth, params.frameHeight, VX_DF_IMAGE_RGBX);
+    NVXIO_CHECK_REFERENCE(frame);
+
+    int num_frames = 0;
+    while (num_frames < FLAGS_num_frames) {
+        auto status = source->fetch(frame, 1000);
+        if (status == ovxio::FrameSource::CLOSED) {
+            break;
+        }
+        num_frames += (status == ovxio::FrameSource::OK);
+    }
+    // Record index written when closing the source.
+    source.reset();
+    vxReleaseImage(&frame);
+    std::cout << "Recorded " << num_frames << " frames in " << FLAGS_output << std::endl;
+    return 0;
+}
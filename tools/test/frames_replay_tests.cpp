@@ -0,0 +1,138 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <unistd.h>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <camera/frameRecord.h>
+
+DEFINE_int32(height, 480, "Frame height.");
+DEFINE_int32(width, 640, "Frame width.");
+DEFINE_int32(padding, 64, "Rows padding (bytes) of the recorded planes.");
+DEFINE_int32(num_frames, 3, "Number of recorded frames.");
+DEFINE_string(filename, "/tmp/tfrt_frames_replay_tests.frm", "Temporary recording file.");
+
+/* ============================================================================
+ * Frames record / replay round trip, on host NV12 frames.
+ * ========================================================================== */
+/** NV12 plane of a synthetic frame: OpenVX addressing, padded rows. */
+struct nv12_plane
+{
+    uint32_t  scale;
+    uint32_t  stride_x;
+    uint32_t  rows;
+    uint32_t  row_bytes;
+    uint32_t  stride;
+    std::vector<uint8_t>  data;
+};
+nv12_plane make_plane(uint32_t width, uint32_t height, uint32_t scale, uint32_t stride_x,
+    uint32_t padding, uint32_t seed)
+{
+    nv12_plane p;
+    p.scale = scale;
+    p.stride_x = stride_x;
+    tfrt::frame_plane_geometry(width, height, scale, scale, stride_x, p.rows, p.row_bytes);
+    p.stride = p.row_bytes + padding;
+    p.data.resize(size_t(p.rows) * p.stride);
+    for(size_t i = 0 ; i < p.data.size() ; ++i) {
+        p.data[i] = uint8_t((i * 2654435761u + seed) >> 7);
+    }
+    return p;
+}
+
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    int num_errors = 0;
+    const uint32_t width = FLAGS_width;
+    const uint32_t height = FLAGS_height;
+    const uint32_t nv12 = 'N' | ('V' << 8) | ('1' << 16) | ('2' << 24);
+
+    // Plane geometry: full size luma, half size interleaved chroma.
+    nv12_plane luma = make_plane(width, height, 1024, 1, FLAGS_padding, 0);
+    if(luma.rows != height || luma.row_bytes != width) {
+        LOG(ERROR) << "Invalid luma geometry: " << luma.rows << " x " << luma.row_bytes;
+        num_errors++;
+    }
+    nv12_plane chroma = make_plane(width, height, 512, 2, FLAGS_padding, 0);
+    if(chroma.rows != height / 2 || chroma.row_bytes != width) {
+        LOG(ERROR) << "Invalid chroma geometry: " << chroma.rows << " x " << chroma.row_bytes;
+        num_errors++;
+    }
+    std::cout << "NV12 " << width << "x" << height << ": luma " << luma.rows << " rows of "
+        << luma.row_bytes << " bytes, chroma " << chroma.rows << " rows of "
+        << chroma.row_bytes << " bytes." << std::endl;
+
+    // Record a few frames with different content.
+    std::vector<nv12_plane> frames;
+    tfrt::frame_recorder recorder;
+    CHECK(recorder.open(FLAGS_filename)) << "Could not open: " << FLAGS_filename;
+    for(int i = 0 ; i < FLAGS_num_frames ; ++i) {
+        frames.push_back(make_plane(width, height, 1024, 1, FLAGS_padding, 2 * i));
+        frames.push_back(make_plane(width, height, 512, 2, FLAGS_padding, 2 * i + 1));
+        const nv12_plane& y = frames[2 * i];
+        const nv12_plane& uv = frames[2 * i + 1];
+        const void* planes[2] = {y.data.data(), uv.data.data()};
+        const uint32_t strides[2] = {y.stride, uv.stride};
+        const uint32_t heights[2] = {y.rows, uv.rows};
+        if(!recorder.record(width, height, nv12, 2, planes, strides, heights, 1000000 * i)) {
+            LOG(ERROR) << "Could not record frame " << i;
+            num_errors++;
+        }
+    }
+    CHECK(recorder.close()) << "Could not close: " << FLAGS_filename;
+
+    // Replay and compare the bytes, row by row.
+    tfrt::frame_replay replay;
+    CHECK(replay.open(FLAGS_filename)) << "Could not replay: " << FLAGS_filename;
+    if(replay.num_frames() != size_t(FLAGS_num_frames)) {
+        LOG(ERROR) << "Invalid number of replayed frames: " << replay.num_frames();
+        num_errors++;
+    }
+    for(size_t i = 0 ; i < std::min(replay.num_frames(), size_t(FLAGS_num_frames)) ; ++i) {
+        const tfrt::frame_info& info = replay.info(i);
+        if(info.width != width || info.height != height || info.format != nv12 ||
+                info.num_planes != 2 || info.timestamp_ns != int64_t(1000000 * i)) {
+            LOG(ERROR) << "Invalid frame info " << i;
+            num_errors++;
+            continue;
+        }
+        for(uint32_t p = 0 ; p < 2 ; ++p) {
+            const nv12_plane& plane = frames[2 * i + p];
+            const uint8_t* data = replay.plane(i, p);
+            for(uint32_t r = 0 ; r < plane.rows ; ++r) {
+                if(memcmp(data + r * info.strides[p], plane.data.data() + r * plane.stride,
+                        plane.row_bytes) != 0) {
+                    LOG(ERROR) << "Frame " << i << ", plane " << p << ": row " << r << " differs.";
+                    num_errors++;
+                    break;
+                }
+            }
+        }
+    }
+    replay.close();
+    unlink(FLAGS_filename.c_str());
+
+    std::cout << "Frames record / replay: " << num_errors << " error(s)." << std::endl;
+    return num_errors ? 1 : 0;
+}
@@ -0,0 +1,99 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <cpu/cpuImageLoader.h>
+
+DEFINE_string(images, "../data/images", "Directory of test images.");
+DEFINE_int32(threads, 0, "Number of decoding threads (0: all cores).");
+DEFINE_int32(prefetch, 0, "Number of prefetched images (0: twice the threads).");
+DEFINE_int32(passes, 3, "Number of passes over the directory, for timings.");
+
+/* ============================================================================
+ * Prefetching loader vs sequential decoding: same images, in the same order,
+ * and decoding throughput.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    std::vector<std::string> filenames;
+    CHECK(cpu_list_images(FLAGS_images, filenames)) << "Invalid directory: " << FLAGS_images;
+    CHECK(!filenames.empty()) << "No images in: " << FLAGS_images;
+    // Sequential reference, in a single re-used image.
+    std::vector<cpu_image> refs(filenames.size());
+    cpu_image image;
+    size_t num_pixels = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for(int p = 0 ; p < FLAGS_passes ; ++p) {
+        for(size_t i = 0 ; i < filenames.size() ; ++i) {
+            CHECK(cpu_decode_image(filenames[i], image)) << "Could not decode: " << filenames[i];
+            num_pixels += size_t(image.width) * image.height;
+            if(p == 0) {
+                refs[i] = image;
+            }
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    // Loader, one instance per pass.
+    int num_errors = 0;
+    size_t num_threads = 0;
+    for(int p = 0 ; p < FLAGS_passes ; ++p) {
+        cpu_image_loader loader(filenames, FLAGS_threads, FLAGS_prefetch);
+        num_threads = loader.num_threads();
+        size_t i = 0;
+        while(loader.next(image)) {
+            const cpu_image& ref = refs[i];
+            if(image.filename != ref.filename || image.width != ref.width ||
+                    image.height != ref.height ||
+                    std::memcmp(image.data.data(), ref.data.data(), ref.pitch() * ref.height)) {
+                LOG(ERROR) << "Mismatch of image " << i << ": " << image.filename;
+                num_errors++;
+            }
+            ++i;
+        }
+        if(i != filenames.size()) {
+            LOG(ERROR) << "Loader returned " << i << " images out of " << filenames.size();
+            num_errors++;
+        }
+    }
+    // Early destruction, with decoding in progress.
+    {
+        cpu_image_loader loader(filenames, FLAGS_threads, 1);
+        loader.next(image);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    const double mpixels = num_pixels * 1e-6;
+    const double seq_s = std::chrono::duration<double>(t1 - t0).count();
+    const double pool_s = std::chrono::duration<double>(t2 - t1).count();
+    std::cout << "Decoding " << filenames.size() << " images x " << FLAGS_passes << " passes | "
+        << "sequential: " << mpixels / seq_s << " Mpixels/s | loader (" << num_threads
+        << " threads): " << mpixels / pool_s << " Mpixels/s" << std::endl;
+    if(num_errors) {
+        LOG(ERROR) << "Loader and sequential decoding differ: " << num_errors << " failed cases.";
+        return 1;
+    }
+    std::cout << "Images loader is consistent." << std::endl;
+    return 0;
+}
@@ -0,0 +1,259 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <boxes2d/operations.h>
+#include <cpu/cpuOverlay.h>
+#include <misc/overlay.h>
+
+#ifndef TFRT_CPU_ONLY
+#include <tensor.h>
+#include <cuda/cudaOverlay.h>
+#include <cuda/cudaSegmentation.h>
+#endif
+
+DEFINE_int32(height, 720, "Frame height.");
+DEFINE_int32(width, 1280, "Frame width.");
+DEFINE_int32(num_boxes, 100, "Number of random boxes drawn.");
+DEFINE_int32(iterations, 100, "Number of timing iterations.");
+
+/* ============================================================================
+ * Fixtures and scalar references.
+ * ========================================================================== */
+/** Random detections, normalized coordinates. */
+tfrt::boxes2d::bboxes2d random_bboxes(int n, std::mt19937& gen)
+{
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    tfrt::boxes2d::bboxes2d bboxes(n);
+    for(int i = 0 ; i < n ; ++i) {
+        const float y0 = dist(gen), x0 = dist(gen);
+        bboxes.classes[i] = 1 + gen() % 20;
+        bboxes.scores[i] = dist(gen);
+        bboxes.boxes.row(i) << y0, x0, std::min(y0 + 0.3f * dist(gen), 1.0f),
+            std::min(x0 + 0.3f * dist(gen), 1.0f);
+    }
+    return bboxes;
+}
+/** Random RGBA LUT. */
+tfrt::overlay_lut random_lut(std::mt19937& gen)
+{
+    tfrt::overlay_lut lut;
+    for(int i = 0 ; i < 256 ; ++i) {
+        lut.set(i, tfrt::overlay_color{uint8_t(gen()), uint8_t(gen()), uint8_t(gen()), uint8_t(gen())});
+    }
+    return lut;
+}
+/** Scalar span blending, pixel by pixel. */
+void reference_spans(uint8_t* img, int stride_x, int stride_y, const tfrt::overlay_spans& spans)
+{
+    for(int y = 0 ; y < spans.height() ; ++y) {
+        for(int32_t s = spans.offsets()[y] ; s < spans.offsets()[y+1] ; ++s) {
+            const tfrt::overlay_span& span = spans.spans()[s];
+            for(int x = span.x0 ; x < span.x1 ; ++x) {
+                uint8_t* px = img + y * stride_y + x * stride_x;
+                px[0] = tfrt::overlay_blend(px[0], span.color.r, span.color.a);
+                px[1] = tfrt::overlay_blend(px[1], span.color.g, span.color.a);
+                px[2] = tfrt::overlay_blend(px[2], span.color.b, span.color.a);
+            }
+        }
+    }
+}
+/** Copy of RGBX image to RGB. */
+std::vector<uint8_t> to_rgb(const std::vector<uint8_t>& rgbx)
+{
+    std::vector<uint8_t> rgb(rgbx.size() / 4 * 3);
+    for(size_t i = 0 ; i < rgbx.size() / 4 ; ++i) {
+        std::memcpy(&rgb[3*i], &rgbx[4*i], 3);
+    }
+    return rgb;
+}
+
+/* ============================================================================
+ * Overlay drawing: scalar references, vectorized host and CUDA consistency.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const int h = FLAGS_height;
+    const int w = FLAGS_width;
+    std::mt19937 gen(42);
+    int num_errors = 0;
+    // Integer blending: exact rounding of the float blend (never a tie: 255 odd).
+    for(int p = 0 ; p < 256 ; ++p) {
+        for(int c = 0 ; c < 256 ; ++c) {
+            for(int a = 0 ; a < 256 ; ++a) {
+                const int v = tfrt::overlay_blend(p, c, a);
+                const int ref = (p * (255 - a) + c * a + 127) / 255;
+                if(v != ref) {
+                    LOG(ERROR) << "Blending (" << p << ", " << c << ", " << a << "): " << v
+                        << " vs " << ref;
+                    num_errors++;
+                }
+            }
+        }
+    }
+    // Random frame, boxes and mask.
+    std::vector<uint8_t> image(size_t(w) * h * 4);
+    for(auto& v : image) {
+        v = gen() & 0xff;
+    }
+    const tfrt::boxes2d::bboxes2d bboxes = random_bboxes(FLAGS_num_boxes, gen);
+    const tfrt::overlay_lut lut = random_lut(gen);
+    const int mh = h / 4 + 1, mw = w / 4 + 3;
+    std::vector<uint8_t> mask(size_t(mw) * mh);
+    for(auto& v : mask) {
+        v = gen() & 0xff;
+    }
+    tfrt::overlay_spans spans;
+    tfrt::boxes2d::overlay(bboxes, w, h, lut, 3, spans);
+    LOG(INFO) << "Boxes overlay: " << spans.spans().size() << " spans.";
+
+    // Spans: RGBX (vectorized) and RGB (scalar) vs reference.
+    std::vector<uint8_t> rgbx_ref = image, rgbx = image;
+    std::vector<uint8_t> rgb = to_rgb(image);
+    reference_spans(rgbx_ref.data(), 4, w * 4, spans);
+    CHECK(cpu_overlay_spans(rgbx.data(), w, h, 4, w * 4, spans));
+    CHECK(cpu_overlay_spans(rgb.data(), w, h, 3, w * 3, spans));
+    if(rgbx != rgbx_ref || rgb != to_rgb(rgbx_ref)) {
+        LOG(ERROR) << "Spans overlay: mismatch with the scalar reference.";
+        num_errors++;
+    }
+    // Outlines and tags only touch a fraction of the frame; X channel kept.
+    size_t num_touched = 0;
+    for(size_t i = 0 ; i < image.size() ; i += 4) {
+        num_touched += std::memcmp(&image[i], &rgbx[i], 3) != 0;
+        if(image[i+3] != rgbx[i+3]) {
+            LOG(ERROR) << "Spans overlay: X channel modified.";
+            num_errors++;
+            break;
+        }
+    }
+    LOG(INFO) << "Boxes overlay: " << num_touched << " pixels modified.";
+    // Segmentation overlay: RGBX vs RGB vs reference.
+    std::vector<uint8_t> seg_ref = image, seg = image;
+    std::vector<uint8_t> seg_rgb = to_rgb(image);
+    const float scale_x = float(mw) / float(w);
+    const float scale_y = float(mh) / float(h);
+    for(int y = 0 ; y < h ; ++y) {
+        for(int x = 0 ; x < w ; ++x) {
+            const int mx = std::max(std::min(int(float(x) * scale_x), mw - 1), 0);
+            const int my = std::max(std::min(int(float(y) * scale_y), mh - 1), 0);
+            const tfrt::overlay_color c = lut.colors[mask[my * mw + mx]];
+            uint8_t* px = &seg_ref[(y * w + x) * 4];
+            px[0] = tfrt::overlay_blend(px[0], c.r, c.a);
+            px[1] = tfrt::overlay_blend(px[1], c.g, c.a);
+            px[2] = tfrt::overlay_blend(px[2], c.b, c.a);
+        }
+    }
+    CHECK(cpu_seg_overlay(seg.data(), mask.data(), w, h, 4, w * 4, mw, mh, 1, mw, lut));
+    CHECK(cpu_seg_overlay(seg_rgb.data(), mask.data(), w, h, 3, w * 3, mw, mh, 1, mw, lut));
+    if(seg != seg_ref || seg_rgb != to_rgb(seg_ref)) {
+        LOG(ERROR) << "Segmentation overlay: mismatch with the scalar reference.";
+        num_errors++;
+    }
+
+    // Timings: spans build, boxes and segmentation overlays.
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+        tfrt::boxes2d::overlay(bboxes, w, h, lut, 3, spans);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+        cpu_overlay_spans(rgbx.data(), w, h, 4, w * 4, spans);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+        cpu_seg_overlay(seg.data(), mask.data(), w, h, 4, w * 4, mw, mh, 1, mw, lut);
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    std::cout << h << "x" << w << " | " << FLAGS_num_boxes << " boxes spans: "
+        << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+        << " ms | boxes overlay: "
+        << std::chrono::duration<double, std::milli>(t2 - t1).count() / FLAGS_iterations
+        << " ms | segmentation overlay: "
+        << std::chrono::duration<double, std::milli>(t3 - t2).count() / FLAGS_iterations
+        << " ms" << std::endl;
+
+#ifndef TFRT_CPU_ONLY
+    // CUDA overlays: same integer blending, bitwise identical.
+    {
+        tfrt::cuda_tensor_u8 img_cuda{"img_cuda", {1, 1, h, w * 4}};
+        tfrt::cuda_tensor_u8 mask_cuda{"mask_cuda", {1, 1, mh, mw}};
+        tfrt::cuda_tensor_u8 lut_cuda{"lut_cuda", {1, 1, 1, 256 * 4}};
+        tfrt::cuda_tensor_i32 offsets_cuda{"offsets_cuda", {1, 1, 1, h + 1}};
+        tfrt::cuda_tensor_t<tfrt::overlay_span> spans_cuda{"spans_cuda",
+            {1, 1, 1, std::max(int(spans.spans().size()), 1)}};
+        CHECK(img_cuda.allocate());
+        CHECK(mask_cuda.allocate());
+        CHECK(lut_cuda.allocate());
+        CHECK(offsets_cuda.allocate());
+        CHECK(spans_cuda.allocate());
+        std::copy(mask.begin(), mask.end(), mask_cuda.cpu);
+        std::memcpy(lut_cuda.cpu, lut.colors, 256 * 4);
+        std::copy(spans.offsets().begin(), spans.offsets().end(), offsets_cuda.cpu);
+        std::copy(spans.spans().begin(), spans.spans().end(), spans_cuda.cpu);
+
+        std::copy(image.begin(), image.end(), img_cuda.cpu);
+        CUDA(cuda_overlay_spans(img_cuda.cuda, w, h, 4, w * 4, offsets_cuda.cuda, spans_cuda.cuda));
+        CUDA(cudaDeviceSynchronize());
+        if(std::memcmp(img_cuda.cpu, rgbx_ref.data(), rgbx_ref.size())) {
+            LOG(ERROR) << "Spans overlay: mismatch with CUDA.";
+            num_errors++;
+        }
+        std::copy(image.begin(), image.end(), img_cuda.cpu);
+        CUDA(cuda_seg_overlay(img_cuda.cuda, mask_cuda.cuda, (const uchar4*)lut_cuda.cuda,
+            w, h, 4, w * 4, mw, mh, 1, mw));
+        CUDA(cudaDeviceSynchronize());
+        if(std::memcmp(img_cuda.cpu, seg_ref.data(), seg_ref.size())) {
+            LOG(ERROR) << "Segmentation overlay: mismatch with CUDA.";
+            num_errors++;
+        }
+        // CUDA timings.
+        t0 = std::chrono::high_resolution_clock::now();
+        for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+            cuda_overlay_spans(img_cuda.cuda, w, h, 4, w * 4, offsets_cuda.cuda, spans_cuda.cuda);
+        }
+        CUDA(cudaDeviceSynchronize());
+        t1 = std::chrono::high_resolution_clock::now();
+        for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+            cuda_seg_overlay(img_cuda.cuda, mask_cuda.cuda, (const uchar4*)lut_cuda.cuda,
+                w, h, 4, w * 4, mw, mh, 1, mw);
+        }
+        CUDA(cudaDeviceSynchronize());
+        t2 = std::chrono::high_resolution_clock::now();
+        std::cout << "CUDA | boxes overlay: "
+            << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+            << " ms | segmentation overlay: "
+            << std::chrono::duration<double, std::milli>(t2 - t1).count() / FLAGS_iterations
+            << " ms" << std::endl;
+    }
+#endif
+    if(num_errors) {
+        LOG(ERROR) << "Overlay drawing: " << num_errors << " failed cases.";
+        return 1;
+    }
+    std::cout << "Overlay drawing is consistent." << std::endl;
+    return 0;
+}
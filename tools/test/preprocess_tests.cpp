@@ -0,0 +1,203 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <tensor.h>
+#include <cuda/cudaCHWImage.h>
+#include <cpu/cpuCHWImage.h>
+#include <cpu/cpuHalfPrecision.h>
+#include <cuda/cudaHalfPrecision.h>
+
+DEFINE_int32(height, 720, "Input image height.");
+DEFINE_int32(width, 1280, "Input image width.");
+DEFINE_int32(padding, 64, "Row padding of the input image, in bytes.");
+DEFINE_int32(iterations, 100, "Number of timing iterations.");
+
+/* ============================================================================
+ * CUDA vs CPU fused preprocessing: outputs must be bitwise identical, for
+ * every resize mode.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const int h = FLAGS_height;
+    const int w = FLAGS_width;
+    const int stride_y = w * 4 + FLAGS_padding;
+    // Mapped memory, shared by CUDA and CPU.
+    tfrt::cuda_tensor_u8 image{"image", {1, 1, h, stride_y}};
+    CHECK(image.allocate());
+    std::mt19937 gen(42);
+    for(int i = 0 ; i < h * stride_y ; ++i) {
+        image.cpu[i] = gen() & 0xff;
+    }
+    // Output shapes: downscale, upscale, odd sizes and identity.
+    const std::vector<std::pair<int, int> > shapes = {
+        {300, 300}, {224, 224}, {225, 400}, {h * 2 - 1, w + 3}, {37, 61}, {h, w}};
+    const float scale[3] = {1.0f / 58.395f, 1.0f / 57.12f, 1.0f / 57.375f};
+    const float shift[3] = {-123.68f / 58.395f, -116.78f / 57.12f, -103.94f / 57.375f};
+    const std::vector<tfrt::resize_mode> modes = {tfrt::resize_mode::nearest,
+        tfrt::resize_mode::bilinear, tfrt::resize_mode::area};
+    int num_errors = 0;
+    for(auto&& shape : shapes) {
+        const int oh = shape.first;
+        const int ow = shape.second;
+        const size_t size = size_t(3) * oh * ow;
+        tfrt::cuda_tensor out_cuda{"out_cuda", {1, 3, oh, ow}};
+        CHECK(out_cuda.allocate());
+        std::vector<float> out_cpu(size);
+        for(auto mode : modes) {
+            for(bool half_output : {false, true}) {
+                CUDA(cuda_rgba_to_chw_normalize(image.cuda, out_cuda.cuda, w, h, 4, stride_y,
+                    ow, oh, mode, scale, shift, half_output));
+                CUDA(cudaDeviceSynchronize());
+                CHECK(cpu_rgba_to_chw_normalize(image.cpu, out_cpu.data(), w, h, 4, stride_y,
+                    ow, oh, mode, scale, shift, half_output));
+                // Bitwise comparison (fp16: half of the buffer used).
+                const size_t nbytes = size * (half_output ? sizeof(uint16_t) : sizeof(float));
+                if(std::memcmp(out_cpu.data(), out_cuda.cpu, nbytes)) {
+                    LOG(ERROR) << "Mismatch with output shape " << oh << "x" << ow
+                        << " (" << tfrt::resize_mode_name(mode) << ", half: " << half_output << ").";
+                    num_errors++;
+                }
+            }
+        }
+    }
+    // Batched ROIs: inner, border, tiny, full image and invalid crops.
+    const std::vector<int32_t> rois_host = {
+        100, 50, 200, 300,  0, 0, 17, 9,  w - 64, h - 48, 64, 48,
+        5, 7, 1, 1,  0, 0, w, h,  w - 10, 0, 20, 10};
+    const uint32_t num_rois = rois_host.size() / 4;
+    tfrt::cuda_tensor_i32 rois{"rois", {int(num_rois), 4, 1, 1}};
+    CHECK(rois.allocate());
+    std::copy(rois_host.begin(), rois_host.end(), rois.cpu);
+    {
+        const size_t size = size_t(num_rois) * 3 * 224 * 224;
+        tfrt::cuda_tensor out_cuda{"out_cuda", {int(num_rois), 3, 224, 224}};
+        CHECK(out_cuda.allocate());
+        std::vector<float> out_cpu(size);
+        for(auto mode : modes) {
+            for(bool half_output : {false, true}) {
+                CUDA(cuda_rgba_rois_to_chw_normalize(image.cuda, w, h, 4, stride_y,
+                    rois.cuda, num_rois, out_cuda.cuda, 224, 224, mode, scale, shift, half_output));
+                CUDA(cudaDeviceSynchronize());
+                CHECK(cpu_rgba_rois_to_chw_normalize(image.cpu, w, h, 4, stride_y,
+                    rois.cpu, num_rois, out_cpu.data(), 224, 224, mode, scale, shift, half_output));
+                const size_t nbytes = size * (half_output ? sizeof(uint16_t) : sizeof(float));
+                if(std::memcmp(out_cpu.data(), out_cuda.cpu, nbytes)) {
+                    LOG(ERROR) << "Mismatch of batched ROIs ("
+                        << tfrt::resize_mode_name(mode) << ", half: " << half_output << ").";
+                    num_errors++;
+                }
+            }
+        }
+    }
+    // Letterbox: wide and tall outputs (horizontal and vertical padding).
+    for(auto&& shape : std::vector<std::pair<int, int> >{{300, 300}, {416, 256}}) {
+        const int oh = shape.first;
+        const int ow = shape.second;
+        const size_t size = size_t(3) * oh * ow;
+        const tfrt::letterbox lb = tfrt::make_letterbox(w, h, ow, oh);
+        tfrt::cuda_tensor out_cuda{"out_cuda", {1, 3, oh, ow}};
+        CHECK(out_cuda.allocate());
+        std::vector<float> out_cpu(size);
+        for(auto mode : modes) {
+            for(bool half_output : {false, true}) {
+                CUDA(cuda_rgba_to_chw_letterbox(image.cuda, out_cuda.cuda, w, h, 4, stride_y,
+                    ow, oh, lb, 128, mode, scale, shift, half_output));
+                CUDA(cudaDeviceSynchronize());
+                CHECK(cpu_rgba_to_chw_letterbox(image.cpu, out_cpu.data(), w, h, 4, stride_y,
+                    ow, oh, lb, 128, mode, scale, shift, half_output));
+                const size_t nbytes = size * (half_output ? sizeof(uint16_t) : sizeof(float));
+                if(std::memcmp(out_cpu.data(), out_cuda.cpu, nbytes)) {
+                    LOG(ERROR) << "Mismatch of letterbox " << oh << "x" << ow
+                        << " (" << tfrt::resize_mode_name(mode) << ", half: " << half_output << ").";
+                    num_errors++;
+                }
+            }
+        }
+    }
+    // fp16 bindings conversions: every half value (NaNs payloads excluded),
+    // and float values just below them (rounding).
+    {
+        std::vector<uint16_t> halves(1 << 16), h_cpu(1 << 16), h_cuda(1 << 16);
+        std::vector<float> f_cpu(1 << 16), f_cuda(1 << 16);
+        for(size_t i = 0 ; i < halves.size() ; ++i) {
+            const bool nan = (i & 0x7c00) == 0x7c00 && (i & 0x3ff);
+            halves[i] = nan ? 0 : uint16_t(i);
+        }
+        CUDA(cuda_half2float_array(halves.data(), f_cuda.data(), halves.size()));
+        CHECK(cpu_half2float_array(halves.data(), f_cpu.data(), halves.size()));
+        if(std::memcmp(f_cpu.data(), f_cuda.data(), f_cpu.size() * sizeof(float))) {
+            LOG(ERROR) << "Mismatch of half to float conversion.";
+            num_errors++;
+        }
+        for(float& v : f_cpu) {
+            v = std::nextafter(v, 0.0f);
+        }
+        CUDA(cuda_float2half_array(f_cpu.data(), h_cuda.data(), f_cpu.size()));
+        CHECK(cpu_float2half_array(f_cpu.data(), h_cpu.data(), f_cpu.size()));
+        if(std::memcmp(h_cpu.data(), h_cuda.data(), h_cpu.size() * sizeof(uint16_t))) {
+            LOG(ERROR) << "Mismatch of float to half conversion.";
+            num_errors++;
+        }
+    }
+    // Constant image: every filter must preserve it exactly.
+    std::memset(image.cpu, 77, size_t(h) * stride_y);
+    for(auto mode : modes) {
+        std::vector<float> out_cpu(3 * 225 * 400);
+        CHECK(cpu_rgba_to_chw_normalize(image.cpu, out_cpu.data(), w, h, 4, stride_y,
+            400, 225, mode, nullptr, nullptr, false));
+        for(float v : out_cpu) {
+            if(v != 77.0f) {
+                LOG(ERROR) << "Constant image not preserved by the "
+                    << tfrt::resize_mode_name(mode) << " filter: " << v;
+                num_errors++;
+                break;
+            }
+        }
+    }
+
+    // Timings: 300x300 fp32 input.
+    std::vector<float> out_cpu(3 * 300 * 300);
+    for(auto mode : modes) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+            cpu_rgba_to_chw_normalize(image.cpu, out_cpu.data(), w, h, 4, stride_y,
+                300, 300, mode, scale, shift, false);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::cout << "Preprocessing " << h << "x" << w << " => 3x300x300 ("
+            << tfrt::resize_mode_name(mode) << ") | CPU: "
+            << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+            << " ms" << std::endl;
+    }
+    if(num_errors) {
+        LOG(ERROR) << "CUDA and CPU implementations differ: " << num_errors << " failed cases.";
+        return 1;
+    }
+    std::cout << "CUDA and CPU preprocessing are consistent." << std::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <cpu/cpuSegmentation.h>
+
+DEFINE_int32(batch_size, 2, "Batch size.");
+DEFINE_int32(height, 225, "Segmentation output height.");
+DEFINE_int32(width, 385, "Segmentation output width.");
+DEFINE_int32(num_classes, 18, "Number of classes.");
+DEFINE_int32(iterations, 100, "Number of timing iterations.");
+DEFINE_double(threshold, 0.5, "Detection threshold.");
+
+/** Reference implementation: the original seg_network::post_processing loop,
+ * writing the output at every channel.
+ */
+void seg_argmax_reference(const float* raw_prob, uint8_t* classes, float* scores,
+    int batch_size, int width, int height, int num_classes, bool empty_class, float threshold)
+{
+    for (long n = 0 ; n < batch_size ; ++n) {
+        for (long i = 0 ; i < height ; ++i) {
+            for (long j = 0 ; j < width ; ++j) {
+                uint8_t max_idx = 0;
+                float max_score = 0.0f;
+                for (long k = 0 ; k < num_classes ; ++k) {
+                    float score = raw_prob[((n * num_classes + k) * height + i) * width + j];
+                    if (score > max_score) {
+                        max_idx = uint8_t(k);
+                        max_score = score;
+                    }
+                    long idx = n * height * width + i * width + j;
+                    if (max_score > threshold) {
+                        classes[idx] = max_idx + int(!empty_class);
+                        scores[idx] = max_score;
+                    }
+                    else {
+                        classes[idx] = 0;
+                        scores[idx] = max_score;
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename Fn>
+double time_ms(Fn fn, int iterations)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < iterations ; ++i) {
+        fn();
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / iterations;
+}
+
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const int n = FLAGS_batch_size;
+    const int h = FLAGS_height;
+    const int w = FLAGS_width;
+    const int c = FLAGS_num_classes;
+    // Softmax-like random probabilities.
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> prob(size_t(n) * c * h * w);
+    for(auto& p : prob) {
+        p = dist(gen);
+    }
+    std::vector<uint8_t> classes_ref(n * h * w), classes(n * h * w);
+    std::vector<float> scores_ref(n * h * w), scores(n * h * w);
+
+    // Check the results first.
+    seg_argmax_reference(prob.data(), classes_ref.data(), scores_ref.data(),
+        n, w, h, c, false, FLAGS_threshold);
+    cpu_seg_argmax(prob.data(), classes.data(), scores.data(),
+        n, w, h, c, false, FLAGS_threshold);
+    CHECK(classes == classes_ref) << "Argmax classes differ from reference.";
+    CHECK(scores == scores_ref) << "Argmax scores differ from reference.";
+
+    // Timings...
+    double t_ref = time_ms([&]() {
+        seg_argmax_reference(prob.data(), classes_ref.data(), scores_ref.data(),
+            n, w, h, c, false, FLAGS_threshold);
+    }, FLAGS_iterations);
+    double t_cpu = time_ms([&]() {
+        cpu_seg_argmax(prob.data(), classes.data(), scores.data(),
+            n, w, h, c, false, FLAGS_threshold);
+    }, FLAGS_iterations);
+    std::cout << "Segmentation argmax " << n << "x" << c << "x" << h << "x" << w << std::endl;
+    std::cout << "  reference loop: " << t_ref << " ms" << std::endl;
+    std::cout << "  cpu_seg_argmax: " << t_cpu << " ms (x" << t_ref / t_cpu << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,150 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <cpu/cpuComponents.h>
+
+DEFINE_int32(height, 225, "Segmentation output height.");
+DEFINE_int32(width, 385, "Segmentation output width.");
+DEFINE_int32(num_classes, 18, "Number of classes.");
+DEFINE_int32(num_blobs, 200, "Number of synthetic blobs.");
+DEFINE_int32(num_strips, 0, "Number of parallel strips (0: one per thread).");
+DEFINE_int32(iterations, 1000, "Number of timing iterations.");
+
+/** Synthetic class map: random rectangles and discs, overlapping. */
+std::vector<uint8_t> synthetic_mask(int width, int height, int num_classes, int num_blobs)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> ux(0, width - 1), uy(0, height - 1);
+    std::uniform_int_distribution<int> usize(2, 30), uclass(1, num_classes - 1);
+    std::vector<uint8_t> mask(width * height, 0);
+    for(int i = 0 ; i < num_blobs ; ++i) {
+        const int cx = ux(gen), cy = uy(gen), r = usize(gen);
+        const uint8_t c = uclass(gen);
+        const bool disc = (i % 2 == 0);
+        for(int y = std::max(0, cy - r) ; y < std::min(height, cy + r) ; ++y) {
+            for(int x = std::max(0, cx - r) ; x < std::min(width, cx + r) ; ++x) {
+                if(!disc || (x-cx)*(x-cx) + (y-cy)*(y-cy) < r*r) {
+                    mask[y * width + x] = c;
+                }
+            }
+        }
+    }
+    return mask;
+}
+
+/** Reference labelling: flood fill in raster order. Same labels numbering as
+ * the union-find algorithm (by first pixel in raster order).
+ */
+int flood_fill_reference(const std::vector<uint8_t>& mask, std::vector<int32_t>& labels,
+    int width, int height, bool connectivity8)
+{
+    std::fill(labels.begin(), labels.end(), 0);
+    std::vector<int> stack;
+    int num_labels = 0;
+    for(int i = 0 ; i < width * height ; ++i) {
+        if(mask[i] == 0 || labels[i]) {
+            continue;
+        }
+        labels[i] = ++num_labels;
+        stack.push_back(i);
+        while(!stack.empty()) {
+            const int p = stack.back();
+            stack.pop_back();
+            const int px = p % width, py = p / width;
+            for(int dy = -1 ; dy <= 1 ; ++dy) {
+                for(int dx = -1 ; dx <= 1 ; ++dx) {
+                    if((dx == 0 && dy == 0) || (!connectivity8 && dx != 0 && dy != 0)) {
+                        continue;
+                    }
+                    const int x = px + dx, y = py + dy;
+                    if(x < 0 || x >= width || y < 0 || y >= height) {
+                        continue;
+                    }
+                    const int q = y * width + x;
+                    if(mask[q] == mask[i] && !labels[q]) {
+                        labels[q] = num_labels;
+                        stack.push_back(q);
+                    }
+                }
+            }
+        }
+    }
+    return num_labels;
+}
+
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const int w = FLAGS_width;
+    const int h = FLAGS_height;
+    auto mask = synthetic_mask(w, h, FLAGS_num_classes, FLAGS_num_blobs);
+    std::vector<int32_t> labels(w * h), labels_ref(w * h), parents(w * h + 1);
+    cpu_components components;
+
+    // Check against the reference, with various number of strips.
+    for(bool connectivity8 : {true, false}) {
+        const int num_ref = flood_fill_reference(mask, labels_ref, w, h, connectivity8);
+        for(int num_strips : {1, 2, 3, 4, 7, 8}) {
+            CHECK(cpu_connected_components(mask.data(), nullptr, labels.data(), parents.data(),
+                w, h, connectivity8, num_strips, components));
+            CHECK_EQ(int(components.size()), num_ref) << "Number of components differ. #strips: "
+                << num_strips << " | 8-connectivity: " << connectivity8;
+            CHECK(labels == labels_ref) << "Labels differ from reference. #strips: "
+                << num_strips << " | 8-connectivity: " << connectivity8;
+        }
+        // Statistics: areas, bounding boxes and centroids.
+        std::vector<uint32_t> areas(num_ref, 0), xmin(num_ref, w), xmax(num_ref, 0);
+        std::vector<double> cx(num_ref, 0.0);
+        for(int i = 0 ; i < w * h ; ++i) {
+            const int l = labels_ref[i] - 1;
+            if(l >= 0) {
+                areas[l]++;
+                xmin[l] = std::min(xmin[l], uint32_t(i % w));
+                xmax[l] = std::max(xmax[l], uint32_t(i % w));
+                cx[l] += i % w;
+            }
+        }
+        for(int l = 0 ; l < num_ref ; ++l) {
+            CHECK_EQ(components.areas[l], areas[l]) << "Component area differ: " << l;
+            CHECK_EQ(components.xmin[l], xmin[l]) << "Component xmin differ: " << l;
+            CHECK_EQ(components.xmax[l], xmax[l]) << "Component xmax differ: " << l;
+            CHECK_LT(std::abs(components.cx[l] - cx[l] / areas[l]), 1e-6) << "Centroid differ: " << l;
+        }
+    }
+    // Timings...
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+        cpu_connected_components(mask.data(), nullptr, labels.data(), parents.data(),
+            w, h, true, FLAGS_num_strips, components);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::cout << "Connected components " << h << "x" << w
+        << " | #components: " << components.size() << std::endl;
+    std::cout << "  cpu_connected_components: "
+        << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+        << " ms" << std::endl;
+    return 0;
+}
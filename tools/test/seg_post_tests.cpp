@@ -0,0 +1,203 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <tensor.h>
+#include <cuda/cudaSegmentation.h>
+#include <cpu/cpuSegmentation.h>
+
+DEFINE_int32(height, 225, "Segmentation output height.");
+DEFINE_int32(width, 385, "Segmentation output width.");
+DEFINE_int32(num_classes, 18, "Number of classes.");
+DEFINE_int32(num_random, 100, "Number of random homographies.");
+DEFINE_int32(iterations, 100, "Number of timing iterations.");
+DEFINE_double(threshold, 0.5, "Detection threshold.");
+
+/* ============================================================================
+ * Homographies fixtures. Row-major 3x3, transposed to OpenVX column-major.
+ * ========================================================================== */
+typedef std::array<float, 9>  matrix33;
+
+matrix33 column_major(const matrix33& m)
+{
+    return matrix33{{m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8]}};
+}
+std::vector<std::pair<std::string, matrix33> > homographies(int num_random)
+{
+    std::vector<std::pair<std::string, matrix33> > hs;
+    hs.push_back({"identity", matrix33{{1, 0, 0,  0, 1, 0,  0, 0, 1}}});
+    hs.push_back({"translation", matrix33{{1, 0, 3.3f,  0, 1, -7.1f,  0, 0, 1}}});
+    hs.push_back({"rotation", matrix33{{0.9986f, -0.0523f, 5.2f,  0.0523f, 0.9986f, -4.7f,  0, 0, 1}}});
+    hs.push_back({"perspective", matrix33{{0.99f, -0.05f, 4.2f,  0.05f, 0.99f, -3.7f,  1e-5f, 2e-5f, 1}}});
+    // Random small stabilization-like homographies.
+    std::mt19937 gen(42);
+    std::normal_distribution<float> n(0.0f, 0.02f);
+    for(int i = 0 ; i < num_random ; ++i) {
+        hs.push_back({"random", matrix33{{
+            1 + n(gen), n(gen), 200 * n(gen),
+            n(gen), 1 + n(gen), 200 * n(gen),
+            1e-3f * n(gen), 1e-3f * n(gen), 1 + 0.1f * n(gen)}}});
+    }
+    return hs;
+}
+
+/* ============================================================================
+ * CUDA vs CPU post-processing: outputs must be bitwise identical.
+ * Temporal fusion: identical up to FMA contraction on the GPU.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const int h = FLAGS_height;
+    const int w = FLAGS_width;
+    const int c = FLAGS_num_classes;
+    // Mapped memory tensors, shared by CUDA and CPU.
+    tfrt::cuda_tensor prob{"prob", {1, c, h, w}};
+    tfrt::cuda_tensor matrix{"matrix", {1, 1, 3, 3}};
+    tfrt::cuda_tensor_u8 classes_cuda{"classes_cuda", {1, 1, h, w}};
+    tfrt::cuda_tensor scores_cuda{"scores_cuda", {1, 1, h, w}};
+    CHECK(prob.allocate() && matrix.allocate());
+    CHECK(classes_cuda.allocate() && scores_cuda.allocate());
+    std::vector<uint8_t> classes_cpu(h * w);
+    std::vector<float> scores_cpu(h * w);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for(int i = 0 ; i < c * h * w ; ++i) {
+        prob.cpu[i] = dist(gen);
+    }
+    int num_errors = 0;
+    auto check_post_process = [&](const std::string& fixture, int num_random) {
+        for(auto&& hm : homographies(num_random)) {
+            const matrix33 m = column_major(hm.second);
+            std::memcpy(matrix.cpu, m.data(), sizeof(float) * 9);
+            for(bool empty_class : {false, true}) {
+                CUDA(cuda_seg_post_process(prob.cuda, classes_cuda.cuda, scores_cuda.cuda,
+                    matrix.cuda, w, h, c, empty_class, FLAGS_threshold));
+                CUDA(cudaDeviceSynchronize());
+                CHECK(cpu_seg_post_process(prob.cpu, classes_cpu.data(), scores_cpu.data(),
+                    matrix.cpu, w, h, c, empty_class, FLAGS_threshold));
+                // Bitwise comparison.
+                int mismatches = 0;
+                for(int i = 0 ; i < h * w ; ++i) {
+                    if(classes_cpu[i] != classes_cuda.cpu[i] ||
+                        std::memcmp(&scores_cpu[i], &scores_cuda.cpu[i], sizeof(float))) {
+                        mismatches++;
+                    }
+                }
+                if(mismatches) {
+                    LOG(ERROR) << "Mismatch on " << fixture << " probabilities with homography '"
+                        << hm.first << "' (empty class: " << empty_class << "): "
+                        << mismatches << " pixels.";
+                    num_errors++;
+                }
+            }
+        }
+    };
+    check_post_process("random", FLAGS_num_random);
+
+    // Ties and NaN: first maximum kept, NaN ignored, as in the CUDA kernel.
+    std::vector<float> prob_random(prob.cpu, prob.cpu + c * h * w);
+    std::uniform_int_distribution<int> level(0, 4);
+    std::bernoulli_distribution is_nan(0.01);
+    for(int i = 0 ; i < c * h * w ; ++i) {
+        prob.cpu[i] = is_nan(gen) ? NAN : 0.25f * level(gen);
+    }
+    check_post_process("ties", 4);
+    // Host reference on the identity homography.
+    const matrix33 identity = column_major(homographies(0)[0].second);
+    std::memcpy(matrix.cpu, identity.data(), sizeof(float) * 9);
+    CHECK(cpu_seg_post_process(prob.cpu, classes_cpu.data(), scores_cpu.data(), matrix.cpu,
+        w, h, c, true, FLAGS_threshold));
+    int tie_errors = 0;
+    for(int i = 0 ; i < h * w ; ++i) {
+        int max_idx = 0;
+        float max_score = 0.0f;
+        for(int k = 0 ; k < c ; ++k) {
+            if(prob.cpu[k * h * w + i] > max_score) {
+                max_idx = k;
+                max_score = prob.cpu[k * h * w + i];
+            }
+        }
+        const uint8_t cls = max_score > FLAGS_threshold ? max_idx : 0;
+        if(classes_cpu[i] != cls || scores_cpu[i] != max_score) {
+            tie_errors++;
+        }
+    }
+    if(tie_errors) {
+        LOG(ERROR) << "Ties / NaN not resolved as the first maximum: " << tie_errors << " pixels.";
+        num_errors++;
+    }
+    std::copy(prob_random.begin(), prob_random.end(), prob.cpu);
+    // Temporal fusion: CUDA vs CPU, up to FMA rounding.
+    tfrt::cuda_tensor prev{"prev", {1, c, h, w}};
+    tfrt::cuda_tensor fused_cuda{"fused_cuda", {1, c, h, w}};
+    CHECK(prev.allocate() && fused_cuda.allocate());
+    std::vector<float> fused_cpu(c * h * w);
+    for(int i = 0 ; i < c * h * w ; ++i) {
+        prev.cpu[i] = dist(gen);
+    }
+    for(auto&& hm : homographies(FLAGS_num_random)) {
+        const matrix33 m = column_major(hm.second);
+        std::memcpy(matrix.cpu, m.data(), sizeof(float) * 9);
+        for(bool prediction : {false, true}) {
+            float* raw_cuda = prediction ? nullptr : prob.cuda;
+            float* raw_cpu = prediction ? nullptr : prob.cpu;
+            CUDA(cuda_seg_fusion(raw_cuda, prev.cuda, fused_cuda.cuda, matrix.cuda, w, h, c, 0.3f));
+            CUDA(cudaDeviceSynchronize());
+            CHECK(cpu_seg_fusion(raw_cpu, prev.cpu, fused_cpu.data(), matrix.cpu, w, h, c, 0.3f));
+            int mismatches = 0;
+            for(int i = 0 ; i < c * h * w ; ++i) {
+                if(std::abs(fused_cpu[i] - fused_cuda.cpu[i]) > 1e-6f) {
+                    mismatches++;
+                }
+            }
+            if(mismatches) {
+                LOG(ERROR) << "Fusion mismatch with homography '" << hm.first
+                    << "' (prediction: " << prediction << "): " << mismatches << " values.";
+                num_errors++;
+            }
+        }
+    }
+
+    // Timings, on the last homography.
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+        cpu_seg_post_process(prob.cpu, classes_cpu.data(), scores_cpu.data(), matrix.cpu,
+            w, h, c, false, FLAGS_threshold);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::cout << "Segmentation post-processing " << c << "x" << h << "x" << w
+        << " | CPU: " << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+        << " ms" << std::endl;
+    if(num_errors) {
+        LOG(ERROR) << "CUDA and CPU implementations differ: " << num_errors << " failed cases.";
+        return 1;
+    }
+    std::cout << "CUDA and CPU post-processing and fusion are consistent." << std::endl;
+    return 0;
+}
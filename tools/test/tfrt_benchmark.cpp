@@ -14,9 +14,11 @@
 # =========================================================================== */
 #include <fstream>
 #include <iostream>
-#include <sys/stat.h>
-#include <time.h>
+#include <sstream>
+#include <algorithm>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 #include <glog/logging.h>
 #include <gflags/gflags.h>
@@ -41,20 +43,26 @@ using namespace nvinfer1;
 }
 
 // FLAGS...
-DEFINE_string(network, "ssd_inception2_v0", "SSD network network to test.");
+DEFINE_string(network, "ssd_inception2_v0", "Network to benchmark (nets_factory name).");
 DEFINE_string(network_pb, "", "Network protobuf parameter file.");
-DEFINE_int32(batch_size, 2, "Batch size.");
+DEFINE_string(batch_sizes, "2", "Batch sizes to sweep, comma separated (e.g. 1,2,4).");
+DEFINE_string(shapes, "224x224", "Input shapes HxW to sweep, comma separated (e.g. 224x224,300x300).");
+DEFINE_string(modes, "sync,async,multistream", "Execution modes, comma separated: sync, async, multistream.");
+DEFINE_int32(num_streams, 2, "Number of CUDA streams / contexts in multistream mode.");
+DEFINE_int32(warmup, 10, "Warmup iterations, excluded from timings.");
+DEFINE_int32(iterations, 200, "Timed iterations per configuration.");
 DEFINE_int32(workspace, 16, "Workspace size in MB.");
-DEFINE_int32(height, 224, "Input height.");
-DEFINE_int32(width, 224, "Input height.");
+DEFINE_int32(device, 0, "CUDA device.");
 
 DEFINE_bool(debug, false, "TensorRT debug mode.");
 DEFINE_bool(verbose, false, "TensorRT verbose mode.");
-
-// static const int BATCH_SIZE = 2;
-static const int TIMING_ITERATIONS = 1000;
-std::string  INPUT_BLOB_NAME;
-std::string  OUTPUT_BLOB_NAME;
+DEFINE_bool(layers_log, false, "Log the construction of every layer.");
+DEFINE_string(results_json, "", "Export benchmark results in JSON file.");
+DEFINE_string(results_csv, "", "Export benchmark results in CSV file.");
+DEFINE_bool(profile, false, "Additional profiled sync run per configuration (layers timings aggregated over all configurations).");
+DEFINE_string(profile_json, "", "Export layers profiling in JSON file.");
+DEFINE_string(profile_csv, "", "Export layers profiling in CSV file.");
+DEFINE_string(memory_json, "", "Export memory accounting (live / peak bytes) in JSON file.");
 
 
 // Logger for GIE info/warning/errors
@@ -68,76 +76,84 @@ class Logger : public ILogger
     }
 } gLogger;
 
-struct Profiler : public IProfiler
-{
-    typedef std::pair<std::string, float> Record;
-    std::vector<Record> mProfile;
-
-    virtual void reportLayerTime(const char* layerName, float ms)
-    {
-        auto record = std::find_if(mProfile.begin(), mProfile.end(), [&](const Record& r){ return r.first == layerName; });
-        if (record == mProfile.end())
-            mProfile.push_back(std::make_pair(layerName, ms));
-        else
-            record->second += ms;
-    }
-
-    void printLayerTimes()
-    {
-        float totalTime = 0;
-        for (size_t i = 0; i < mProfile.size(); i++)
-        {
-            printf("%-150.200s %4.3fms\n", mProfile[i].first.c_str(),
-                mProfile[i].second / TIMING_ITERATIONS);
-            totalTime += mProfile[i].second;
-        }
-        printf("Time over all layers: %4.3f\n", totalTime / TIMING_ITERATIONS);
-    }
-
-} gProfiler;
+tfrt::profiler gProfiler;
 
 /* ============================================================================
- * Static collection of nets.
+ * Benchmark configuration and results.
  * ========================================================================== */
-// std::unique_ptr<tfrt::network>&& networks_map(const std::string& key)
-// {
-//     static std::map<std::string, std::unique_ptr<tfrt::network> > nets;
-//     // Fill the map at first call!
-//     if(nets.empty()) {
-//         nets["inception1"] = std::make_unique<inception1::net>();
-//         nets["inception2"] = std::make_unique<inception2::net>();
-//         nets["ssd_inception2_v0"] = std::make_unique<ssd_inception2_v0::net>();
-//         nets["seg_inception2_v1"] = std::make_unique<seg_inception2_v1::net>();
-//         nets["seg_inception2_v1_5x5"] = std::make_unique<seg_inception2_v1_5x5::net>();
-//         nets["seg_inception2_logits_v1"] = std::make_unique<seg_inception2_logits_v1::net>();
-//         nets["seg_inception2_2x2"] = std::make_unique<seg_inception2_2x2::net>();
-//     }
-//     return std::move(nets.at(key));
-// }
+/** Result of a benchmark configuration. Latencies in ms, throughput in images/s. */
+struct bench_result
+{
+    std::string  mode;
+    int  batch_size;
+    int  height;
+    int  width;
+    int  num_streams;
+    int  iterations;
+    double  throughput;
+    double  mean;
+    double  p50;
+    double  p95;
+    double  p99;
+    double  max;
+};
+
+/** Split a comma separated list. */
+std::vector<std::string> split_list(const std::string& s)
+{
+    std::vector<std::string> v;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.length()) {
+            v.push_back(item);
+        }
+    }
+    return v;
+}
+std::vector<int> parse_batch_sizes(const std::string& s)
+{
+    std::vector<int> v;
+    for (auto&& item : split_list(s)) {
+        v.push_back(std::stoi(item));
+        CHECK_GT(v.back(), 0) << "Invalid batch size: " << item;
+    }
+    CHECK(!v.empty()) << "No batch size to benchmark.";
+    return v;
+}
+std::vector<std::pair<int, int> > parse_shapes(const std::string& s)
+{
+    std::vector<std::pair<int, int> > v;
+    for (auto&& item : split_list(s)) {
+        int h = 0, w = 0;
+        CHECK_EQ(sscanf(item.c_str(), "%dx%d", &h, &w), 2) << "Invalid input shape: " << item;
+        CHECK(h > 0 && w > 0) << "Invalid input shape: " << item;
+        v.push_back(std::make_pair(h, w));
+    }
+    CHECK(!v.empty()) << "No input shape to benchmark.";
+    return v;
+}
 
 /* ============================================================================
- * Build + inference.
+ * Build engine.
  * ========================================================================== */
-ICudaEngine* tfrt_to_gie_model()
+/** Build a TensorRT engine from a TF-RT network, for a given input shape and
+ * maximum batch size. Weights are kept in the network for the next builds.
+ */
+ICudaEngine* tfrt_to_gie_model(tfrt::network* tf_network, int height, int width, int max_batch_size)
 {
     // Builder + network.
     IBuilder* builder = createInferBuilder(gLogger);
     INetworkDefinition* network = builder->createNetwork();
 
     // Build TF-RT network.
-    auto tf_network = tfrt::nets_factory(FLAGS_network);
-    tf_network->create_missing_tensors(true);
-    tf_network->load_weights(FLAGS_network_pb);
-    tf_network->input_shape({3, FLAGS_height, FLAGS_width});
+    tf_network->input_shape({3, height, width});
     tfrt::scope sc = tf_network->scope(network);
     tf_network->build(sc);
-    // Input and output information.
-    INPUT_BLOB_NAME = {tf_network->input_name(true)};
-    OUTPUT_BLOB_NAME = tf_network->outputs_name(true, true).at(0);
 
     // Build the engine
-    builder->setMaxBatchSize(FLAGS_batch_size);
-    builder->setMaxWorkspaceSize(FLAGS_workspace << 20);
+    builder->setMaxBatchSize(max_batch_size);
+    builder->setMaxWorkspaceSize(size_t(FLAGS_workspace) << 20);
     // Set up the floating mode.
     bool compatibleType = (tf_network->datatype() == nvinfer1::DataType::kFLOAT ||
                             builder->platformHasFastFp16());
@@ -149,114 +165,336 @@ ICudaEngine* tfrt_to_gie_model()
     builder->setHalf2Mode(useFP16);
 
     ICudaEngine* engine = builder->buildCudaEngine(*network);
-    if (engine == nullptr) {
-        std::cout << "Could not build engine" << std::endl;
-    }
+    CHECK(engine) << "Could not build engine with input shape: " << height << "x" << width;
     network->destroy();
     builder->destroy();
-    tf_network->clear_weights();
     return engine;
 }
-void model_serialized(IHostMemory*& gieModelStream)
+/** Engine size, estimated by its serialized size (weights + kernels). */
+uint64_t tfrt_engine_size(ICudaEngine* engine)
 {
-    auto engine = tfrt_to_gie_model();
-    // serialize the engine.
-    // TensorRT 1
-    #ifndef NV_TENSORRT_MAJOR
-    engine->serialize(*gieModelStream);
-    // TensorRT 2
-    #else
-    gieModelStream = engine->serialize();
-    #endif
-    engine->destroy();
+    IHostMemory* model_stream = engine->serialize();
+    const uint64_t size = model_stream ? model_stream->size() : 0;
+    if (model_stream) {
+        model_stream->destroy();
+    }
+    return size;
 }
 
-void timeInference(ICudaEngine* engine, int batchSize)
+/* ============================================================================
+ * Execution contexts and bindings.
+ * ========================================================================== */
+/** Size in bytes of a binding element. */
+size_t binding_elt_size(nvinfer1::DataType dt)
 {
-    // input and output buffer pointers that we pass to the engine - the engine requires exactly ICudaEngine::getNbBindings(),
-    // of these, but in this case we know that there is exactly one input and one output.
-    assert(engine->getNbBindings() == 2);
-    void* buffers[2];
-
-    // In order to bind the buffers, we need to know the names of the input and output tensors.
-    // note that indices are guaranteed to be less than ICudaEngine::getNbBindings()
-    int inputIndex = engine->getBindingIndex(INPUT_BLOB_NAME.c_str());
-    int outputIndex = engine->getBindingIndex(OUTPUT_BLOB_NAME.c_str());
-
-    // allocate GPU buffers
-    DimsCHW inputDims = static_cast<DimsCHW&&>(engine->getBindingDimensions(inputIndex));
-    DimsCHW outputDims = static_cast<DimsCHW&&>(engine->getBindingDimensions(outputIndex));
-    size_t inputSize = batchSize * inputDims.c() * inputDims.h() * inputDims.w() * sizeof(float);
-    size_t outputSize = batchSize * outputDims.c() * outputDims.h() * outputDims.w() * sizeof(float);
+    switch (dt) {
+        case nvinfer1::DataType::kHALF:
+            return 2;
+        case nvinfer1::DataType::kINT8:
+            return 1;
+        default:
+            return 4;
+    }
+}
+/** Execution context with its own CUDA stream and buffers for all bindings
+ * (any number of inputs and outputs).
+ */
+struct bench_context
+{
+    IExecutionContext*  context;
+    cudaStream_t  stream;
+    std::vector<void*>  buffers;
 
-    std::cout << "Input index: " << inputIndex
-        << " of size: " << inputSize
-        << " and shape: " << tfrt::dims_str(inputDims)
-        << std::endl;
-    std::cout << "Output index: " << outputIndex
-        << " of size: " << outputSize
-        << " and shape: " << tfrt::dims_str(outputDims)
-        << std::endl;
-    CHECK_CUDA(cudaMalloc(&buffers[inputIndex], inputSize));
-    CHECK_CUDA(cudaMalloc(&buffers[outputIndex], outputSize));
+    bench_context(ICudaEngine* engine, int max_batch_size) :
+        context{engine->createExecutionContext()}, stream{nullptr},
+        buffers(engine->getNbBindings(), nullptr)
+    {
+        CHECK(context) << "Could not create TensorRT execution context.";
+        context->setDebugSync(FLAGS_debug);
+        CHECK_CUDA(cudaStreamCreate(&stream));
+        for (int i = 0; i < engine->getNbBindings(); ++i) {
+            const Dims dims = engine->getBindingDimensions(i);
+            size_t size = max_batch_size * binding_elt_size(engine->getBindingDataType(i));
+            for (int k = 0; k < dims.nbDims; ++k) {
+                size *= dims.d[k];
+            }
+            CHECK_CUDA(cudaMalloc(&buffers[i], size));
+            CHECK_CUDA(cudaMemset(buffers[i], 0, size));
+            tfrt::memory_tracker::global().allocate(buffers[i], size,
+                tfrt::memory_tracker::kTensor, engine->getBindingName(i));
+        }
+        tfrt::memory_tracker::global().allocate(context, FLAGS_workspace << 20,
+            tfrt::memory_tracker::kWorkspace, "context");
+    }
+    ~bench_context()
+    {
+        for (auto b : buffers) {
+            tfrt::memory_tracker::global().release(b);
+            cudaFree(b);
+        }
+        cudaStreamDestroy(stream);
+        tfrt::memory_tracker::global().release(context);
+        context->destroy();
+    }
+};
 
-    // CUDA executation context + profiler and debug mode.
-    IExecutionContext* context = engine->createExecutionContext();
-    context->setProfiler(&gProfiler);
-    context->setDebugSync(FLAGS_debug);
+/** Latency statistics and throughput of a run. */
+bench_result make_result(const std::string& mode, int batch_size, int height, int width,
+    int num_streams, const tfrt::histogram& hist, double wall_ms)
+{
+    bench_result r;
+    r.mode = mode;
+    r.batch_size = batch_size;
+    r.height = height;
+    r.width = width;
+    r.num_streams = num_streams;
+    r.iterations = int(hist.count());
+    r.throughput = wall_ms > 0 ? hist.count() * batch_size / (wall_ms * 1e-3) : 0.0;
+    r.mean = hist.mean() * 1e-6;
+    r.p50 = hist.percentile(50.0) * 1e-6;
+    r.p95 = hist.percentile(95.0) * 1e-6;
+    r.p99 = hist.percentile(99.0) * 1e-6;
+    r.max = hist.max() * 1e-6;
+    return r;
+}
+double elapsed_ms(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
 
-    // Zero the input buffer
-    CHECK_CUDA(cudaMemset(buffers[inputIndex], 0, inputSize));
-    for (int i = 0; i < TIMING_ITERATIONS;i++) {
-        context->execute(batchSize, buffers);
+/* ============================================================================
+ * Benchmark modes.
+ * ========================================================================== */
+/** Synchronous execution: host latency of every execute call. */
+bench_result bench_sync(bench_context& ctx, int batch_size, int height, int width)
+{
+    for (int i = 0; i < FLAGS_warmup; ++i) {
+        ctx.context->execute(batch_size, ctx.buffers.data());
+    }
+    tfrt::histogram hist;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+        auto t_start = std::chrono::steady_clock::now();
+        ctx.context->execute(batch_size, ctx.buffers.data());
+        hist.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t_start).count());
     }
-    // Release the context and buffers
-    context->destroy();
-    CHECK_CUDA(cudaFree(buffers[inputIndex]));
-    CHECK_CUDA(cudaFree(buffers[outputIndex]));
+    return make_result("sync", batch_size, height, width, 1, hist, elapsed_ms(t0));
+}
+/** Asynchronous execution on the first contexts / streams: inferences are
+ * enqueued back to back (round robin on contexts), GPU latency measured with events.
+ */
+bench_result bench_async(std::vector<std::unique_ptr<bench_context> >& ctxs, size_t nctxs,
+    int batch_size, int height, int width)
+{
+    CHECK_LE(nctxs, ctxs.size()) << "Not enough execution contexts.";
+    const int niters = FLAGS_iterations;
+    // Warmup.
+    for (int i = 0; i < FLAGS_warmup; ++i) {
+        auto& ctx = *ctxs[i % nctxs];
+        ctx.context->enqueue(batch_size, ctx.buffers.data(), ctx.stream, nullptr);
+    }
+    CHECK_CUDA(cudaDeviceSynchronize());
+    // Events pairs around every inference.
+    std::vector<cudaEvent_t> events(2 * niters);
+    for (auto& e : events) {
+        CHECK_CUDA(cudaEventCreate(&e));
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < niters; ++i) {
+        auto& ctx = *ctxs[i % nctxs];
+        CHECK_CUDA(cudaEventRecord(events[2*i], ctx.stream));
+        ctx.context->enqueue(batch_size, ctx.buffers.data(), ctx.stream, nullptr);
+        CHECK_CUDA(cudaEventRecord(events[2*i+1], ctx.stream));
+    }
+    CHECK_CUDA(cudaDeviceSynchronize());
+    const double wall_ms = elapsed_ms(t0);
+    tfrt::histogram hist;
+    for (int i = 0; i < niters; ++i) {
+        float ms = 0.0f;
+        CHECK_CUDA(cudaEventElapsedTime(&ms, events[2*i], events[2*i+1]));
+        hist.record(uint64_t(double(ms) * 1e6 + 0.5));
+    }
+    for (auto& e : events) {
+        cudaEventDestroy(e);
+    }
+    return make_result(nctxs > 1 ? "multistream" : "async", batch_size, height, width,
+        int(nctxs), hist, wall_ms);
+}
+/** Profiled synchronous run: layers timings aggregated in the global profiler. */
+void profile_sync(bench_context& ctx, int batch_size)
+{
+    ctx.context->setProfiler(&gProfiler);
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+        ctx.context->execute(batch_size, ctx.buffers.data());
+    }
+    gProfiler.end_run();
+    ctx.context->setProfiler(nullptr);
 }
 
+/* ============================================================================
+ * Results export.
+ * ========================================================================== */
+void print_results(std::ostream& out, const std::vector<bench_result>& results)
+{
+    char buf[512];
+    snprintf(buf, sizeof(buf), "%-12s %6s %10s %8s %7s %12s %9s %9s %9s %9s %9s\n",
+        "mode", "batch", "shape", "streams", "iters", "img/s", "mean", "p50", "p95", "p99", "max");
+    out << buf;
+    for (auto&& r : results) {
+        const std::string shape = std::to_string(r.height) + "x" + std::to_string(r.width);
+        snprintf(buf, sizeof(buf), "%-12s %6d %10s %8d %7d %12.2f %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+            r.mode.c_str(), r.batch_size, shape.c_str(), r.num_streams, r.iterations,
+            r.throughput, r.mean, r.p50, r.p95, r.p99, r.max);
+        out << buf;
+    }
+}
+bool save_results_json(const std::string& filename, const std::string& device,
+    const std::vector<bench_result>& results)
+{
+    std::ofstream file(filename);
+    if (!file) {
+        LOG(ERROR) << "Could not open benchmark JSON file: " << filename;
+        return false;
+    }
+    char buf[512];
+    file << "{\n  \"network\": \"" << FLAGS_network << "\",\n"
+         << "  \"device\": \"" << device << "\",\n"
+         << "  \"warmup\": " << FLAGS_warmup << ",\n"
+         << "  \"unit\": \"ms\",\n"
+         << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        snprintf(buf, sizeof(buf),
+            "{\"mode\": \"%s\", \"batch_size\": %d, \"height\": %d, \"width\": %d, "
+            "\"num_streams\": %d, \"iterations\": %d, \"throughput\": %.3f, "
+            "\"mean\": %.6f, \"p50\": %.6f, \"p95\": %.6f, \"p99\": %.6f, \"max\": %.6f}",
+            r.mode.c_str(), r.batch_size, r.height, r.width, r.num_streams, r.iterations,
+            r.throughput, r.mean, r.p50, r.p95, r.p99, r.max);
+        file << (i ? ",\n    " : "\n    ") << buf;
+    }
+    file << "\n  ]\n}\n";
+    return bool(file);
+}
+bool save_results_csv(const std::string& filename, const std::vector<bench_result>& results)
+{
+    std::ofstream file(filename);
+    if (!file) {
+        LOG(ERROR) << "Could not open benchmark CSV file: " << filename;
+        return false;
+    }
+    char buf[512];
+    file << "network,mode,batch_size,height,width,num_streams,iterations,"
+         << "throughput,mean_ms,p50_ms,p95_ms,p99_ms,max_ms\n";
+    for (auto&& r : results) {
+        snprintf(buf, sizeof(buf), "%s,%d,%d,%d,%d,%d,%.3f,%.6f,%.6f,%.6f,%.6f,%.6f",
+            r.mode.c_str(), r.batch_size, r.height, r.width, r.num_streams, r.iterations,
+            r.throughput, r.mean, r.p50, r.p95, r.p99, r.max);
+        file << FLAGS_network << "," << buf << "\n";
+    }
+    return bool(file);
+}
 
+/* ============================================================================
+ * Main.
+ * ========================================================================== */
 int main(int argc, char** argv)
 {
     google::InitGoogleLogging(argv[0]);
     gflags::ParseCommandLineFlags(&argc, &argv, true);
 
-    std::cout << "Building and running a GPU inference engine N=2..." << std::endl;
+    CHECK_CUDA(cudaSetDevice(FLAGS_device));
+    cudaDeviceProp prop;
+    CHECK_CUDA(cudaGetDeviceProperties(&prop, FLAGS_device));
+    CHECK_GT(FLAGS_iterations, 0) << "Invalid number of iterations.";
+    CHECK_GE(FLAGS_warmup, 0) << "Invalid number of warmup iterations.";
+    CHECK_GT(FLAGS_num_streams, 0) << "Invalid number of streams.";
+
+    const auto batch_sizes = parse_batch_sizes(FLAGS_batch_sizes);
+    const auto shapes = parse_shapes(FLAGS_shapes);
+    const auto modes = split_list(FLAGS_modes);
+    const int max_batch_size = *std::max_element(batch_sizes.begin(), batch_sizes.end());
+    for (auto&& m : modes) {
+        CHECK(m == "sync" || m == "async" || m == "multistream") << "Unknown benchmark mode: " << m;
+    }
 
-    // Parse the model file.
-    #ifndef NV_TENSORRT_MAJOR
-    nvinfer1::IHostMemory  gieModelStream;
-    gieModelStream.seekg(0, gieModelStream.beg);
-    auto pgieModelStream = &gieModelStream;
-    model_serialized(pgieModelStream);
-    #else
-    IHostMemory* gieModelStream{nullptr};
-    model_serialized(gieModelStream);
-    #endif
+    // Network loaded once, engine built for every input shape.
+    tfrt::layers_logging(FLAGS_layers_log);
+    tfrt::memory_owner memory_owner{FLAGS_network};
+    auto tf_network = tfrt::nets_factory(FLAGS_network);
+    CHECK(tf_network) << "Unknown network: " << FLAGS_network;
+    tf_network->create_missing_tensors(true);
+    tf_network->load_weights(FLAGS_network_pb);
 
-    // Create an engine
-    IRuntime* infer = createInferRuntime(gLogger);
-    #ifndef NV_TENSORRT_MAJOR
-    nvinfer1::ICudaEngine* engine = infer->deserializeCudaEngine(gieModelStream);
-    #else
-    ICudaEngine* engine = infer->deserializeCudaEngine(gieModelStream->data(),
-        gieModelStream->size(), nullptr);
-    #endif
+    std::vector<bench_result> results;
+    for (auto&& shape : shapes) {
+        const int height = shape.first;
+        const int width = shape.second;
+        LOG(INFO) << "Building engine with input shape " << height << "x" << width
+            << " and max batch size " << max_batch_size;
+        ICudaEngine* engine = tfrt_to_gie_model(tf_network.get(), height, width, max_batch_size);
+        tfrt::memory_tracker::global().allocate(engine, tfrt_engine_size(engine),
+            tfrt::memory_tracker::kEngine, "engine");
+        for (int bi = 0; bi < engine->getNbBindings(); bi++) {
+            LOG(INFO) << "Binding " << bi << " (" << engine->getBindingName(bi) << "): "
+                << (engine->bindingIsInput(bi) ? "Input" : "Output") << " with shape "
+                << tfrt::dims_str(engine->getBindingDimensions(bi));
+        }
+        // Contexts: first one shared by sync and async modes.
+        std::vector<std::unique_ptr<bench_context> > ctxs;
+        ctxs.emplace_back(new bench_context(engine, max_batch_size));
+        for (int batch_size : batch_sizes) {
+            for (auto&& mode : modes) {
+                if (mode == "sync") {
+                    results.push_back(bench_sync(*ctxs[0], batch_size, height, width));
+                }
+                else if (mode == "async") {
+                    results.push_back(bench_async(ctxs, 1, batch_size, height, width));
+                }
+                else if (mode == "multistream") {
+                    while (ctxs.size() < size_t(FLAGS_num_streams)) {
+                        ctxs.emplace_back(new bench_context(engine, max_batch_size));
+                    }
+                    results.push_back(bench_async(ctxs, ctxs.size(), batch_size, height, width));
+                }
+                const auto& r = results.back();
+                LOG(INFO) << "Benchmark " << r.mode << " | batch " << batch_size
+                    << " | shape " << height << "x" << width << ": "
+                    << r.throughput << " img/s, p50 " << r.p50 << " ms, p99 " << r.p99 << " ms.";
+            }
+            if (FLAGS_profile) {
+                profile_sync(*ctxs[0], batch_size);
+            }
+        }
+        ctxs.clear();
+        tfrt::memory_tracker::global().release(engine);
+        engine->destroy();
+    }
+    tf_network->clear_weights();
 
-    printf("Bindings after deserializing:\n");
-    for (int bi = 0; bi < engine->getNbBindings(); bi++) {
-        if (engine->bindingIsInput(bi) == true) {
-            printf("Binding %d (%s): Input.\n",  bi, engine->getBindingName(bi));
-        } else {
-            printf("Binding %d (%s): Output.\n", bi, engine->getBindingName(bi));
+    // Results and profiling exports.
+    std::cout << "Benchmark of network " << FLAGS_network << " on " << prop.name
+        << " (warmup: " << FLAGS_warmup << " iterations)." << std::endl;
+    print_results(std::cout, results);
+    if (FLAGS_results_json.length()) {
+        save_results_json(FLAGS_results_json, prop.name, results);
+    }
+    if (FLAGS_results_csv.length()) {
+        save_results_csv(FLAGS_results_csv, results);
+    }
+    if (FLAGS_profile) {
+        gProfiler.print(std::cout);
+        if (FLAGS_profile_json.length()) {
+            gProfiler.save_json(FLAGS_profile_json);
         }
+        if (FLAGS_profile_csv.length()) {
+            gProfiler.save_csv(FLAGS_profile_csv);
+        }
+    }
+    tfrt::memory_tracker::global().print(std::cout);
+    if (FLAGS_memory_json.length()) {
+        tfrt::memory_tracker::global().save_json(FLAGS_memory_json);
     }
-    // run inference with null data to time network performance
-    timeInference(engine, FLAGS_batch_size);
-    engine->destroy();
-    infer->destroy();
-    gProfiler.printLayerTimes();
     std::cout << "Done." << std::endl;
     return 0;
 }
@@ -0,0 +1,211 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <boxes2d/boxes2d.h>
+#include <boxes2d/ssd.h>
+#include <cpu/cpuSegmentation.h>
+#include <misc/tiling.h>
+
+DEFINE_int32(height, 1080, "Frame height.");
+DEFINE_int32(width, 1920, "Frame width.");
+DEFINE_int32(tiles_x, 3, "Number of tiles along x.");
+DEFINE_int32(tiles_y, 2, "Number of tiles along y.");
+DEFINE_double(overlap, 0.25, "Tiles overlap (fraction of the tile size).");
+DEFINE_int32(out_height, 225, "Tile output height (segmentation).");
+DEFINE_int32(out_width, 400, "Tile output width (segmentation).");
+DEFINE_int32(num_classes, 18, "Number of segmentation classes.");
+DEFINE_int32(iterations, 20, "Number of timing iterations.");
+
+/* ============================================================================
+ * Tiled inference: grid geometry, segmentation stitching and boxes NMS.
+ * ========================================================================== */
+/** Check that the taps of an axis cover the map with weights summing to one. */
+int check_taps(const std::vector<int>& offsets, const std::vector<tfrt::tile_tap>& taps,
+    int mapsize, int ntiles, int outsize, const char* axis)
+{
+    int num_errors = 0;
+    for(int x = 0 ; x < mapsize ; ++x) {
+        float sum = 0.0f;
+        for(int k = offsets[x] ; k < offsets[x+1] ; ++k) {
+            sum += taps[k].weight;
+            if(taps[k].tile < 0 || taps[k].tile >= ntiles ||
+                taps[k].index < 0 || taps[k].index >= outsize || taps[k].weight <= 0.0f) {
+                num_errors++;
+            }
+        }
+        if(offsets[x+1] == offsets[x] || std::abs(sum - 1.0f) > 1e-5f) {
+            LOG(ERROR) << "Invalid stitching taps along " << axis << " at " << x << ": sum " << sum;
+            num_errors++;
+        }
+    }
+    return num_errors;
+}
+
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    int num_errors = 0;
+
+    // Grid geometry: tiles inside the frame, aligned on the borders.
+    const int ow = FLAGS_out_width;
+    const int oh = FLAGS_out_height;
+    const tfrt::tile_grid grid = tfrt::make_tile_grid(FLAGS_width, FLAGS_height,
+        FLAGS_tiles_x, FLAGS_tiles_y, FLAGS_overlap, ow, oh);
+    CHECK_EQ(grid.size(), size_t(FLAGS_tiles_x * FLAGS_tiles_y)) << "Invalid tiles grid.";
+    std::cout << "Tiles grid " << grid.tiles_x << "x" << grid.tiles_y << " of "
+        << grid.tile_width << "x" << grid.tile_height << " pixels, stitched map "
+        << grid.map_width << "x" << grid.map_height << std::endl;
+    for(size_t t = 0 ; t < grid.size() ; ++t) {
+        const int32_t* roi = grid.rois.data() + 4 * t;
+        if(roi[0] < 0 || roi[1] < 0 || roi[0] + roi[2] > grid.width || roi[1] + roi[3] > grid.height) {
+            LOG(ERROR) << "Tile " << t << " outside the frame.";
+            num_errors++;
+        }
+    }
+    const int32_t* last = grid.rois.data() + 4 * (grid.size() - 1);
+    if(grid.rois[0] != 0 || grid.rois[1] != 0 ||
+        last[0] + last[2] != grid.width || last[1] + last[3] != grid.height) {
+        LOG(ERROR) << "Tiles not aligned on the frame borders.";
+        num_errors++;
+    }
+    num_errors += check_taps(grid.xoffsets, grid.xtaps, grid.map_width, grid.tiles_x, ow, "x");
+    num_errors += check_taps(grid.yoffsets, grid.ytaps, grid.map_height, grid.tiles_y, oh, "y");
+
+    // Stitching: tiles sampled from a smooth frame field must give it back
+    // (up to the nearest sampling), and constant classes exactly.
+    const int nc = FLAGS_num_classes;
+    const size_t tile_size = size_t(nc) * oh * ow;
+    std::vector<float> tiles(grid.size() * tile_size);
+    auto field = [&grid](int c, float sx, float sy) {
+        return c % 2 ? 0.5f : sx / grid.width + 0.25f * sy / grid.height;
+    };
+    for(size_t t = 0 ; t < grid.size() ; ++t) {
+        const int32_t* roi = grid.rois.data() + 4 * t;
+        for(int c = 0 ; c < nc ; ++c) {
+            for(int y = 0 ; y < oh ; ++y) {
+                for(int x = 0 ; x < ow ; ++x) {
+                    const float sx = roi[0] + (x + 0.5f) * roi[2] / ow;
+                    const float sy = roi[1] + (y + 0.5f) * roi[3] / oh;
+                    tiles[t * tile_size + (size_t(c) * oh + y) * ow + x] = field(c, sx, sy);
+                }
+            }
+        }
+    }
+    std::vector<float> map(size_t(nc) * grid.map_height * grid.map_width);
+    CHECK(cpu_seg_stitch_tiles(tiles.data(), map.data(), grid, ow, oh, nc));
+    const float tol = 2.0f * (float(grid.tile_width) / ow / grid.width +
+        0.25f * float(grid.tile_height) / oh / grid.height);
+    float max_error = 0.0f;
+    for(int c = 0 ; c < nc ; ++c) {
+        for(int y = 0 ; y < grid.map_height ; ++y) {
+            for(int x = 0 ; x < grid.map_width ; ++x) {
+                const float sx = (x + 0.5f) * grid.width / grid.map_width;
+                const float sy = (y + 0.5f) * grid.height / grid.map_height;
+                const float v = map[(size_t(c) * grid.map_height + y) * grid.map_width + x];
+                const float err = std::abs(v - field(c, sx, sy));
+                max_error = std::max(max_error, err);
+                if((c % 2 && err > 1e-5f) || err > tol) {
+                    num_errors++;
+                }
+            }
+        }
+    }
+    std::cout << "Stitching max error: " << max_error << " (tolerance " << tol << ")" << std::endl;
+
+    // NMS: duplicates of overlapping tiles merged, other classes kept.
+    tfrt::boxes2d::bboxes2d bboxes{6};
+    bboxes.boxes << 0.10f, 0.10f, 0.30f, 0.30f,
+                    0.11f, 0.10f, 0.31f, 0.30f,
+                    0.10f, 0.11f, 0.30f, 0.31f,
+                    0.50f, 0.50f, 0.70f, 0.70f,
+                    0.00f, 0.00f, 0.00f, 0.00f,
+                    0.00f, 0.00f, 0.00f, 0.00f;
+    bboxes.scores << 0.9f, 0.8f, 0.7f, 0.6f, 0.0f, 0.0f;
+    bboxes.classes << 1, 1, 2, 1, 0, 0;
+    const long nkept = tfrt::boxes2d::nms(bboxes, 0.45f);
+    if(nkept != 3 || bboxes.size_notnull() != 3 || bboxes.classes[1] != 2 || bboxes.scores[2] != 0.6f) {
+        LOG(ERROR) << "Invalid NMS: " << bboxes;
+        num_errors++;
+    }
+
+    // Tiled SSD selection: the first tile saturates its budget, the single
+    // (best) detection of the last tile must survive, in frame coordinates.
+    {
+        const size_t na = 1, nc = 3, fh = 8, fw = 8, hw = fh * fw;
+        const size_t max_detections = 20;
+        std::vector<float> pred(grid.size() * na * nc * hw, 0.0f);
+        std::vector<float> raw(grid.size() * na * 4 * hw, 0.0f);
+        for(size_t t = 0 ; t < grid.size() ; ++t) {
+            for(size_t i = 0 ; i < hw ; ++i) {
+                float* p = pred.data() + t * nc * hw + i;
+                float* r = raw.data() + t * 4 * hw + i;
+                // Background, except every cell of the first tile and one of the last.
+                p[0] = 1.0f;
+                const bool first = (t == 0);
+                const bool last = (t == grid.size() - 1 && i == 3 * fw + 3);
+                if(first || last) {
+                    p[0] = 0.0f;
+                    p[(last ? 2 : 1) * hw] = last ? 0.95f : 0.9f;
+                }
+                // Small boxes centered on the cells (y, x, h, w): no overlap.
+                r[0] = (i / fw + 0.5f) / fh;
+                r[hw] = (i % fw + 0.5f) / fw;
+                r[2 * hw] = 0.05f;
+                r[3 * hw] = 0.05f;
+            }
+        }
+        const std::vector<tfrt::boxes2d::ssd_raw_outputs> outputs{
+            {pred.data(), raw.data(), na, nc, fh, fw}};
+        const tfrt::boxes2d::bboxes2d bboxes = tfrt::boxes2d::ssd_select_tiles(
+            outputs, grid, 0.5f, max_detections, 0.45f);
+        const int32_t* roi = grid.rois.data() + 4 * (grid.size() - 1);
+        const float ey = (roi[1] + 3.5f / fh * roi[3]) / grid.height;
+        const float ex = (roi[0] + 3.5f / fw * roi[2]) / grid.width;
+        const float cy = 0.5f * (bboxes.boxes(0, 0) + bboxes.boxes(0, 2));
+        const float cx = 0.5f * (bboxes.boxes(0, 1) + bboxes.boxes(0, 3));
+        if(bboxes.size() != max_detections || bboxes.size_notnull() != max_detections ||
+            bboxes.classes[0] != 2 || bboxes.scores[0] != 0.95f ||
+            std::abs(cy - ey) > 1e-5f || std::abs(cx - ex) > 1e-5f) {
+            LOG(ERROR) << "Tiled SSD selection: last tile detection lost or misplaced: " << bboxes;
+            num_errors++;
+        }
+    }
+
+    // Timings: stitching.
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+        cpu_seg_stitch_tiles(tiles.data(), map.data(), grid, ow, oh, nc);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::cout << "Stitching " << grid.size() << " tiles " << nc << "x" << oh << "x" << ow
+        << " => " << grid.map_height << "x" << grid.map_width << " | CPU: "
+        << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+        << " ms" << std::endl;
+    if(num_errors) {
+        LOG(ERROR) << "Tiled inference geometry: " << num_errors << " failed cases.";
+        return 1;
+    }
+    std::cout << "Tiled inference geometry and stitching are consistent." << std::endl;
+    return 0;
+}
@@ -0,0 +1,170 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <array>
+#include <numeric>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <random>
+#include <chrono>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <boxes2d/boxes2d.h>
+#include <boxes2d/tracker.h>
+
+DEFINE_string(detections, "", "Recorded detections file. Synthetic detections if empty.");
+DEFINE_int32(num_objects, 500, "Number of synthetic objects.");
+DEFINE_int32(num_frames, 1000, "Number of synthetic frames.");
+DEFINE_int32(max_tracks, 1024, "Size of the tracks pool.");
+DEFINE_int32(max_detections, 1024, "Maximum number of detections per frame.");
+DEFINE_double(fps, 30.0, "Camera frame rate, for synthetic time stamps.");
+
+/* ============================================================================
+ * Recorded / synthetic detections.
+ * ========================================================================== */
+typedef std::vector<tfrt::boxes2d::bboxes2d>  detections_stream;
+
+/** Load recorded detections. One detection per line, with format:
+ *    frame class score ymin xmin ymax xmax
+ * Frames are supposed to be sorted.
+ */
+detections_stream load_detections(const std::string& filename, double fps)
+{
+    std::ifstream file(filename);
+    CHECK(file) << "Could not open detections file: " << filename;
+    // First pass: group by frame.
+    std::vector<std::vector<std::array<float, 6> > > frames;
+    std::string line;
+    while(std::getline(file, line)) {
+        if(line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream iss(line);
+        size_t frame;
+        std::array<float, 6> det;
+        iss >> frame >> det[0] >> det[1] >> det[2] >> det[3] >> det[4] >> det[5];
+        if(frame >= frames.size()) {
+            frames.resize(frame+1);
+        }
+        frames[frame].push_back(det);
+    }
+    // Convert to bboxes2d collections.
+    auto t0 = tfrt::boxes2d::bboxes2d::clock::now();
+    detections_stream stream;
+    for(size_t i = 0 ; i < frames.size() ; ++i) {
+        tfrt::boxes2d::bboxes2d bboxes{frames[i].size()};
+        bboxes.time = t0 + std::chrono::microseconds(long(i * 1e6 / fps));
+        for(size_t j = 0 ; j < frames[i].size() ; ++j) {
+            bboxes.classes[j] = int(frames[i][j][0]);
+            bboxes.scores[j] = frames[i][j][1];
+            for(int k = 0 ; k < 4 ; ++k) {
+                bboxes.boxes(j, k) = frames[i][j][2+k];
+            }
+        }
+        bboxes.sort_by_score(true);
+        stream.push_back(bboxes);
+    }
+    LOG(INFO) << "Loaded detections from " << filename << " | #frames: " << stream.size();
+    return stream;
+}
+
+/** Synthetic detections: objects moving at constant speed, with noise
+ * and random missed detections.
+ */
+detections_stream synthetic_detections(int num_objects, int num_frames, double fps)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> upos(0.0f, 1.0f);
+    std::uniform_real_distribution<float> uvel(-0.002f, 0.002f);
+    std::normal_distribution<float> noise(0.0f, 0.001f);
+    std::bernoulli_distribution missed(0.05);
+
+    // Small boxes, to keep a realistic density.
+    const float size = 0.02f;
+    Eigen::ArrayXXf pos{num_objects, 2};
+    Eigen::ArrayXXf vel{num_objects, 2};
+    for(int i = 0 ; i < num_objects ; ++i) {
+        pos(i, 0) = upos(gen);  pos(i, 1) = upos(gen);
+        vel(i, 0) = uvel(gen);  vel(i, 1) = uvel(gen);
+    }
+    auto t0 = tfrt::boxes2d::bboxes2d::clock::now();
+    detections_stream stream;
+    for(int f = 0 ; f < num_frames ; ++f) {
+        tfrt::boxes2d::bboxes2d bboxes{size_t(num_objects)};
+        bboxes.time = t0 + std::chrono::microseconds(long(f * 1e6 / fps));
+        int idx = 0;
+        for(int i = 0 ; i < num_objects ; ++i) {
+            if(missed(gen)) {
+                continue;
+            }
+            const float y = pos(i, 0) + f * vel(i, 0) + noise(gen);
+            const float x = pos(i, 1) + f * vel(i, 1) + noise(gen);
+            bboxes.classes[idx] = 1 + i % 4;
+            bboxes.scores[idx] = 0.5f + 0.5f * upos(gen);
+            bboxes.boxes.row(idx) << y - size, x - size, y + size, x + size;
+            idx++;
+        }
+        bboxes.sort_by_score(true);
+        stream.push_back(bboxes);
+    }
+    LOG(INFO) << "Synthetic detections | #objects: " << num_objects << " #frames: " << num_frames;
+    return stream;
+}
+
+/* ============================================================================
+ * Replay benchmark.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    detections_stream stream;
+    if(FLAGS_detections.length()) {
+        stream = load_detections(FLAGS_detections, FLAGS_fps);
+    }
+    else {
+        stream = synthetic_detections(FLAGS_num_objects, FLAGS_num_frames, FLAGS_fps);
+    }
+    tfrt::boxes2d::tracker::parameters params;
+    params.max_tracks = FLAGS_max_tracks;
+    params.max_detections = FLAGS_max_detections;
+    tfrt::boxes2d::tracker tracker{params};
+
+    // Replay detections, timing every update.
+    std::vector<double> timings;
+    timings.reserve(stream.size());
+    size_t num_tracks = 0;
+    for(auto&& detections : stream) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        const auto& tracks = tracker.update(detections);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        timings.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        num_tracks += tracks.size_notnull();
+    }
+    std::sort(timings.begin(), timings.end());
+    double total = std::accumulate(timings.begin(), timings.end(), 0.0);
+    std::cout << "Tracker replay benchmark | #frames: " << timings.size()
+        << " | mean #tracks: " << float(num_tracks) / timings.size() << std::endl;
+    std::cout << "  mean: " << total / timings.size() << " ms"
+        << " | p50: " << timings[timings.size() / 2] << " ms"
+        << " | p99: " << timings[timings.size() * 99 / 100] << " ms"
+        << " | max: " << timings.back() << " ms" << std::endl;
+    std::cout << "Camera rate budget (" << FLAGS_fps << " fps): " << 1000.0 / FLAGS_fps << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,207 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <boxes2d/boxes2d.h>
+#include <boxes2d/operations.h>
+#include <boxes2d/tracker.h>
+
+DEFINE_int32(grid_size, 10, "Synthetic objects on a grid_size x grid_size grid.");
+DEFINE_int32(num_frames, 300, "Number of synthetic frames.");
+DEFINE_double(missed_rate, 0.05, "Probability of a missed detection.");
+DEFINE_double(fps, 30.0, "Camera frame rate, for synthetic time stamps.");
+
+/* ============================================================================
+ * Heap allocations counter: the tracker update loop must not allocate.
+ * ========================================================================== */
+/** Interposed glibc malloc: counts operator new and Eigen allocations. */
+std::atomic<long> g_num_allocations{0};
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* malloc(size_t size)
+{
+    g_num_allocations++;
+    return __libc_malloc(size);
+}
+
+/* ============================================================================
+ * Synthetic ground truth: well separated objects, slowly drifting.
+ * ========================================================================== */
+/** Frame of detections, with the ground truth object of every detection. */
+struct synthetic_frame
+{
+    tfrt::boxes2d::bboxes2d  detections;
+    std::vector<int>  objects;
+};
+
+std::vector<synthetic_frame> synthetic_frames(int grid_size, int num_frames,
+    double missed_rate, double fps)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> uvel(-1e-4f, 1e-4f);
+    std::normal_distribution<float> noise(0.0f, 5e-4f);
+    std::bernoulli_distribution missed(missed_rate);
+    // Common motion, plus a small relative drift: objects never overlap.
+    const int num_objects = grid_size * grid_size;
+    const float spacing = 1.0f / grid_size;
+    const float size = 0.2f * spacing;
+    std::vector<float> y0(num_objects), x0(num_objects), vy(num_objects), vx(num_objects);
+    for(int i = 0 ; i < num_objects ; ++i) {
+        y0[i] = (i / grid_size + 0.5f) * spacing;
+        x0[i] = (i % grid_size + 0.5f) * spacing;
+        vy[i] = 5e-4f + uvel(gen);
+        vx[i] = -3e-4f + uvel(gen);
+    }
+    auto t0 = tfrt::boxes2d::bboxes2d::clock::now();
+    std::vector<synthetic_frame> frames(num_frames);
+    for(int f = 0 ; f < num_frames ; ++f) {
+        synthetic_frame& frame = frames[f];
+        frame.detections = tfrt::boxes2d::bboxes2d{size_t(num_objects)};
+        frame.detections.time = t0 + std::chrono::microseconds(long(f * 1e6 / fps));
+        int idx = 0;
+        for(int i = 0 ; i < num_objects ; ++i) {
+            if(missed(gen)) {
+                continue;
+            }
+            const float y = y0[i] + f * vy[i] + noise(gen);
+            const float x = x0[i] + f * vx[i] + noise(gen);
+            frame.detections.classes[idx] = 1 + i % 4;
+            frame.detections.scores[idx] = 0.9f;
+            frame.detections.boxes.row(idx) << y - size, x - size, y + size, x + size;
+            frame.objects.push_back(i);
+            idx++;
+        }
+    }
+    return frames;
+}
+
+/* ============================================================================
+ * Tracker behaviour: stable ids, no lost tracks, ages in frames.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const auto frames = synthetic_frames(FLAGS_grid_size, FLAGS_num_frames,
+        FLAGS_missed_rate, FLAGS_fps);
+    tfrt::boxes2d::tracker tracker;
+    const int min_hits = tracker.params().min_hits;
+
+    // Per object: track id, and frame / age when first reported.
+    const int num_objects = FLAGS_grid_size * FLAGS_grid_size;
+    std::vector<int> object_ids(num_objects, -1);
+    std::vector<int> first_frames(num_objects, -1), first_ages(num_objects, -1);
+    std::vector<int> consecutive(num_objects, 0);
+    std::vector<bool> detected(num_objects, false);
+    std::map<int, int> id_objects;
+    int num_switches = 0, num_lost = 0, num_age_errors = 0;
+    Eigen::ArrayXXf iou;
+    for(int f = 0 ; f < int(frames.size()) ; ++f) {
+        const auto& frame = frames[f];
+        const auto& tracks = tracker.update(frame.detections);
+        const long num_dets = frame.objects.size();
+        const long num_tracks = tracks.size_notnull();
+        std::fill(detected.begin(), detected.end(), false);
+        for(long j = 0 ; j < num_dets ; ++j) {
+            detected[frame.objects[j]] = true;
+        }
+        for(int i = 0 ; i < num_objects ; ++i) {
+            consecutive[i] = detected[i] ? consecutive[i] + 1 : 0;
+        }
+        if(num_tracks > 0 && num_dets > 0) {
+            tfrt::boxes2d::iou_matrix(frame.detections.boxes.topRows(num_dets),
+                tracks.boxes.topRows(num_tracks), iou);
+        }
+        std::vector<bool> reported(num_objects, false);
+        for(long t = 0 ; t < num_tracks ; ++t) {
+            // Ground truth object: best overlapping detection.
+            long best = -1;
+            for(long j = 0 ; j < num_dets ; ++j) {
+                if(iou(j, t) > 0.5f && (best < 0 || iou(j, t) > iou(best, t))) {
+                    best = j;
+                }
+            }
+            if(best < 0) {
+                LOG(ERROR) << "Frame " << f << ": track " << tracks.ids[t] << " matches no object.";
+                num_lost++;
+                continue;
+            }
+            const int obj = frame.objects[best];
+            const int id = tracks.ids[t];
+            reported[obj] = true;
+            // Id switch: object with a new id, or id re-used by another object.
+            if(object_ids[obj] >= 0 && object_ids[obj] != id) {
+                LOG(ERROR) << "Frame " << f << ": object " << obj << " switched from track "
+                    << object_ids[obj] << " to " << id;
+                num_switches++;
+            }
+            if(id_objects.count(id) && id_objects[id] != obj) {
+                LOG(ERROR) << "Frame " << f << ": track " << id << " switched from object "
+                    << id_objects[id] << " to " << obj;
+                num_switches++;
+            }
+            object_ids[obj] = id;
+            id_objects[id] = obj;
+            // Age: number of frames since the track creation.
+            if(first_frames[obj] < 0) {
+                first_frames[obj] = f;
+                first_ages[obj] = tracks.ages[t];
+            }
+            else if(tracks.ages[t] - first_ages[obj] != f - first_frames[obj]) {
+                num_age_errors++;
+            }
+        }
+        // Lost: detected for min_hits consecutive frames, but not reported.
+        for(int i = 0 ; i < num_objects ; ++i) {
+            if(consecutive[i] >= min_hits && !reported[i]) {
+                LOG(ERROR) << "Frame " << f << ": object " << i << " not tracked.";
+                num_lost++;
+            }
+        }
+    }
+    // No allocation in update(), once the tracker is constructed.
+    tfrt::boxes2d::tracker::parameters params;
+    params.max_tracks = num_objects + 16;
+    params.max_detections = num_objects;
+    tfrt::boxes2d::tracker tracker_noalloc{params};
+    const long num_allocations = g_num_allocations;
+    for(auto&& frame : frames) {
+        tracker_noalloc.update(frame.detections);
+    }
+    const long update_allocations = g_num_allocations - num_allocations;
+    if(update_allocations) {
+        LOG(ERROR) << "Tracker update: " << update_allocations << " heap allocation(s).";
+    }
+
+    std::cout << "Tracker behaviour | #objects: " << num_objects << " #frames: " << frames.size()
+        << " | id switches: " << num_switches << " | lost tracks: " << num_lost
+        << " | age errors: " << num_age_errors << std::endl;
+    if(num_switches || num_lost || num_age_errors || update_allocations) {
+        LOG(ERROR) << "Tracker behaviour: failed.";
+        return 1;
+    }
+    std::cout << "Tracker keeps stable ids." << std::endl;
+    return 0;
+}
@@ -0,0 +1,267 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <cpu/cpuYUV.h>
+#include <cpu/cpuCHWImage.h>
+
+#ifndef TFRT_CPU_ONLY
+#include <tensor.h>
+#include <cuda/cudaCHWImage.h>
+#include <cuda/cudaYUV.h>
+#endif
+
+DEFINE_int32(height, 480, "Camera frame height.");
+DEFINE_int32(width, 640, "Camera frame width.");
+DEFINE_int32(padding, 32, "Row padding of the frames, in bytes.");
+DEFINE_int32(iterations, 100, "Number of timing iterations.");
+
+/* ============================================================================
+ * Fixtures and float reference.
+ * ========================================================================== */
+/** Size of a YUV frame, in bytes. */
+size_t frame_size(tfrt::yuv_format format, int pitch, int height)
+{
+    if(format == tfrt::yuv_format::yuyv || format == tfrt::yuv_format::uyvy) {
+        return size_t(pitch) * height;
+    }
+    return size_t(pitch) * height * 3 / 2;
+}
+int frame_pitch(tfrt::yuv_format format, int width)
+{
+    const bool packed = (format == tfrt::yuv_format::yuyv || format == tfrt::yuv_format::uyvy);
+    return (packed ? width * 2 : width) + FLAGS_padding;
+}
+/** Float YUV => RGB (coefficients of the CUDA YUYV kernels). */
+void reference_rgb(float y, float u, float v, float* rgb)
+{
+    u -= 128.0f;
+    v -= 128.0f;
+    rgb[0] = y + 1.4065f * v;
+    rgb[1] = y - 0.3455f * u - 0.7169f * v;
+    rgb[2] = y + 1.7790f * u;
+    for(int c = 0 ; c < 3 ; ++c) {
+        rgb[c] = std::min(std::max(rgb[c], 0.0f), 255.0f);
+    }
+}
+/** Max absolute difference with the float reference (no chroma interpolation
+ * check for 4:2:0: even rows only).
+ */
+int reference_error(tfrt::yuv_format format, const uint8_t* frame, int pitch,
+    const uint8_t* rgba, int width, int height)
+{
+    int max_error = 0;
+    for(int y = 0 ; y < height ; ++y) {
+        for(int x = 0 ; x < width ; ++x) {
+            float yv, uv, vv;
+            const uint8_t* macro = frame + y * pitch + (x / 2) * 4;
+            const int cidx = (y / 2) * (pitch / 2) + x / 2;
+            const uint8_t* chroma = frame + size_t(pitch) * height;
+            switch(format) {
+            case tfrt::yuv_format::yuyv:
+                yv = macro[(x & 1) * 2];  uv = macro[1];  vv = macro[3];
+                break;
+            case tfrt::yuv_format::uyvy:
+                yv = macro[(x & 1) * 2 + 1];  uv = macro[0];  vv = macro[2];
+                break;
+            default:
+                if(y & 1) {
+                    continue;
+                }
+                yv = frame[y * pitch + x];
+                if(format == tfrt::yuv_format::nv12) {
+                    uv = chroma[(y / 2) * pitch + (x / 2) * 2];
+                    vv = chroma[(y / 2) * pitch + (x / 2) * 2 + 1];
+                }
+                else {
+                    const uint8_t* first = chroma;
+                    const uint8_t* second = chroma + (pitch / 2) * (height / 2);
+                    const bool i420 = (format == tfrt::yuv_format::i420);
+                    uv = (i420 ? first : second)[cidx];
+                    vv = (i420 ? second : first)[cidx];
+                }
+            }
+            float rgb[3];
+            reference_rgb(yv, uv, vv, rgb);
+            for(int c = 0 ; c < 3 ; ++c) {
+                max_error = std::max(max_error,
+                    std::abs(int(std::lround(rgb[c])) - int(rgba[(y * width + x) * 4 + c])));
+            }
+        }
+    }
+    return max_error;
+}
+
+/* ============================================================================
+ * Host colour conversion: float reference, direct CHW and CUDA consistency.
+ * ========================================================================== */
+int main(int argc, char** argv)
+{
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    const int h = FLAGS_height;
+    const int w = FLAGS_width;
+    const std::vector<std::pair<tfrt::yuv_format, std::string> > formats = {
+        {tfrt::yuv_format::yuyv, "YUYV"}, {tfrt::yuv_format::uyvy, "UYVY"},
+        {tfrt::yuv_format::nv12, "NV12"}, {tfrt::yuv_format::yv12, "YV12"},
+        {tfrt::yuv_format::i420, "I420"}};
+    const float scale[3] = {1.0f / 58.395f, 1.0f / 57.12f, 1.0f / 57.375f};
+    const float shift[3] = {-123.68f / 58.395f, -116.78f / 57.12f, -103.94f / 57.375f};
+    std::mt19937 gen(42);
+    int num_errors = 0;
+    std::vector<uint8_t> rgba(size_t(w) * h * 4);
+    for(auto&& f : formats) {
+        const int pitch = frame_pitch(f.first, w);
+        std::vector<uint8_t> frame(frame_size(f.first, pitch, h));
+        for(auto& v : frame) {
+            v = gen() & 0xff;
+        }
+        // Fixed-point conversion vs float reference.
+        CHECK(cpu_yuv_to_rgba(f.first, frame.data(), pitch, rgba.data(), w * 4, w, h));
+        const int error = reference_error(f.first, frame.data(), pitch, rgba.data(), w, h);
+        if(error > 1) {
+            LOG(ERROR) << f.second << " => RGBA: max error " << error << " with the float reference.";
+            num_errors++;
+        }
+        // Direct CHW == RGBA + fused preprocessing, bitwise.
+        for(auto&& shape : {std::make_pair(300, 300), std::make_pair(h, w), std::make_pair(37, 61)}) {
+            const size_t size = size_t(3) * shape.first * shape.second;
+            std::vector<float> direct(size), two_steps(size);
+            for(bool half_output : {false, true}) {
+                CHECK(cpu_yuv_to_chw_normalize(f.first, frame.data(), pitch, w, h, direct.data(),
+                    shape.second, shape.first, scale, shift, half_output));
+                CHECK(cpu_rgba_to_chw_normalize(rgba.data(), two_steps.data(), w, h, 4, w * 4,
+                    shape.second, shape.first, tfrt::resize_mode::nearest, scale, shift, half_output));
+                const size_t nbytes = size * (half_output ? sizeof(uint16_t) : sizeof(float));
+                if(std::memcmp(direct.data(), two_steps.data(), nbytes)) {
+                    LOG(ERROR) << f.second << " => CHW " << shape.first << "x" << shape.second
+                        << " (half: " << half_output << "): differs from RGBA preprocessing.";
+                    num_errors++;
+                }
+            }
+        }
+        // Timings: RGBA and direct 3x300x300 input.
+        std::vector<float> input(3 * 300 * 300);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+            cpu_yuv_to_rgba(f.first, frame.data(), pitch, rgba.data(), w * 4, w, h);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for(int i = 0 ; i < FLAGS_iterations ; ++i) {
+            cpu_yuv_to_chw_normalize(f.first, frame.data(), pitch, w, h, input.data(),
+                300, 300, scale, shift, false);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << f.second << " " << h << "x" << w << " | RGBA: "
+            << std::chrono::duration<double, std::milli>(t1 - t0).count() / FLAGS_iterations
+            << " ms | CHW 3x300x300: "
+            << std::chrono::duration<double, std::milli>(t2 - t1).count() / FLAGS_iterations
+            << " ms" << std::endl;
+    }
+
+#ifndef TFRT_CPU_ONLY
+    // CUDA YUYV / UYVY: float kernels truncate, fixed-point rounds.
+    {
+        const int pitch = w * 2;
+        tfrt::cuda_tensor_u8 frame{"frame", {1, 1, h, pitch}};
+        tfrt::cuda_tensor_u8 out_cuda{"out_cuda", {1, 1, h, w * 4}};
+        CHECK(frame.allocate());
+        CHECK(out_cuda.allocate());
+        for(int i = 0 ; i < h * pitch ; ++i) {
+            frame.cpu[i] = gen() & 0xff;
+        }
+        for(bool uyvy : {false, true}) {
+            if(uyvy) {
+                CUDA(cudaUYVYToRGBA((uchar2*)frame.cuda, (uchar4*)out_cuda.cuda, w, h));
+                CHECK(cpu_uyvy_to_rgba(frame.cpu, pitch, rgba.data(), w * 4, w, h));
+            }
+            else {
+                CUDA(cudaYUYVToRGBA((uchar2*)frame.cuda, (uchar4*)out_cuda.cuda, w, h));
+                CHECK(cpu_yuyv_to_rgba(frame.cpu, pitch, rgba.data(), w * 4, w, h));
+            }
+            CUDA(cudaDeviceSynchronize());
+            int max_error = 0;
+            for(size_t i = 0 ; i < rgba.size() ; ++i) {
+                max_error = std::max(max_error, std::abs(int(rgba[i]) - int(out_cuda.cpu[i])));
+            }
+            if(max_error > 2) {
+                LOG(ERROR) << (uyvy ? "UYVY" : "YUYV") << " => RGBA: max error "
+                    << max_error << " with CUDA.";
+                num_errors++;
+            }
+        }
+        // Fused YUV => CHW preprocessing, bitwise identical.
+        const int oh = 300, ow = 300;
+        tfrt::cuda_tensor input_cuda{"input_cuda", {1, 3, oh, ow}};
+        CHECK(input_cuda.allocate());
+        std::vector<float> input_cpu(3 * oh * ow);
+        for(auto&& f : formats) {
+            const int fpitch = frame_pitch(f.first, w);
+            const size_t fsize = frame_size(f.first, fpitch, h);
+            tfrt::cuda_tensor_u8 yuv{"yuv", {1, 1, 1, int(fsize)}};
+            CHECK(yuv.allocate());
+            for(size_t i = 0 ; i < fsize ; ++i) {
+                yuv.cpu[i] = gen() & 0xff;
+            }
+            for(bool half_output : {false, true}) {
+                CUDA(cuda_yuv_to_chw_normalize(f.first, yuv.cuda, fpitch, w, h, input_cuda.cuda,
+                    ow, oh, scale, shift, half_output));
+                CUDA(cudaDeviceSynchronize());
+                CHECK(cpu_yuv_to_chw_normalize(f.first, yuv.cpu, fpitch, w, h, input_cpu.data(),
+                    ow, oh, scale, shift, half_output));
+                const size_t nbytes = input_cpu.size() * (half_output ? sizeof(uint16_t) : sizeof(float));
+                if(std::memcmp(input_cpu.data(), input_cuda.cpu, nbytes)) {
+                    LOG(ERROR) << f.second << " => CHW (half: " << half_output
+                        << "): mismatch with CUDA.";
+                    num_errors++;
+                }
+            }
+        }
+        // RGBA => I420: same integer formulas, bitwise identical.
+        tfrt::cuda_tensor_u8 image{"image", {1, 1, h, w * 4}};
+        tfrt::cuda_tensor_u8 yuv_cuda{"yuv_cuda", {1, 1, h * 3 / 2, w}};
+        CHECK(image.allocate());
+        CHECK(yuv_cuda.allocate());
+        for(int i = 0 ; i < h * w * 4 ; ++i) {
+            image.cpu[i] = gen() & 0xff;
+        }
+        std::vector<uint8_t> yuv_cpu(size_t(w) * h * 3 / 2);
+        CUDA(cudaRGBAToI420((uchar4*)image.cuda, yuv_cuda.cuda, w, h));
+        CUDA(cudaDeviceSynchronize());
+        CHECK(cpu_rgba_to_i420(image.cpu, w * 4, yuv_cpu.data(), w, w, h));
+        if(std::memcmp(yuv_cpu.data(), yuv_cuda.cpu, yuv_cpu.size())) {
+            LOG(ERROR) << "RGBA => I420: mismatch with CUDA.";
+            num_errors++;
+        }
+    }
+#endif
+    if(num_errors) {
+        LOG(ERROR) << "Host colour conversion: " << num_errors << " failed cases.";
+        return 1;
+    }
+    std::cout << "Host colour conversion is consistent." << std::endl;
+    return 0;
+}
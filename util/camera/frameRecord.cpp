@@ -0,0 +1,215 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <chrono>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <glog/logging.h>
+
+#include "frameRecord.h"
+
+namespace tfrt
+{
+namespace
+{
+const char kMagic[8] = {'T', 'F', 'R', 'T', 'F', 'R', 'M', '1'};
+const uint32_t kVersion = 1;
+const uint64_t kAlignment = 4096;
+const uint32_t kScaleUnity = 1024;  // VX_SCALE_UNITY.
+
+uint64_t align(uint64_t v)
+{
+    return (v + kAlignment - 1) / kAlignment * kAlignment;
+}
+}
+
+int64_t frame_clock_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+void frame_plane_geometry(uint32_t dim_x, uint32_t dim_y, uint32_t scale_x, uint32_t scale_y,
+    uint32_t stride_x, uint32_t& rows, uint32_t& row_bytes)
+{
+    rows = dim_y * scale_y / kScaleUnity;
+    row_bytes = dim_x * scale_x / kScaleUnity * stride_x;
+}
+
+/* ============================================================================
+ * tfrt::frame_recorder
+ * ========================================================================== */
+frame_recorder::frame_recorder() :
+    m_file{nullptr}, m_offset{0}
+{
+}
+frame_recorder::~frame_recorder()
+{
+    this->close();
+}
+
+bool frame_recorder::open(const std::string& filename)
+{
+    this->close();
+    m_file = fopen(filename.c_str(), "wb");
+    if(!m_file) {
+        LOG(ERROR) << "Could not open frames record file: " << filename;
+        return false;
+    }
+    m_filename = filename;
+    m_index.clear();
+    // Header written at close: placeholder.
+    frame_file_header header;
+    memset(&header, 0, sizeof(header));
+    fwrite(&header, sizeof(header), 1, m_file);
+    m_offset = sizeof(header);
+    LOG(INFO) << "Recording frames in: " << filename;
+    return true;
+}
+
+bool frame_recorder::record(uint32_t width, uint32_t height, uint32_t format,
+    uint32_t num_planes, const void* const* planes, const uint32_t* strides,
+    const uint32_t* heights, int64_t timestamp_ns)
+{
+    CHECK(num_planes > 0 && num_planes <= 3) << "Invalid number of planes: " << num_planes;
+    if(!m_file) {
+        return false;
+    }
+    frame_info info;
+    memset(&info, 0, sizeof(info));
+    info.offset = align(m_offset);
+    info.timestamp_ns = timestamp_ns >= 0 ? timestamp_ns : frame_clock_ns();
+    info.width = width;
+    info.height = height;
+    info.format = format;
+    info.num_planes = num_planes;
+    // Page aligned frame data.
+    static const uint8_t zeros[kAlignment] = {0};
+    bool r = fwrite(zeros, 1, info.offset - m_offset, m_file) == info.offset - m_offset;
+    for(uint32_t p = 0 ; p < num_planes ; ++p) {
+        const size_t psize = size_t(strides[p]) * heights[p];
+        info.strides[p] = strides[p];
+        info.plane_offsets[p] = uint32_t(info.size);
+        r = r && fwrite(planes[p], 1, psize, m_file) == psize;
+        info.size += psize;
+    }
+    if(!r) {
+        LOG(ERROR) << "Failed to write frame in record file: " << m_filename;
+        return false;
+    }
+    m_offset = info.offset + info.size;
+    m_index.push_back(info);
+    return true;
+}
+bool frame_recorder::record(uint32_t width, uint32_t height, uint32_t format,
+    const void* data, uint32_t stride, int64_t timestamp_ns)
+{
+    return this->record(width, height, format, 1, &data, &stride, &height, timestamp_ns);
+}
+
+bool frame_recorder::close()
+{
+    if(!m_file) {
+        return false;
+    }
+    // Index at the end, then final header.
+    frame_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.num_frames = m_index.size();
+    header.index_offset = align(m_offset);
+    static const uint8_t zeros[kAlignment] = {0};
+    bool r = fwrite(zeros, 1, header.index_offset - m_offset, m_file) == header.index_offset - m_offset;
+    r = r && fwrite(m_index.data(), sizeof(frame_info), m_index.size(), m_file) == m_index.size();
+    r = r && fseek(m_file, 0, SEEK_SET) == 0;
+    r = r && fwrite(&header, sizeof(header), 1, m_file) == 1;
+    r = (fclose(m_file) == 0) && r;
+    m_file = nullptr;
+    LOG_IF(ERROR, !r) << "Failed to finalize frames record file: " << m_filename;
+    LOG_IF(INFO, r) << "Recorded " << m_index.size() << " frames in: " << m_filename;
+    return r;
+}
+
+/* ============================================================================
+ * tfrt::frame_replay
+ * ========================================================================== */
+frame_replay::frame_replay() :
+    m_data{nullptr}, m_size{0}, m_num_frames{0}, m_index{nullptr}
+{
+}
+frame_replay::~frame_replay()
+{
+    this->close();
+}
+
+bool frame_replay::open(const std::string& filename)
+{
+    this->close();
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0) {
+        LOG(ERROR) << "Could not open frames record file: " << filename;
+        return false;
+    }
+    struct stat st;
+    if(fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(frame_file_header)) {
+        LOG(ERROR) << "Invalid frames record file: " << filename;
+        ::close(fd);
+        return false;
+    }
+    void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(ptr == MAP_FAILED) {
+        LOG(ERROR) << "Could not map frames record file: " << filename;
+        return false;
+    }
+    madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const uint8_t*>(ptr);
+    m_size = st.st_size;
+    // Check header and index.
+    const frame_file_header* header = reinterpret_cast<const frame_file_header*>(m_data);
+    if(memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 || header->version != kVersion ||
+            header->index_offset + header->num_frames * sizeof(frame_info) > m_size) {
+        LOG(ERROR) << "Invalid or unfinished frames record file: " << filename;
+        this->close();
+        return false;
+    }
+    m_num_frames = header->num_frames;
+    m_index = reinterpret_cast<const frame_info*>(m_data + header->index_offset);
+    for(size_t i = 0 ; i < m_num_frames ; ++i) {
+        if(m_index[i].offset + m_index[i].size > header->index_offset) {
+            LOG(ERROR) << "Corrupted frames record file index: " << filename;
+            this->close();
+            return false;
+        }
+    }
+    LOG(INFO) << "Replaying " << m_num_frames << " frames from: " << filename;
+    return true;
+}
+void frame_replay::close()
+{
+    if(m_data) {
+        munmap((void*)m_data, m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_num_frames = 0;
+    m_index = nullptr;
+}
+
+}
@@ -0,0 +1,155 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_FRAME_RECORD_H
+#define TFRT_FRAME_RECORD_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace tfrt
+{
+/* ============================================================================
+ * Recorded frames file format.
+ * ========================================================================== */
+/** Compact indexed file of raw frames, for deterministic replays:
+ *  - header (64 bytes): magic, version, number of frames, index offset;
+ *  - frames raw data, every frame aligned on a page (mmap friendly);
+ *  - index, at the end: one frame_info per frame.
+ * The index is written when closing the recorder: an interrupted recording
+ * can not be replayed. Host endianness.
+ */
+struct frame_file_header
+{
+    char  magic[8];         // "TFRTFRM1"
+    uint32_t  version;
+    uint32_t  reserved;
+    uint64_t  num_frames;
+    uint64_t  index_offset;
+    uint8_t  padding[32];
+};
+/** Frame description in the index. Planes are stored contiguously. */
+struct frame_info
+{
+    uint64_t  offset;       // Offset of the data in the file.
+    uint64_t  size;         // Size of the data (all planes).
+    int64_t  timestamp_ns;  // Capture timestamp (monotonic clock).
+    uint32_t  width;
+    uint32_t  height;
+    uint32_t  format;       // FourCC, e.g. vx_df_image (RGBX, NV12, ...).
+    uint32_t  num_planes;
+    uint32_t  strides[3];   // Row stride of every plane, in bytes.
+    uint32_t  plane_offsets[3];  // Offset of every plane in the frame data.
+};
+
+/** Monotonic clock, in nanoseconds. */
+int64_t frame_clock_ns();
+/** Number of rows and bytes per row of an image plane, from its OpenVX
+ * addressing: full image dimensions, plane scale (unity: 1024, e.g. 512 for
+ * NV12 chroma) and pixel stride in bytes.
+ */
+void frame_plane_geometry(uint32_t dim_x, uint32_t dim_y, uint32_t scale_x, uint32_t scale_y,
+    uint32_t stride_x, uint32_t& rows, uint32_t& row_bytes);
+
+/* ============================================================================
+ * tfrt::frame_recorder
+ * ========================================================================== */
+/** Record raw frames in a file. Data is written as-is (no conversion), so the
+ * recorder works with any source: ovxio::FrameSource (see
+ * tfrt::recording_frame_source) or gstCamera NV12 CPU buffers.
+ */
+class frame_recorder
+{
+public:
+    frame_recorder();
+    ~frame_recorder();
+
+    /** Open the file, truncated. */
+    bool open(const std::string& filename);
+    /** Record a frame. Planes pointers, strides and heights are given by
+     * plane (num_planes <= 3). Timestamp: now if negative.
+     */
+    bool record(uint32_t width, uint32_t height, uint32_t format, uint32_t num_planes,
+        const void* const* planes, const uint32_t* strides, const uint32_t* heights,
+        int64_t timestamp_ns=-1);
+    /** Single plane helper. */
+    bool record(uint32_t width, uint32_t height, uint32_t format,
+        const void* data, uint32_t stride, int64_t timestamp_ns=-1);
+    /** Write the index and close the file. */
+    bool close();
+
+    bool is_open() const {
+        return m_file != nullptr;
+    }
+    size_t num_frames() const {
+        return m_index.size();
+    }
+
+private:
+    frame_recorder(const frame_recorder&) = delete;
+    frame_recorder& operator=(const frame_recorder&) = delete;
+
+private:
+    FILE*  m_file;
+    std::string  m_filename;
+    uint64_t  m_offset;
+    std::vector<frame_info>  m_index;
+};
+
+/* ============================================================================
+ * tfrt::frame_replay
+ * ========================================================================== */
+/** Read-only access to a recorded file, memory mapped: frames are served
+ * without copy nor allocation.
+ */
+class frame_replay
+{
+public:
+    frame_replay();
+    ~frame_replay();
+
+    /** Open and map a file. Return false if invalid. */
+    bool open(const std::string& filename);
+    void close();
+
+    size_t num_frames() const {
+        return m_num_frames;
+    }
+    const frame_info& info(size_t idx) const {
+        return m_index[idx];
+    }
+    /** Frame data, and plane data. */
+    const uint8_t* data(size_t idx) const {
+        return m_data + m_index[idx].offset;
+    }
+    const uint8_t* plane(size_t idx, uint32_t p) const {
+        return this->data(idx) + m_index[idx].plane_offsets[p];
+    }
+
+private:
+    frame_replay(const frame_replay&) = delete;
+    frame_replay& operator=(const frame_replay&) = delete;
+
+private:
+    const uint8_t*  m_data;
+    size_t  m_size;
+    size_t  m_num_frames;
+    const frame_info*  m_index;
+};
+
+}
+
+#endif
@@ -0,0 +1,246 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <glog/logging.h>
+#include <NVX/nvx.h>
+
+#include "replayFrameSource.h"
+
+namespace tfrt
+{
+namespace
+{
+/** Number of rows and bytes per row of an image plane mapping. */
+void plane_geometry(const vx_imagepatch_addressing_t& addr, uint32_t& rows, uint32_t& row_bytes)
+{
+    static_assert(VX_SCALE_UNITY == 1024, "Unexpected OpenVX scale unity.");
+    frame_plane_geometry(addr.dim_x, addr.dim_y, addr.scale_x, addr.scale_y, addr.stride_x,
+        rows, row_bytes);
+}
+vx_uint32 image_planes(vx_image image)
+{
+    vx_size planes = 0;
+    vxQueryImage(image, VX_IMAGE_PLANES, &planes, sizeof(planes));
+    return vx_uint32(planes);
+}
+}
+
+/* ============================================================================
+ * tfrt::replay_frame_source
+ * ========================================================================== */
+replay_frame_source::replay_frame_source(const std::string& filename, bool realtime) :
+    ovxio::FrameSource(ovxio::FrameSource::VIDEO_SOURCE, "replay"),
+    m_filename{filename}, m_realtime{realtime}, m_next_frame{0}, m_start_ns{-1}
+{
+}
+replay_frame_source::~replay_frame_source()
+{
+    this->close();
+}
+
+bool replay_frame_source::open()
+{
+    if(!m_replay.num_frames() && !m_replay.open(m_filename)) {
+        return false;
+    }
+    m_next_frame = 0;
+    m_start_ns = -1;
+    return m_replay.num_frames() > 0;
+}
+ovxio::FrameSource::FrameStatus replay_frame_source::fetch(vx_image image, vx_uint32 timeout)
+{
+    if(m_next_frame >= m_replay.num_frames()) {
+        return FrameSource::CLOSED;
+    }
+    const frame_info& info = m_replay.info(m_next_frame);
+    // Recorded speed: wait until the frame is due (at most the timeout).
+    const int64_t now = frame_clock_ns();
+    if(m_start_ns < 0) {
+        m_start_ns = now;
+    }
+    if(m_realtime) {
+        const int64_t due = m_start_ns + (info.timestamp_ns - m_replay.info(0).timestamp_ns);
+        if(due > now) {
+            const int64_t wait_ns = std::min(due - now, int64_t(timeout) * 1000000);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+            if(wait_ns < due - now) {
+                return FrameSource::TIMEOUT;
+            }
+        }
+    }
+    // Same format and size expected: raw copy of the planes.
+    vx_df_image format = VX_DF_IMAGE_VIRT;
+    vx_uint32 width = 0, height = 0;
+    vxQueryImage(image, VX_IMAGE_FORMAT, &format, sizeof(format));
+    vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width));
+    vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height));
+    if(format != vx_df_image(info.format) || width != info.width || height != info.height ||
+            image_planes(image) != info.num_planes) {
+        LOG(ERROR) << "Replay: fetched image does not match the recorded frames ("
+            << info.width << "x" << info.height << ", format " << info.format << ").";
+        return FrameSource::CLOSED;
+    }
+    vx_rectangle_t rect{0, 0, width, height};
+    for(vx_uint32 p = 0 ; p < info.num_planes ; ++p) {
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t addr;
+        void* ptr = nullptr;
+        if(vxMapImagePatch(image, &rect, p, &map_id, &addr, &ptr,
+                VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, 0) != VX_SUCCESS) {
+            LOG(ERROR) << "Replay: could not map image plane " << p;
+            return FrameSource::CLOSED;
+        }
+        uint32_t rows, row_bytes;
+        plane_geometry(addr, rows, row_bytes);
+        row_bytes = std::min(row_bytes, info.strides[p]);
+        const uint8_t* src = m_replay.plane(m_next_frame, p);
+        uint8_t* dst = static_cast<uint8_t*>(ptr);
+        for(uint32_t y = 0 ; y < rows ; ++y) {
+            memcpy(dst + y * addr.stride_y, src + y * info.strides[p], row_bytes);
+        }
+        vxUnmapImagePatch(image, map_id);
+    }
+    m_next_frame++;
+    return FrameSource::OK;
+}
+ovxio::FrameSource::Parameters replay_frame_source::getConfiguration()
+{
+    FrameSource::Parameters params;
+    const size_t n = m_replay.num_frames();
+    if(n) {
+        const frame_info& first = m_replay.info(0);
+        params.frameWidth = first.width;
+        params.frameHeight = first.height;
+        params.format = vx_df_image(first.format);
+        const int64_t duration = m_replay.info(n - 1).timestamp_ns - first.timestamp_ns;
+        params.fps = duration > 0 ? vx_uint32((n - 1) * 1e9 / duration + 0.5) : 30;
+    }
+    return params;
+}
+bool replay_frame_source::setConfiguration(const FrameSource::Parameters& params)
+{
+    // Recorded configuration: nothing to configure.
+    return true;
+}
+void replay_frame_source::close()
+{
+    m_replay.close();
+    m_next_frame = 0;
+}
+
+/* ============================================================================
+ * tfrt::recording_frame_source
+ * ========================================================================== */
+recording_frame_source::recording_frame_source(
+    std::unique_ptr<ovxio::FrameSource> source, const std::string& filename) :
+        ovxio::FrameSource(source->getSourceType(), source->getSourceName()),
+        m_source{std::move(source)}, m_filename{filename}
+{
+}
+recording_frame_source::~recording_frame_source()
+{
+    this->close();
+}
+
+bool recording_frame_source::open()
+{
+    return m_source->open() && (m_recorder.is_open() || m_recorder.open(m_filename));
+}
+ovxio::FrameSource::FrameStatus recording_frame_source::fetch(vx_image image, vx_uint32 timeout)
+{
+    FrameSource::FrameStatus status = m_source->fetch(image, timeout);
+    if(status != FrameSource::OK || !m_recorder.is_open()) {
+        return status;
+    }
+    const int64_t timestamp = frame_clock_ns();
+    vx_df_image format = VX_DF_IMAGE_VIRT;
+    vx_uint32 width = 0, height = 0;
+    vxQueryImage(image, VX_IMAGE_FORMAT, &format, sizeof(format));
+    vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width));
+    vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height));
+    const vx_uint32 num_planes = std::min(image_planes(image), vx_uint32(3));
+    // Map all planes on host, then record.
+    vx_rectangle_t rect{0, 0, width, height};
+    vx_map_id map_ids[3];
+    const void* planes[3];
+    uint32_t strides[3], heights[3], row_bytes;
+    vx_uint32 mapped = 0;
+    for( ; mapped < num_planes ; ++mapped) {
+        vx_imagepatch_addressing_t addr;
+        void* ptr = nullptr;
+        if(vxMapImagePatch(image, &rect, mapped, &map_ids[mapped], &addr, &ptr,
+                VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0) != VX_SUCCESS) {
+            break;
+        }
+        planes[mapped] = ptr;
+        strides[mapped] = addr.stride_y;
+        plane_geometry(addr, heights[mapped], row_bytes);
+    }
+    if(mapped == num_planes) {
+        m_recorder.record(width, height, format, num_planes, planes, strides, heights, timestamp);
+    }
+    else {
+        LOG(ERROR) << "Recording: could not map image plane " << mapped;
+    }
+    for(vx_uint32 p = 0 ; p < mapped ; ++p) {
+        vxUnmapImagePatch(image, map_ids[p]);
+    }
+    return status;
+}
+ovxio::FrameSource::Parameters recording_frame_source::getConfiguration()
+{
+    return m_source->getConfiguration();
+}
+bool recording_frame_source::setConfiguration(const FrameSource::Parameters& params)
+{
+    return m_source->setConfiguration(params);
+}
+void recording_frame_source::close()
+{
+    m_source->close();
+}
+
+/* ============================================================================
+ * Factory.
+ * ========================================================================== */
+std::unique_ptr<ovxio::FrameSource> create_frame_source(vx_context context,
+    const std::string& uri, const std::string& record_file)
+{
+    std::unique_ptr<ovxio::FrameSource> source;
+    const std::string scheme = "replay://";
+    if(uri.compare(0, scheme.length(), scheme) == 0) {
+        std::string path = uri.substr(scheme.length());
+        bool realtime = true;
+        const size_t qpos = path.find('?');
+        if(qpos != std::string::npos) {
+            realtime = path.find("speed=max", qpos) == std::string::npos;
+            path = path.substr(0, qpos);
+        }
+        source.reset(new replay_frame_source(path, realtime));
+    }
+    else {
+        source = ovxio::createDefaultFrameSource(context, uri);
+    }
+    if(source && record_file.length()) {
+        source.reset(new recording_frame_source(std::move(source), record_file));
+    }
+    return source;
+}
+
+}
@@ -0,0 +1,92 @@
+/* ============================================================================
+# [2017] - Robik AI Ltd - Paul Balanca
+# All Rights Reserved.
+
+# NOTICE: All information contained herein is, and remains
+# the property of Robik AI Ltd, and its suppliers
+# if any.  The intellectual and technical concepts contained
+# herein are proprietary to Robik AI Ltd
+# and its suppliers and may be covered by U.S., European and Foreign Patents,
+# patents in process, and are protected by trade secret or copyright law.
+# Dissemination of this information or reproduction of this material
+# is strictly forbidden unless prior written permission is obtained
+# from Robik AI Ltd.
+# =========================================================================== */
+#ifndef TFRT_REPLAY_FRAME_SOURCE_H
+#define TFRT_REPLAY_FRAME_SOURCE_H
+
+#include <memory>
+#include <string>
+
+#include <VX/vx.h>
+#include <OVX/FrameSourceOVX.hpp>
+
+#include "frameRecord.h"
+
+namespace tfrt
+{
+/* ============================================================================
+ * tfrt::replay_frame_source
+ * ========================================================================== */
+/** FrameSource serving the frames of a recorded file (memory mapped), at the
+ * recorded speed or as fast as possible. Frames are copied as-is: the fetched
+ * image must have the recorded size and format. Closed at the end of the
+ * record: open() restarts from the first frame, for looping.
+ */
+class replay_frame_source : public ovxio::FrameSource
+{
+public:
+    replay_frame_source(const std::string& filename, bool realtime=true);
+    virtual ~replay_frame_source();
+
+    virtual bool open();
+    virtual FrameSource::FrameStatus fetch(vx_image image, vx_uint32 timeout=5);
+    virtual FrameSource::Parameters getConfiguration();
+    virtual bool setConfiguration(const FrameSource::Parameters& params);
+    virtual void close();
+
+private:
+    std::string  m_filename;
+    bool  m_realtime;
+    frame_replay  m_replay;
+    size_t  m_next_frame;
+    // Wall clock of the first frame served.
+    int64_t  m_start_ns;
+};
+
+/* ============================================================================
+ * tfrt::recording_frame_source
+ * ========================================================================== */
+/** FrameSource wrapper recording every fetched frame (any source, any
+ * format) in a file, with its capture timestamp.
+ */
+class recording_frame_source : public ovxio::FrameSource
+{
+public:
+    recording_frame_source(std::unique_ptr<ovxio::FrameSource> source,
+        const std::string& filename);
+    virtual ~recording_frame_source();
+
+    virtual bool open();
+    virtual FrameSource::FrameStatus fetch(vx_image image, vx_uint32 timeout=5);
+    virtual FrameSource::Parameters getConfiguration();
+    virtual bool setConfiguration(const FrameSource::Parameters& params);
+    virtual void close();
+
+private:
+    std::unique_ptr<ovxio::FrameSource>  m_source;
+    std::string  m_filename;
+    frame_recorder  m_recorder;
+};
+
+/** Create a frame source from an URI, with replay support:
+ *  - 'replay:///path/to/file.frames[?speed=max]': recorded file replay;
+ *  - anything else: ovxio::createDefaultFrameSource.
+ * If record_file is not empty, fetched frames are recorded in this file.
+ */
+std::unique_ptr<ovxio::FrameSource> create_frame_source(vx_context context,
+    const std::string& uri, const std::string& record_file="");
+
+}
+
+#endif
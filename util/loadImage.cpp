@@ -5,9 +5,55 @@
 #include "loadImage.h"
 #include "cuda/cudaMappedMemory.h"
 
+#include <cpu/cpuImageLoader.h>
+
 #include <QImage>
 
 
+// decode an image file to RGBA uint8: libjpeg / libpng fast path, QImage for
+// other formats or when resizing (no per-pixel QImage accessors).
+static bool loadImageRaw( const char* filename, int width, int height, cpu_image& img )
+{
+	if( width == 0 || height == 0 )
+	{
+		if( cpu_decode_image(filename, img) )
+			return true;
+	}
+
+	QImage qImg;
+
+	if( !qImg.load(filename) )
+	{
+		printf("failed to load image %s\n", filename);
+		return false;
+	}
+
+	if( width != 0 && height != 0 )
+		qImg = qImg.scaled(width, height, Qt::IgnoreAspectRatio);
+
+	qImg = qImg.convertToFormat(QImage::Format_ARGB32);
+	img.filename = filename;
+	img.width    = qImg.width();
+	img.height   = qImg.height();
+	img.data.resize(img.pitch() * img.height);
+
+	for( uint32_t y=0; y < img.height; y++ )
+	{
+		const QRgb* line = (const QRgb*)qImg.constScanLine(y);
+		uint8_t* row = img.data.data() + y * img.pitch();
+
+		for( uint32_t x=0; x < img.width; x++ )
+		{
+			row[x*4+0] = qRed(line[x]);
+			row[x*4+1] = qGreen(line[x]);
+			row[x*4+2] = qBlue(line[x]);
+			row[x*4+3] = qAlpha(line[x]);
+		}
+	}
+	return true;
+}
+
+
 
 bool saveImageRGBA( const char* filename, float4* cpu, int width, int height, float max_pixel )
 {
@@ -54,20 +100,13 @@ bool loadImageRGBA( const char* filename, float4** cpu, float4** gpu, int* width
 	}
 
 	// load original image
-	QImage qImg;
+	cpu_image img;
 
-	if( !qImg.load(filename) )
-	{
-		printf("failed to load image %s\n", filename);
+	if( !loadImageRaw(filename, *width, *height, img) )
 		return false;
-	}
-
-	if( *width != 0 && *height != 0 )
-		qImg = qImg.scaled(*width, *height, Qt::IgnoreAspectRatio);
 
-	const uint32_t imgWidth  = qImg.width();
-	const uint32_t imgHeight = qImg.height();
-	const uint32_t imgPixels = imgWidth * imgHeight;
+	const uint32_t imgWidth  = img.width;
+	const uint32_t imgHeight = img.height;
 	const size_t   imgSize   = imgWidth * imgHeight * sizeof(float) * 4;
 
 	printf("loaded image  %s  (%u x %u)  %zu bytes\n", filename, imgWidth, imgHeight, imgSize);
@@ -79,21 +118,7 @@ bool loadImageRGBA( const char* filename, float4** cpu, float4** gpu, int* width
 		return false;
 	}
 
-	float4* cpuPtr = *cpu;
-
-	for( uint32_t y=0; y < imgHeight; y++ )
-	{
-		for( uint32_t x=0; x < imgWidth; x++ )
-		{
-			const QRgb rgb  = qImg.pixel(x,y);
-			const float4 px = make_float4(float(qRed(rgb)),
-										  float(qGreen(rgb)),
-										  float(qBlue(rgb)),
-										  float(qAlpha(rgb)));
-
-			cpuPtr[y*imgWidth+x] = px;
-		}
-	}
+	cpu_image_to_rgba_float(img, (float*)*cpu);
 
 	*width  = imgWidth;
 	*height = imgHeight;
@@ -111,19 +136,13 @@ bool loadImageRGB( const char* filename, float3** cpu, float3** gpu, int* width,
 	}
 
 	// load original image
-	QImage qImg;
+	cpu_image img;
 
-	if( !qImg.load(filename) )
-	{
-		printf("failed to load image %s\n", filename);
+	if( !loadImageRaw(filename, *width, *height, img) )
 		return false;
-	}
-
-	if( *width != 0 && *height != 0 )
-		qImg = qImg.scaled(*width, *height, Qt::IgnoreAspectRatio);
 
-	const uint32_t imgWidth  = qImg.width();
-	const uint32_t imgHeight = qImg.height();
+	const uint32_t imgWidth  = img.width;
+	const uint32_t imgHeight = img.height;
 	const uint32_t imgPixels = imgWidth * imgHeight;
 	const size_t   imgSize   = imgWidth * imgHeight * sizeof(float) * 3;
 
@@ -142,11 +161,11 @@ bool loadImageRGB( const char* filename, float3** cpu, float3** gpu, int* width,
 	{
 		for( uint32_t x=0; x < imgWidth; x++ )
 		{
-			const QRgb rgb  = qImg.pixel(x,y);
+			const uint8_t* rgb = img.data.data() + y * img.pitch() + x * 4;
 			const float mul = 1.0f; 	//1.0f / 255.0f;
-			const float3 px = make_float3((float(qRed(rgb))   - mean.x) * mul,
-										  (float(qGreen(rgb)) - mean.y) * mul,
-										  (float(qBlue(rgb))  - mean.z) * mul );
+			const float3 px = make_float3((float(rgb[0]) - mean.x) * mul,
+										  (float(rgb[1]) - mean.y) * mul,
+										  (float(rgb[2]) - mean.z) * mul );
 
 			// note:  caffe/GIE is band-sequential (as opposed to the typical Band Interleaved by Pixel)
 			cpuPtr[imgPixels * 0 + y * imgWidth + x] = px.x;
@@ -171,19 +190,13 @@ bool loadImageBGR( const char* filename, float3** cpu, float3** gpu, int* width,
 	}
 
 	// load original image
-	QImage qImg;
+	cpu_image img;
 
-	if( !qImg.load(filename) )
-	{
-		printf("failed to load image %s\n", filename);
+	if( !loadImageRaw(filename, *width, *height, img) )
 		return false;
-	}
-
-	if( *width != 0 && *height != 0 )
-		qImg = qImg.scaled(*width, *height, Qt::IgnoreAspectRatio);
 
-	const uint32_t imgWidth  = qImg.width();
-	const uint32_t imgHeight = qImg.height();
+	const uint32_t imgWidth  = img.width;
+	const uint32_t imgHeight = img.height;
 	const uint32_t imgPixels = imgWidth * imgHeight;
 	const size_t   imgSize   = imgWidth * imgHeight * sizeof(float) * 3;
 
@@ -202,11 +215,11 @@ bool loadImageBGR( const char* filename, float3** cpu, float3** gpu, int* width,
 	{
 		for( uint32_t x=0; x < imgWidth; x++ )
 		{
-			const QRgb rgb  = qImg.pixel(x,y);
+			const uint8_t* rgb = img.data.data() + y * img.pitch() + x * 4;
 			const float mul = 1.0f; 	//1.0f / 255.0f;
-			const float3 px = make_float3((float(qBlue(rgb))  - mean.x) * mul,
-										  (float(qGreen(rgb)) - mean.y) * mul,
-										  (float(qRed(rgb))   - mean.z) * mul );
+			const float3 px = make_float3((float(rgb[2]) - mean.x) * mul,
+										  (float(rgb[1]) - mean.y) * mul,
+										  (float(rgb[0]) - mean.z) * mul );
 
 			// note:  caffe/GIE is band-sequential (as opposed to the typical Band Interleaved by Pixel)
 			cpuPtr[imgPixels * 0 + y * imgWidth + x] = px.x;
@@ -23,6 +23,8 @@
 #include "camera/gstCamera.h"
 #include "camera/gstUtility.h"
 #include "camera/v4l2Camera.h"
+#include "camera/frameRecord.h"
+#include "camera/replayFrameSource.h"
 
 #include "display/glDisplay.h"
 #include "display/glTexture.h"